@@ -611,6 +611,19 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_BEGIN("bn_mod_inv") {
+		bn_rand(b, RLC_POS, RLC_BN_BITS);
+		if (bn_is_even(b)) {
+			bn_add_dig(b, b, 1);
+		}
+		do {
+			bn_rand_mod(a, b);
+			bn_gcd(c, a, b);
+		} while (bn_cmp_dig(c, 1) != RLC_EQ);
+		BENCH_ADD(bn_mod_inv(c, a, b));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("bn_mxp") {
 		bn_rand(a, RLC_POS, 2 * RLC_BN_BITS - RLC_DIG / 2);
 		bn_rand(b, RLC_POS, RLC_BN_BITS);
@@ -662,6 +675,98 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	{
+		bn_t t[RLC_BN_TABLE], x[8], y[8];
+
+		for (int j = 0; j < RLC_BN_TABLE; j++) {
+			bn_null(t[j]);
+			bn_new(t[j]);
+		}
+		for (int j = 0; j < 8; j++) {
+			bn_null(x[j]);
+			bn_null(y[j]);
+			bn_new(x[j]);
+			bn_new(y[j]);
+			bn_rand(x[j], RLC_POS, RLC_BN_BITS);
+			bn_mod(x[j], x[j], b);
+			bn_rand(y[j], RLC_POS, RLC_BN_BITS);
+			bn_mod(y[j], y[j], b);
+		}
+
+		BENCH_BEGIN("bn_mxp_pre") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mod(a, a, b);
+			BENCH_ADD(bn_mxp_pre(t, a, b));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mxp_fix") {
+			bn_rand(d, RLC_POS, RLC_BN_BITS);
+			bn_mod(d, d, b);
+			BENCH_ADD(bn_mxp_fix(c, (const bn_t *)t, d, b));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mxp_sim (2)") {
+			BENCH_ADD(bn_mxp_sim(c, (const bn_t *)x, (const bn_t *)y, 2, b));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mxp_sim (8)") {
+			BENCH_ADD(bn_mxp_sim(c, (const bn_t *)x, (const bn_t *)y, 8, b));
+		}
+		BENCH_END;
+
+		for (int j = 0; j < RLC_BN_TABLE; j++) {
+			bn_free(t[j]);
+		}
+		for (int j = 0; j < 8; j++) {
+			bn_free(x[j]);
+			bn_free(y[j]);
+		}
+	}
+
+	{
+		bn_mon_t m;
+
+		bn_mon_null(m);
+		bn_mon_new(m);
+
+		bn_copy(d, b);
+		if (bn_is_even(d)) {
+			bn_add_dig(d, d, 1);
+		}
+
+		BENCH_BEGIN("bn_mon_set") {
+			BENCH_ADD(bn_mon_set(m, d));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mon_conv") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mod(a, a, d);
+			BENCH_ADD(bn_mon_conv(c, a, m));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mul_mon") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mod(a, a, d);
+			bn_mon_conv(c, a, m);
+			BENCH_ADD(bn_mul_mon(c, c, a, m));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mxp_mon") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mon_conv(a, a, m);
+			BENCH_ADD(bn_mxp_mon(c, a, d, m));
+		}
+		BENCH_END;
+
+		bn_mon_free(m);
+	}
+
 	BENCH_BEGIN("bn_srt") {
 		bn_rand(a, RLC_POS, RLC_BN_BITS);
 		BENCH_ADD(bn_srt(b, a));
@@ -797,6 +902,10 @@ static void arith(void) {
 	BENCH_ONCE("bn_gen_prime_stron", bn_gen_prime_stron(a, RLC_BN_BITS));
 #endif
 
+	BENCH_ONCE("bn_gen_prime_par", bn_gen_prime_par(a, RLC_BN_BITS, 0, 4));
+
+	BENCH_ONCE("bn_gen_prime_par (safe)", bn_gen_prime_par(a, RLC_BN_BITS, 1, 4));
+
 	BENCH_ONCE("bn_is_prime", bn_is_prime(a));
 
 	BENCH_ONCE("bn_is_prime_basic", bn_is_prime_basic(a));
@@ -917,6 +1026,59 @@ static void arith(void) {
 	bn_free(e);
 }
 
+/**
+ * Runs a benchmark of a multiplication method on operands of a given size.
+ *
+ * @param[in] LABEL			- the name of the method.
+ * @param[in] BITS			- the size of the operands.
+ * @param[in] FUNCTION		- the function to benchmark.
+ */
+#define BENCH_SWEEP(LABEL, BITS, FUNCTION)									\
+	bench_reset();															\
+	snprintf(label, sizeof(label), "%s (%d)", LABEL, BITS);					\
+	bench_label(label, 32);													\
+	bench_before();															\
+	for (int i = 0; i < BENCH; i++)	{										\
+		FUNCTION;															\
+	}																		\
+	bench_after();															\
+	bench_compute(BENCH);													\
+	bench_print();															\
+
+static void sweep(void) {
+	bn_t a, b, c;
+	char label[64];
+
+	bn_null(a);
+	bn_null(b);
+	bn_null(c);
+
+	bn_new(a);
+	bn_new(b);
+	bn_new(c);
+
+	/* Sizes above the precision need ALLOC = DYNAMIC. */
+	for (int bits = 256; bits <= 65536; bits <<= 1) {
+#if ALLOC != DYNAMIC
+		if (2 * RLC_CEIL(bits, RLC_DIG) + 1 > RLC_BN_SIZE) {
+			break;
+		}
+#endif
+		bn_rand(a, RLC_POS, bits);
+		bn_rand(b, RLC_POS, bits);
+#if BN_MUL == COMBA || !defined(STRIP)
+		BENCH_SWEEP("bn_mul_comba", bits, bn_mul_comba(c, a, b));
+#endif
+		BENCH_SWEEP("bn_mul_toom3", bits, bn_mul_toom3(c, a, b));
+		BENCH_SWEEP("bn_mul_ntt", bits, bn_mul_ntt(c, a, b));
+		BENCH_SWEEP("bn_mul_dyn", bits, bn_mul_dyn(c, a, b));
+	}
+
+	bn_free(a);
+	bn_free(b);
+	bn_free(c);
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -930,6 +1092,8 @@ int main(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	util_banner("Multiplication by size:", 1);
+	sweep();
 
 	core_clean();
 	return 0;
@@ -40,7 +40,9 @@
 static void rsa(void) {
 	rsa_t pub, prv;
 	uint8_t in[10], new[10], h[MD_LEN], out[RLC_BN_BITS / 8 + 1];
-	int out_len, new_len;
+	uint8_t msgs[16][10], sigs[16][RLC_BN_BITS / 8 + 1], decs[16][10];
+	uint8_t *bm[16], *bs[16], *bd[16];
+	int out_len, new_len, ml[16], bl[16], dl[16];
 
 	rsa_null(pub);
 	rsa_null(prv);
@@ -48,6 +50,14 @@ static void rsa(void) {
 	rsa_new(pub);
 	rsa_new(prv);
 
+	for (int i = 0; i < 16; i++) {
+		rand_bytes(msgs[i], sizeof(msgs[i]));
+		bm[i] = msgs[i];
+		bs[i] = sigs[i];
+		ml[i] = sizeof(msgs[i]);
+		bl[i] = sizeof(sigs[i]);
+	}
+
 	BENCH_ONCE("cp_rsa_gen", cp_rsa_gen(pub, prv, RLC_BN_BITS));
 
 	BENCH_BEGIN("cp_rsa_enc") {
@@ -160,8 +170,55 @@ static void rsa(void) {
 		md_map(h, in, sizeof(in));
 		BENCH_ADD(cp_rsa_sig_quick(out, &out_len, in, sizeof(in), 1, prv));
 	} BENCH_END;
+
+	BENCH_SMALL("cp_rsa_sig_batch (16)",
+			cp_rsa_sig_batch(bs, bl, bm, ml, 0, 16, prv));
+
+	for (int i = 0; i < 16; i++) {
+		bl[i] = sizeof(sigs[i]);
+		cp_rsa_enc(bs[i], &bl[i], bm[i], ml[i], pub);
+		bd[i] = decs[i];
+	}
+	BENCH_SMALL("cp_rsa_dec_batch (16)", {
+		for (int j = 0; j < 16; j++) {
+			dl[j] = sizeof(decs[j]);
+		}
+		cp_rsa_dec_batch(bd, dl, bs, bl, 16, prv);
+	});
 #endif
 
+	BENCH_ONCE("cp_rsa_gen_multi (k = 3)",
+			cp_rsa_gen_multi(pub, prv, RLC_BN_BITS, 3));
+
+	BENCH_BEGIN("cp_rsa_dec_quick (k = 3)") {
+		out_len = RLC_BN_BITS / 8 + 1;
+		new_len = out_len;
+		rand_bytes(in, sizeof(in));
+		cp_rsa_enc(out, &out_len, in, sizeof(in), pub);
+		BENCH_ADD(cp_rsa_dec_quick(new, &new_len, out, out_len, prv));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_rsa_sig_quick (k = 3)") {
+		out_len = RLC_BN_BITS / 8 + 1;
+		rand_bytes(in, sizeof(in));
+		BENCH_ADD(cp_rsa_sig_quick(out, &out_len, in, sizeof(in), 0, prv));
+	} BENCH_END;
+
+	BENCH_SMALL("cp_rsa_sig_batch (16, k = 3)",
+			cp_rsa_sig_batch(bs, bl, bm, ml, 0, 16, prv));
+
+	BENCH_ONCE("cp_rsa_gen_multi (k = 4)",
+			cp_rsa_gen_multi(pub, prv, RLC_BN_BITS, 4));
+
+	BENCH_BEGIN("cp_rsa_sig_quick (k = 4)") {
+		out_len = RLC_BN_BITS / 8 + 1;
+		rand_bytes(in, sizeof(in));
+		BENCH_ADD(cp_rsa_sig_quick(out, &out_len, in, sizeof(in), 0, prv));
+	} BENCH_END;
+
+	BENCH_SMALL("cp_rsa_sig_batch (16, k = 4)",
+			cp_rsa_sig_batch(bs, bl, bm, ml, 0, 16, prv));
+
 	rsa_free(pub);
 	rsa_free(prv);
 }
@@ -230,20 +287,61 @@ static void benaloh(void) {
 		BENCH_ADD(cp_bdpe_dec(&new, out, out_len, prv));
 	} BENCH_END;
 
+	BENCH_ONCE("cp_bdpe_pre", cp_bdpe_pre(prv));
+
+	cp_bdpe_gen(pub, prv, 65537, RLC_BN_BITS);
+
+	BENCH_BEGIN("cp_bdpe_dec (65537)") {
+		out_len = RLC_BN_BITS / 8 + 1;
+		rand_bytes(out, 2);
+		in = (out[0] | (out[1] << 8)) % 65537;
+		cp_bdpe_enc(out, &out_len, in, pub);
+		BENCH_ADD(cp_bdpe_dec(&new, out, out_len, prv));
+	} BENCH_END;
+
+	cp_bdpe_gen(pub, prv, 3 * 3 * 3 * 5 * 7 * 11 * 13, RLC_BN_BITS);
+
+	BENCH_BEGIN("cp_bdpe_dec (3^3*5*7*11*13)") {
+		out_len = RLC_BN_BITS / 8 + 1;
+		rand_bytes(out, 2);
+		in = (out[0] | (out[1] << 8)) % (3 * 3 * 3 * 5 * 7 * 11 * 13);
+		cp_bdpe_enc(out, &out_len, in, pub);
+		BENCH_ADD(cp_bdpe_dec(&new, out, out_len, prv));
+	} BENCH_END;
+
 	bdpe_free(pub);
 	bdpe_free(prv);
 }
 
 static void paillier(void) {
-	bn_t n, l;
+	bn_t n, l, a, b, c, x[16], y[16], z[16];
+	phpe_t pub, prv;
 	uint8_t in[1000], new[1000], out[RLC_BN_BITS / 8 + 1];
 	int in_len, out_len;
 
 	bn_null(n);
 	bn_null(l);
+	phpe_null(pub);
+	phpe_null(prv);
 
 	bn_new(n);
 	bn_new(l);
+	phpe_new(pub);
+	phpe_new(prv);
+	bn_null(a);
+	bn_null(b);
+	bn_null(c);
+	bn_new(a);
+	bn_new(b);
+	bn_new(c);
+	for (int i = 0; i < 16; i++) {
+		bn_null(x[i]);
+		bn_null(y[i]);
+		bn_null(z[i]);
+		bn_new(x[i]);
+		bn_new(y[i]);
+		bn_new(z[i]);
+	}
 
 	BENCH_ONCE("cp_phpe_gen", cp_phpe_gen(n, l, RLC_BN_BITS / 2));
 
@@ -265,8 +363,75 @@ static void paillier(void) {
 		BENCH_ADD(cp_phpe_dec(new, in_len, out, out_len, n, l));
 	} BENCH_END;
 
+	BENCH_ONCE("cp_phpe_gen_key", cp_phpe_gen_key(pub, prv, RLC_BN_BITS / 2));
+
+	BENCH_BEGIN("cp_phpe_enc_key") {
+		bn_rand_mod(a, pub->n);
+		BENCH_ADD(cp_phpe_enc_key(b, a, pub));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_phpe_pre (1)") {
+		BENCH_ADD(cp_phpe_pre(pub, pub->pool_len + 1));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_phpe_enc_key (pool)") {
+		bn_rand_mod(a, pub->n);
+		cp_phpe_pre(pub, 1);
+		BENCH_ADD(cp_phpe_enc_key(b, a, pub));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_phpe_dec_key") {
+		bn_rand_mod(a, pub->n);
+		cp_phpe_enc_key(b, a, pub);
+		BENCH_ADD(cp_phpe_dec_key(a, b, prv));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_phpe_add") {
+		bn_rand_mod(c, pub->n);
+		cp_phpe_enc_key(a, c, pub);
+		bn_rand_mod(c, pub->n);
+		cp_phpe_enc_key(b, c, pub);
+		BENCH_ADD(cp_phpe_add(c, a, b, pub));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_phpe_mul (32 bits)") {
+		bn_rand_mod(c, pub->n);
+		cp_phpe_enc_key(a, c, pub);
+		bn_rand(b, RLC_POS, 32);
+		BENCH_ADD(cp_phpe_mul(c, a, b, pub));
+	} BENCH_END;
+
+	for (int i = 0; i < 16; i++) {
+		bn_rand_mod(c, pub->n);
+		cp_phpe_enc_key(x[i], c, pub);
+		bn_rand_mod(c, pub->n);
+		cp_phpe_enc_key(y[i], c, pub);
+	}
+
+	BENCH_BEGIN("cp_phpe_add_batch (16)") {
+		BENCH_ADD(cp_phpe_add_batch(z, x, y, 16, pub));
+	} BENCH_END;
+
+	for (int i = 0; i < 16; i++) {
+		bn_rand(y[i], RLC_POS, 32);
+	}
+
+	BENCH_BEGIN("cp_phpe_mul_batch (16, 32 bits)") {
+		BENCH_ADD(cp_phpe_mul_batch(z, x, y, 16, pub));
+	} BENCH_END;
+
 	bn_free(n);
 	bn_free(l);
+	phpe_free(pub);
+	phpe_free(prv);
+	bn_free(a);
+	bn_free(b);
+	bn_free(c);
+	for (int i = 0; i < 16; i++) {
+		bn_free(x[i]);
+		bn_free(y[i]);
+		bn_free(z[i]);
+	}
 }
 
 #endif
@@ -373,10 +538,67 @@ static void ecies(void) {
 	bn_free(d);
 }
 
-static void ecdsa(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, h[MD_LEN];
-	bn_t r, s, d;
+#if EC_CUR == PRIME
+
+/**
+ * Recovers the parity of the y-coordinate of the commitment in an ECDSA
+ * signature, as a signer with access to the nonce would do.
+ */
+static int ecdsa_bit(bn_t r, bn_t s, uint8_t *msg, int len, ec_t q) {
+	bn_t n, e, k, u;
 	ec_t p;
+	uint8_t h[MD_LEN];
+	int bit;
+
+	bn_null(n);
+	bn_null(e);
+	bn_null(k);
+	bn_null(u);
+	ec_null(p);
+
+	bn_new(n);
+	bn_new(e);
+	bn_new(k);
+	bn_new(u);
+	ec_new(p);
+
+	ec_curve_get_ord(n);
+	bn_gcd_ext(e, k, NULL, s, n);
+	if (bn_sign(k) == RLC_NEG) {
+		bn_add(k, k, n);
+	}
+	md_map(h, msg, len);
+	len = MD_LEN;
+	if (8 * len > bn_bits(n)) {
+		len = RLC_CEIL(bn_bits(n), 8);
+		bn_read_bin(e, h, len);
+		bn_rsh(e, e, 8 * len - bn_bits(n));
+	} else {
+		bn_read_bin(e, h, len);
+	}
+	bn_mul(e, e, k);
+	bn_mod(e, e, n);
+	bn_mul(u, r, k);
+	bn_mod(u, u, n);
+	ec_mul_sim_gen(p, e, q, u);
+	ec_norm(p, p);
+	bit = fp_get_bit(p->y, 0);
+
+	bn_free(n);
+	bn_free(e);
+	bn_free(k);
+	bn_free(u);
+	ec_free(p);
+	return bit;
+}
+
+#endif
+
+static void ecdsa(void) {
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, h[MD_LEN], *m[16];
+	int l[16], b[16], v[16];
+	bn_t r, s, d, t[16], u[16];
+	ec_t p, q[16];
 
 	bn_null(r);
 	bn_null(s);
@@ -388,6 +610,19 @@ static void ecdsa(void) {
 	bn_new(d);
 	ec_new(p);
 
+	for (int i = 0; i < 16; i++) {
+		bn_null(t[i]);
+		bn_null(u[i]);
+		ec_null(q[i]);
+		bn_new(t[i]);
+		bn_new(u[i]);
+		ec_new(q[i]);
+		m[i] = msg;
+		l[i] = sizeof(msg);
+		cp_ecdsa_gen(d, q[i]);
+		cp_ecdsa_sig(t[i], u[i], msg, sizeof(msg), 0, d);
+	}
+
 	BENCH_BEGIN("cp_ecdsa_gen") {
 		BENCH_ADD(cp_ecdsa_gen(d, p));
 	}
@@ -415,16 +650,33 @@ static void ecdsa(void) {
 	}
 	BENCH_END;
 
+	BENCH_SMALL("cp_ecdsa_ver_batch (16)",
+			cp_ecdsa_ver_batch(b, t, u, NULL, m, l, 0, q, 16));
+
+#if EC_CUR == PRIME
+	for (int i = 0; i < 16; i++) {
+		v[i] = ecdsa_bit(t[i], u[i], msg, sizeof(msg), q[i]);
+	}
+	BENCH_SMALL("cp_ecdsa_ver_batch (16, rec)",
+			cp_ecdsa_ver_batch(b, t, u, v, m, l, 0, q, 16));
+#endif
+
 	bn_free(r);
 	bn_free(s);
 	bn_free(d);
 	ec_free(p);
+	for (int i = 0; i < 16; i++) {
+		bn_free(t[i]);
+		bn_free(u[i]);
+		ec_free(q[i]);
+	}
 }
 
 static void ecss(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
-	bn_t r, s, d;
-	ec_t p;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, *m[16];
+	int l[16], b[16], v[16] = { 0 };
+	bn_t r, s, d, t[16], u[16], w[16];
+	ec_t p, q[16];
 
 	bn_null(r);
 	bn_null(s);
@@ -451,10 +703,47 @@ static void ecss(void) {
 	}
 	BENCH_END;
 
+	ec_curve_get_ord(d);
+	for (int i = 0; i < 16; i++) {
+		bn_null(t[i]);
+		bn_null(u[i]);
+		bn_null(w[i]);
+		ec_null(q[i]);
+		bn_new(t[i]);
+		bn_new(u[i]);
+		bn_new(w[i]);
+		ec_new(q[i]);
+		m[i] = msg;
+		l[i] = sizeof(msg);
+		cp_ecss_gen(r, q[i]);
+		cp_ecss_sig(t[i], u[i], msg, sizeof(msg), r);
+		ec_mul_sim_gen(p, u[i], q[i], t[i]);
+		ec_norm(p, p);
+		ec_get_x(w[i], p);
+		bn_mod(w[i], w[i], d);
+#if EC_CUR == PRIME
+		v[i] = fp_get_bit(p->y, 0);
+#endif
+	}
+
+	BENCH_SMALL("cp_ecss_ver_batch (16)",
+			cp_ecss_ver_batch(b, t, u, NULL, NULL, m, l, q, 16));
+
+#if EC_CUR == PRIME
+	BENCH_SMALL("cp_ecss_ver_batch (16, rec)",
+			cp_ecss_ver_batch(b, t, u, w, v, m, l, q, 16));
+#endif
+
 	bn_free(r);
 	bn_free(s);
 	bn_free(d);
 	ec_free(p);
+	for (int i = 0; i < 16; i++) {
+		bn_free(t[i]);
+		bn_free(u[i]);
+		bn_free(w[i]);
+		ec_free(q[i]);
+	}
 }
 
 static void vbnn(void) {
@@ -618,8 +907,10 @@ static void bgn(void) {
 	g1_t c[2];
 	g2_t d[2];
 	gt_t e[4];
+	g1_t h[16][2];
 	bgn_t pub, prv;
-	dig_t in;
+	bgn_tab_t tab;
+	dig_t in, out[16];
 
 	g1_null(c[0]);
 	g1_null(c[1]);
@@ -627,6 +918,7 @@ static void bgn(void) {
 	g2_null(d[1]);
 	bgn_null(pub);
 	bgn_null(prv);
+	bgn_tab_null(tab);
 
 	g1_new(c[0]);
 	g1_new(c[1]);
@@ -634,10 +926,17 @@ static void bgn(void) {
 	g2_new(d[1]);
 	bgn_new(pub);
 	bgn_new(prv);
+	bgn_tab_new(tab);
 	for (int i = 0; i < 4; i++) {
 		gt_null(e[i]);
 		gt_new(e[i]);
 	}
+	for (int i = 0; i < 16; i++) {
+		g1_null(h[i][0]);
+		g1_null(h[i][1]);
+		g1_new(h[i][0]);
+		g1_new(h[i][1]);
+	}
 
 	BENCH_BEGIN("cp_bgn_gen") {
 		BENCH_ADD(cp_bgn_gen(pub, prv));
@@ -677,21 +976,49 @@ static void bgn(void) {
 		BENCH_ADD(cp_bgn_add(e, e, e));
 	} BENCH_END;
 
+	BENCH_SMALL("cp_bgn_tab_gen (1, 2^24)", cp_bgn_tab_gen(tab, 1, 1 << 24, 0, prv));
+
+	cp_bgn_enc1(c, (1 << 24) - 1, pub);
+	BENCH_SMALL("cp_bgn_dec1_tab (2^24)", cp_bgn_dec1_tab(&in, c, prv, tab));
+
+	for (int i = 0; i < 16; i++) {
+		cp_bgn_enc1(h[i], (1 << 24) - 1 - i, pub);
+	}
+	BENCH_SMALL("cp_bgn_dec1_batch (16, 2^24)", cp_bgn_dec1_batch(out, h, 16, prv, tab));
+
+	BENCH_SMALL("cp_bgn_tab_gen (2, 2^24)", cp_bgn_tab_gen(tab, 2, 1 << 24, 0, prv));
+
+	cp_bgn_enc2(d, (1 << 24) - 1, pub);
+	BENCH_SMALL("cp_bgn_dec2_tab (2^24)", cp_bgn_dec2_tab(&in, d, prv, tab));
+
+	BENCH_SMALL("cp_bgn_tab_gen (3, 2^16)", cp_bgn_tab_gen(tab, 3, 1 << 16, 0, prv));
+
+	cp_bgn_enc1(c, 255, pub);
+	cp_bgn_enc2(d, 255, pub);
+	cp_bgn_mul(e, c, d);
+	BENCH_SMALL("cp_bgn_dec_tab (2^16)", cp_bgn_dec_tab(&in, e, prv, tab));
+
 	g1_free(c[0]);
 	g1_free(c[1]);
 	g2_free(d[0]);
 	g2_free(d[1]);
 	bgn_free(pub);
 	bgn_free(prv);
+	bgn_tab_free(tab);
 	for (int i = 0; i < 4; i++) {
 		gt_free(e[i]);
 	}
+	for (int i = 0; i < 16; i++) {
+		g1_free(h[i][0]);
+		g1_free(h[i][1]);
+	}
 }
 
 static void bls(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
-	g1_t s;
-	g2_t p;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, *m[16];
+	int l[16], b[16];
+	g1_t s, t[16];
+	g2_t p, q[16];
 	bn_t d;
 
 	g1_null(s);
@@ -702,6 +1029,17 @@ static void bls(void) {
 	g2_new(p);
 	bn_new(d);
 
+	for (int i = 0; i < 16; i++) {
+		g1_null(t[i]);
+		g2_null(q[i]);
+		g1_new(t[i]);
+		g2_new(q[i]);
+		m[i] = msg;
+		l[i] = sizeof(msg);
+		cp_bls_gen(d, q[i]);
+		cp_bls_sig(t[i], msg, sizeof(msg), d);
+	}
+
 	BENCH_BEGIN("cp_bls_gen") {
 		BENCH_ADD(cp_bls_gen(d, p));
 	}
@@ -717,9 +1055,25 @@ static void bls(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("cp_bls_agg_sig (16)") {
+		BENCH_ADD(cp_bls_agg_sig(s, t, 16));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_bls_agg_key (16)") {
+		BENCH_ADD(cp_bls_agg_key(p, q, 16));
+	}
+	BENCH_END;
+
+	BENCH_SMALL("cp_bls_ver_batch (16)", cp_bls_ver_batch(b, t, m, l, q, 16));
+
 	g1_free(s);
 	bn_free(d);
 	g2_free(p);
+	for (int i = 0; i < 16; i++) {
+		g1_free(t[i]);
+		g2_free(q[i]);
+	}
 }
 
 static void bbs(void) {
@@ -30,6 +30,8 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -161,6 +163,12 @@ static void util(void) {
 		BENCH_ADD(ep_read_bin(p, bin, l));
 	} BENCH_END;
 
+	BENCH_SMALL("ep_param_set", ep_param_set(ep_param_get()));
+
+	BENCH_BEGIN("core_set_crv") {
+		BENCH_ADD(core_set_crv(core_get_crv()));
+	} BENCH_END;
+
 	ep_free(p);
 	ep_free(q);
 	for (int j = 0; j < 4; j++) {
@@ -549,6 +557,22 @@ static void arith(void) {
 		BENCH_ADD(ep_map(p, msg, 5));
 	} BENCH_END;
 
+#if EP_MAP == BASIC || !defined(STRIP)
+	BENCH_BEGIN("ep_map_basic") {
+		uint8_t msg[5];
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep_map_basic(p, msg, 5));
+	} BENCH_END;
+#endif
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+	BENCH_BEGIN("ep_map_svdwm") {
+		uint8_t msg[5];
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep_map_svdwm(p, msg, 5));
+	} BENCH_END;
+#endif
+
 	BENCH_BEGIN("ep_pck") {
 		ep_rand(p);
 		BENCH_ADD(ep_pck(q, p));
@@ -567,6 +591,81 @@ static void arith(void) {
 	bn_free(n);
 }
 
+static void lot(void) {
+	int n = 4096, reps;
+	char label[32];
+	ep_t r, t, *p = (ep_t *)calloc(n, sizeof(ep_t));
+	bn_t o, *k = (bn_t *)calloc(n, sizeof(bn_t));
+
+	if (p == NULL || k == NULL) {
+		free(p);
+		free(k);
+		return;
+	}
+
+	ep_null(r);
+	ep_null(t);
+	bn_null(o);
+
+	ep_new(r);
+	ep_new(t);
+	bn_new(o);
+	for (int i = 0; i < n; i++) {
+		ep_null(p[i]);
+		bn_null(k[i]);
+		ep_new(p[i]);
+		bn_new(k[i]);
+	}
+
+	ep_curve_get_ord(o);
+	for (int i = 0; i < n; i++) {
+		ep_rand(p[i]);
+		bn_rand_mod(k[i], o);
+	}
+
+	/* Sweep the number of points, keeping the total work roughly constant. */
+	for (int j = 2; j <= n; j *= 2) {
+		reps = RLC_MAX(1, BENCH * 16 / j);
+
+		bench_reset();
+		sprintf(label, "ep_mul_sim_lot (%d)", j);
+		bench_label(label, 32);
+		bench_before();
+		for (int i = 0; i < reps; i++) {
+			ep_mul_sim_lot(r, (const ep_t *)p, (const bn_t *)k, j);
+		}
+		bench_after();
+		bench_compute(reps);
+		bench_print();
+
+		bench_reset();
+		sprintf(label, "ep_mul + ep_add (%d)", j);
+		bench_label(label, 32);
+		bench_before();
+		for (int i = 0; i < reps; i++) {
+			ep_set_infty(r);
+			for (int l = 0; l < j; l++) {
+				ep_mul(t, p[l], k[l]);
+				ep_add(r, r, t);
+			}
+			ep_norm(r, r);
+		}
+		bench_after();
+		bench_compute(reps);
+		bench_print();
+	}
+
+	ep_free(r);
+	ep_free(t);
+	bn_free(o);
+	for (int i = 0; i < n; i++) {
+		ep_free(p[i]);
+		bn_free(k[i]);
+	}
+	free(p);
+	free(k);
+}
+
 static void bench(void) {
 	ep_param_print();
 	util_banner("Utilities:", 1);
@@ -574,6 +673,8 @@ static void bench(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	util_banner("Simultaneous multiplication of many points:", 1);
+	lot();
 }
 
 int main(void) {
@@ -561,6 +561,22 @@ static void arith(void) {
 		BENCH_ADD(ep2_map(p, msg, 5));
 	} BENCH_END;
 
+#if EP_MAP == BASIC || !defined(STRIP)
+	BENCH_BEGIN("ep2_map_basic") {
+		uint8_t msg[5];
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep2_map_basic(p, msg, 5));
+	} BENCH_END;
+#endif
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+	BENCH_BEGIN("ep2_map_svdwm") {
+		uint8_t msg[5];
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep2_map_svdwm(p, msg, 5));
+	} BENCH_END;
+#endif
+
 	BENCH_BEGIN("ep2_pck") {
 		ep2_rand(p);
 		BENCH_ADD(ep2_pck(q, p));
@@ -580,6 +596,81 @@ static void arith(void) {
 	fp2_free(s);
 }
 
+static void lot(void) {
+	int n = 4096, reps;
+	char label[32];
+	ep2_t r, t, *p = (ep2_t *)calloc(n, sizeof(ep2_t));
+	bn_t o, *k = (bn_t *)calloc(n, sizeof(bn_t));
+
+	if (p == NULL || k == NULL) {
+		free(p);
+		free(k);
+		return;
+	}
+
+	ep2_null(r);
+	ep2_null(t);
+	bn_null(o);
+
+	ep2_new(r);
+	ep2_new(t);
+	bn_new(o);
+	for (int i = 0; i < n; i++) {
+		ep2_null(p[i]);
+		bn_null(k[i]);
+		ep2_new(p[i]);
+		bn_new(k[i]);
+	}
+
+	ep2_curve_get_ord(o);
+	for (int i = 0; i < n; i++) {
+		ep2_rand(p[i]);
+		bn_rand_mod(k[i], o);
+	}
+
+	/* Sweep the number of points, keeping the total work roughly constant. */
+	for (int j = 2; j <= n; j *= 2) {
+		reps = RLC_MAX(1, BENCH * 16 / j);
+
+		bench_reset();
+		sprintf(label, "ep2_mul_sim_lot (%d)", j);
+		bench_label(label, 32);
+		bench_before();
+		for (int i = 0; i < reps; i++) {
+			ep2_mul_sim_lot(r, p, (const bn_t *)k, j);
+		}
+		bench_after();
+		bench_compute(reps);
+		bench_print();
+
+		bench_reset();
+		sprintf(label, "ep2_mul + ep2_add (%d)", j);
+		bench_label(label, 32);
+		bench_before();
+		for (int i = 0; i < reps; i++) {
+			ep2_set_infty(r);
+			for (int l = 0; l < j; l++) {
+				ep2_mul(t, p[l], k[l]);
+				ep2_add(r, r, t);
+			}
+			ep2_norm(r, r);
+		}
+		bench_after();
+		bench_compute(reps);
+		bench_print();
+	}
+
+	ep2_free(r);
+	ep2_free(t);
+	bn_free(o);
+	for (int i = 0; i < n; i++) {
+		ep2_free(p[i]);
+		bn_free(k[i]);
+	}
+	free(p);
+	free(k);
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -611,6 +702,9 @@ int main(void) {
 	util_banner("Arithmetic:", 1);
 	arith();
 
+	util_banner("Simultaneous multiplication of many points:", 1);
+	lot();
+
 	core_clean();
 	return 0;
 }
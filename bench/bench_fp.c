@@ -63,6 +63,11 @@ static void util(void) {
 	fp_new(a);
 	fp_new(b);
 
+	BENCH_BEGIN("fp_prime_get") {
+		BENCH_ADD(fp_prime_get());
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp_copy") {
 		fp_rand(a);
 		BENCH_ADD(fp_copy(b, a));
@@ -504,6 +509,14 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+#if FP_INV == DIVST || !defined(STRIP)
+	BENCH_BEGIN("fp_inv_divst") {
+		fp_rand(a);
+		BENCH_ADD(fp_inv_divst(c, a));
+	}
+	BENCH_END;
+#endif
+
 #if FP_INV == LOWER || !defined(STRIP)
 	BENCH_BEGIN("fp_inv_lower") {
 		fp_rand(a);
@@ -560,6 +573,25 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp_srt_rat") {
+		fp_rand(a);
+		fp_rand(b);
+		BENCH_ADD(fp_srt_rat(c, a, b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_srt_inv") {
+		fp_rand(a);
+		BENCH_ADD(fp_srt_inv(c, a));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_smb") {
+		fp_rand(a);
+		BENCH_ADD(fp_smb(a));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp_prime_conv") {
 		bn_rand(e, RLC_POS, RLC_FP_BITS);
 		BENCH_ADD(fp_prime_conv(a, e));
@@ -1185,6 +1185,13 @@ static void arith12(void) {
 	BENCH_END;
 #endif
 
+	BENCH_BEGIN("fp12_mul_sxs") {
+		fp12_rand(a);
+		fp12_rand(b);
+		BENCH_ADD(fp12_mul_sxs(c, a, b));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp12_sqr") {
 		fp12_rand(a);
 		BENCH_ADD(fp12_sqr(c, a));
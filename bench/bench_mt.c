@@ -0,0 +1,415 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Multi-threaded throughput benchmarks for cryptographic protocols.
+ *
+ * @ingroup bench
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "relic.h"
+#include "relic_bench.h"
+
+/**
+ * Duration of each throughput measurement, in seconds.
+ */
+#define DURATION		1.0
+
+/**
+ * Operations measured, one per job.
+ */
+enum {
+	/** ECDSA signature generation. */
+	ECDSA_SIG,
+	/** ECDSA signature verification. */
+	ECDSA_VER,
+	/** BLS signature generation. */
+	BLS_SIG,
+	/** BLS signature verification. */
+	BLS_VER,
+	/** Pairing computation. */
+	PC_MAP,
+	/** RSA signature generation. */
+	RSA_SIG,
+	/** Number of operations. */
+	OPS
+};
+
+/**
+ * Labels of the operations.
+ */
+static const char *labels[OPS] = {
+	"cp_ecdsa_sig", "cp_ecdsa_ver", "cp_bls_sig", "cp_bls_ver", "pc_map",
+	"cp_rsa_sig"
+};
+
+/**
+ * Work assigned to a thread, padded so that the results written by different
+ * threads do not share a cache line.
+ */
+typedef struct {
+	/** The operation to measure. */
+	int op;
+	/** Number of threads taking part in the measurement. */
+	int threads;
+	/** Number of operations completed. */
+	long long count;
+	/** Elapsed time in seconds. */
+	double time;
+	/** Flag to indicate if the thread was able to run. */
+	int code;
+	/** Padding. */
+	char pad[64];
+} job_t;
+
+/**
+ * RSA key pair shared by all threads, as generating one per thread is slow.
+ */
+static rsa_t prv;
+
+#if MULTI == PTHREAD
+
+/**
+ * State of the barrier synchronizing the start of the threads.
+ */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static int ready = 0, phase = 0;
+
+/**
+ * Flag set when a measurement is abandoned, releasing the waiting threads.
+ */
+static int stop = 0;
+
+/**
+ * Sets the flag that abandons a measurement and wakes the waiting threads.
+ *
+ * @param[in] value			- the value to write.
+ */
+static void sync_stop(int value) {
+	pthread_mutex_lock(&lock);
+	stop = value;
+	ready = 0;
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&lock);
+}
+
+#endif
+
+/**
+ * Waits until all threads taking part in a measurement reach this point.
+ *
+ * @param[in] n				- the number of threads.
+ * @return 1 if the measurement goes on, 0 if it was abandoned.
+ */
+static int sync_threads(int n) {
+#if MULTI == PTHREAD
+	int gen, result;
+
+	pthread_mutex_lock(&lock);
+	gen = phase;
+	if (++ready == n) {
+		ready = 0;
+		phase++;
+		pthread_cond_broadcast(&cond);
+	} else {
+		while (gen == phase && !stop) {
+			pthread_cond_wait(&cond, &lock);
+		}
+	}
+	result = !stop;
+	pthread_mutex_unlock(&lock);
+	return result;
+#elif MULTI == OPENMP
+	(void)n;
+#pragma omp barrier
+	return 1;
+#else
+	(void)n;
+	return 1;
+#endif
+}
+
+/**
+ * Returns the current wall-clock time in seconds.
+ *
+ * @return the current time.
+ */
+static double now(void) {
+#if MULTI == OPENMP
+	return omp_get_wtime();
+#else
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec / 1e9;
+#endif
+}
+
+/**
+ * Runs one operation repeatedly for a fixed time inside a thread, with its own
+ * library and curve contexts.
+ *
+ * @param[in,out] ptr		- the job.
+ * @return NULL.
+ */
+static void *worker(void *ptr) {
+	job_t *job = (job_t *)ptr;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, sig[RLC_BN_BITS / 8 + 1];
+	int len, own = (core_get() == NULL), code = RLC_OK;
+	crv_t *crv = NULL, *old = NULL;
+	double start;
+	bn_t d, r, s;
+	ec_t q;
+	g1_t p;
+	g2_t k;
+	gt_t e;
+
+	if (own && core_init() != RLC_OK) {
+		code = RLC_ERR;
+	}
+
+	bn_null(d);
+	bn_null(r);
+	bn_null(s);
+	ec_null(q);
+	g1_null(p);
+	g2_null(k);
+	gt_null(e);
+
+	TRY {
+		bn_new(d);
+		bn_new(r);
+		bn_new(s);
+		ec_new(q);
+		g1_new(p);
+		g2_new(k);
+		gt_new(e);
+
+		/* Configure a private curve context, as the default one is shared. */
+		old = core_get_crv();
+		crv = (crv_t *)malloc(sizeof(crv_t));
+		if (crv == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		core_init_crv(crv);
+
+		switch (job->op) {
+			case ECDSA_SIG:
+			case ECDSA_VER:
+				if (code == RLC_OK && ec_param_set_any() == RLC_OK) {
+					cp_ecdsa_gen(d, q);
+					cp_ecdsa_sig(r, s, msg, sizeof(msg), 0, d);
+				} else {
+					code = RLC_ERR;
+				}
+				break;
+			case BLS_SIG:
+			case BLS_VER:
+			case PC_MAP:
+				if (code == RLC_OK && pc_param_set_any() == RLC_OK) {
+					cp_bls_gen(d, k);
+					cp_bls_sig(p, msg, sizeof(msg), d);
+				} else {
+					code = RLC_ERR;
+				}
+				break;
+		}
+
+		/* All threads must take part in the barrier, even on failure. */
+		if (!sync_threads(job->threads)) {
+			code = RLC_ERR;
+		}
+		start = now();
+		job->count = 0;
+		do {
+			if (code != RLC_OK) {
+				break;
+			}
+			switch (job->op) {
+				case ECDSA_SIG:
+					cp_ecdsa_sig(r, s, msg, sizeof(msg), 0, d);
+					break;
+				case ECDSA_VER:
+					cp_ecdsa_ver(r, s, msg, sizeof(msg), 0, q);
+					break;
+				case BLS_SIG:
+					cp_bls_sig(p, msg, sizeof(msg), d);
+					break;
+				case BLS_VER:
+					cp_bls_ver(p, msg, sizeof(msg), k);
+					break;
+				case PC_MAP:
+					pc_map(e, p, k);
+					break;
+				case RSA_SIG:
+					len = sizeof(sig);
+					cp_rsa_sig(sig, &len, msg, sizeof(msg), 0, prv);
+					break;
+			}
+			job->count++;
+		} while ((job->time = now() - start) < DURATION);
+	}
+	CATCH_ANY {
+		code = RLC_ERR;
+	}
+	FINALLY {
+		if (crv != NULL) {
+			core_clean_crv(crv);
+			core_set_crv(old);
+			free(crv);
+		}
+		bn_free(d);
+		bn_free(r);
+		bn_free(s);
+		ec_free(q);
+		g1_free(p);
+		g2_free(k);
+		gt_free(e);
+	}
+
+	job->code = code;
+	if (own) {
+		core_clean();
+	}
+	return NULL;
+}
+
+/**
+ * Measures the aggregate throughput of an operation with a number of threads.
+ *
+ * @param[in] op			- the operation.
+ * @param[in] n				- the number of threads.
+ * @return the number of operations per second, or zero on failure.
+ */
+static double throughput(int op, int n) {
+	job_t job[CORES];
+	double total = 0;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		job[i].op = op;
+		job[i].threads = n;
+		job[i].count = 0;
+		job[i].time = 0;
+		job[i].code = RLC_ERR;
+	}
+
+#if MULTI == PTHREAD
+	pthread_t thread[CORES];
+
+	for (i = 0; i < n; i++) {
+		if (pthread_create(&thread[i], NULL, worker, &job[i])) {
+			/* Release the threads already waiting for the missing ones. */
+			sync_stop(1);
+			break;
+		}
+	}
+	for (int j = 0; j < i; j++) {
+		pthread_join(thread[j], NULL);
+	}
+	if (i < n) {
+		sync_stop(0);
+		return 0;
+	}
+#elif MULTI == OPENMP
+#pragma omp parallel num_threads(n)
+	{
+		worker(&job[omp_get_thread_num()]);
+	}
+#else
+	worker(&job[0]);
+#endif
+
+	for (i = 0; i < n; i++) {
+		if (job[i].code != RLC_OK || job[i].time <= 0) {
+			return 0;
+		}
+		total += job[i].count / job[i].time;
+	}
+	return total;
+}
+
+int main(void) {
+	char label[RLC_BENCH_LABEL];
+	double base, ops;
+	rsa_t pub;
+
+	if (core_init() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	conf_print();
+	util_banner("Multi-threaded benchmarks for the CP module:\n", 0);
+	util_print("Threads: 1 to %d, %.1f second(s) per measurement\n", CORES,
+			DURATION);
+
+	rsa_null(pub);
+	rsa_null(prv);
+
+	TRY {
+		rsa_new(pub);
+		rsa_new(prv);
+		if (cp_rsa_gen(pub, prv, RLC_BN_BITS) != RLC_OK) {
+			THROW(ERR_CAUGHT);
+		}
+
+		for (int i = 0; i < OPS; i++) {
+			util_print("\n** Throughput of %s:\n\n", labels[i]);
+			base = 0;
+			/* Double the number of threads up to the number of cores. */
+			for (int n = 1; n <= CORES; n = (n < CORES && 2 * n > CORES ?
+					CORES : 2 * n)) {
+				ops = throughput(i, n);
+				snprintf(label, sizeof(label), "%s (threads = %d)", labels[i],
+						n);
+				bench_label(label, 32);
+				if (n == 1) {
+					base = ops;
+				}
+				if (ops == 0) {
+					util_print("failed\n");
+				} else {
+					util_print("%.1f ops/sec (%.2fx)\n", ops,
+							base > 0 ? ops / base : 0);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+	}
+	FINALLY {
+		rsa_free(pub);
+		rsa_free(prv);
+	}
+
+	core_clean();
+	return 0;
+}
@@ -34,6 +34,88 @@
 #include "relic.h"
 #include "relic_bench.h"
 
+/**
+ * Tests if a point is in G_2 by comparing a^(p + 1) with a^t, as done before
+ * the endomorphism-based tests, for reference.
+ *
+ * @param[in] a				- the point to test.
+ * @return a boolean value indicating if the point is valid.
+ */
+static int g2_is_valid_trc(g2_t a) {
+	bn_t p, n;
+	g2_t u, v;
+	int r;
+
+	bn_null(n);
+	bn_null(p);
+	g2_null(u);
+	g2_null(v);
+
+	bn_new(n);
+	bn_new(p);
+	g2_new(u);
+	g2_new(v);
+
+	g2_get_ord(n);
+	ep_curve_get_cof(p);
+	bn_mul(n, n, p);
+	dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
+	p->used = RLC_FP_DIGS;
+	p->sign = RLC_POS;
+	bn_sub(n, p, n);
+	bn_add_dig(n, n, 1);
+	g2_mul(u, a, n);
+	ep2_frb(v, a, 1);
+	g2_add(v, v, a);
+	r = (g2_cmp(u, v) == RLC_EQ);
+
+	bn_free(p);
+	bn_free(n);
+	g2_free(u);
+	g2_free(v);
+	return r;
+}
+
+/**
+ * Tests if an element is in G_T by comparing a^(p + 1) with a^t, as done
+ * before the endomorphism-based tests, for reference.
+ *
+ * @param[in] a				- the element to test.
+ * @return a boolean value indicating if the element is valid.
+ */
+static int gt_is_valid_trc(gt_t a) {
+	bn_t p, n;
+	gt_t u, v;
+	int r;
+
+	bn_null(n);
+	bn_null(p);
+	gt_null(u);
+	gt_null(v);
+
+	bn_new(n);
+	bn_new(p);
+	gt_new(u);
+	gt_new(v);
+
+	gt_get_ord(n);
+	dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
+	p->used = RLC_FP_DIGS;
+	p->sign = RLC_POS;
+	bn_sub(n, p, n);
+	bn_add_dig(n, n, 1);
+	gt_exp(u, a, n);
+	fp12_frb(v, a, 1);
+	gt_mul(v, v, a);
+	r = (gt_cmp(u, v) == RLC_EQ);
+
+	bn_free(p);
+	bn_free(n);
+	gt_free(u);
+	gt_free(v);
+	return r;
+}
+
 static void memory1(void) {
 	g1_t a[BENCH];
 
@@ -54,14 +136,24 @@ static void memory1(void) {
 
 static void util1(void) {
 	g1_t p, q;
-	uint8_t bin[2 * PC_BYTES + 1];
+	g1_t d[128];
+	uint8_t bin[2 * PC_BYTES + 1], buf[128 * (2 * PC_BYTES + 1)];
 	int l;
+	bn_t n;
 
+	bn_null(n);
 	g1_null(p);
 	g1_null(q);
+	for (int i = 0; i < 128; i++) {
+		g1_null(d[i]);
+	}
 
+	bn_new(n);
 	g1_new(p);
 	g1_new(q);
+	for (int i = 0; i < 128; i++) {
+		g1_new(d[i]);
+	}
 
 	BENCH_BEGIN("g1_is_infty") {
 		g1_rand(p);
@@ -113,6 +205,13 @@ static void util1(void) {
 		BENCH_ADD(g1_is_valid(p));
 	} BENCH_END;
 
+	/* Reference: membership test by multiplying by the group order. */
+	g1_get_ord(n);
+	BENCH_BEGIN("g1_is_valid (order)") {
+		g1_rand(p);
+		BENCH_ADD(g1_mul(q, p, n); (void)g1_is_infty(q));
+	} BENCH_END;
+
 	BENCH_BEGIN("g1_size_bin (0)") {
 		g1_rand(p);
 		BENCH_ADD(g1_size_bin(p, 0));
@@ -148,6 +247,27 @@ static void util1(void) {
 		g1_write_bin(bin, l, p, 1);
 		BENCH_ADD(g1_read_bin(p, bin, l));
 	} BENCH_END;
+
+	for (int i = 0; i < 128; i++) {
+		g1_rand(p);
+		l = g1_size_bin(p, 1);
+		g1_write_bin(buf + i * l, l, p, 1);
+	}
+
+	BENCH_SMALL("g1_read_bin + g1_is_valid (128)",
+		for (int k = 0; k < 128; k++) {
+			g1_read_bin(d[k], buf + k * l, l);
+			(void)g1_is_valid(d[k]);
+		});
+
+	BENCH_SMALL("g1_read_bin_sim (128)", g1_read_bin_sim(d, buf, l, 128));
+
+	g1_free(p);
+	g1_free(q);
+	for (int i = 0; i < 128; i++) {
+		g1_free(d[i]);
+	}
+	bn_free(n);
 }
 
 static void arith1(void) {
@@ -295,14 +415,21 @@ static void memory2(void) {
 
 static void util2(void) {
 	g2_t p, q;
-	uint8_t bin[4 * PC_BYTES + 1];
+	g2_t d[128];
+	uint8_t bin[4 * PC_BYTES + 1], buf[128 * (4 * PC_BYTES + 1)];
 	int l;
 
 	g2_null(p);
 	g2_null(q);
+	for (int i = 0; i < 128; i++) {
+		g2_null(d[i]);
+	}
 
 	g2_new(p);
 	g2_new(q);
+	for (int i = 0; i < 128; i++) {
+		g2_new(d[i]);
+	}
 
 	BENCH_BEGIN("g2_is_infty") {
 		g2_rand(p);
@@ -354,6 +481,11 @@ static void util2(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("g2_is_valid (trace)") {
+		g2_rand(p);
+		BENCH_ADD(g2_is_valid_trc(p));
+	} BENCH_END;
+
 	BENCH_BEGIN("g2_size_bin (0)") {
 		g2_rand(p);
 		BENCH_ADD(g2_size_bin(p, 0));
@@ -390,6 +522,20 @@ static void util2(void) {
 		BENCH_ADD(g2_read_bin(p, bin, l));
 	} BENCH_END;
 
+	for (int i = 0; i < 128; i++) {
+		g2_rand(p);
+		l = g2_size_bin(p, 1);
+		g2_write_bin(buf + i * l, l, p, 1);
+	}
+
+	BENCH_SMALL("g2_read_bin + g2_is_valid (128)",
+		for (int k = 0; k < 128; k++) {
+			g2_read_bin(d[k], buf + k * l, l);
+			(void)g2_is_valid(d[k]);
+		});
+
+	BENCH_SMALL("g2_read_bin_sim (128)", g2_read_bin_sim(d, buf, l, 128));
+
 	g2_free(p)
 	g2_free(q);
 }
@@ -625,6 +771,11 @@ static void util(void) {
 		BENCH_ADD(gt_is_valid(a));
 	} BENCH_END;
 
+	BENCH_BEGIN("gt_is_valid (trace)") {
+		gt_rand(a);
+		BENCH_ADD(gt_is_valid_trc(a));
+	} BENCH_END;
+
 	gt_free(a);
 	gt_free(b);
 }
@@ -30,6 +30,8 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -212,6 +214,7 @@ static void pairing12(void) {
 	ep2_t p[2], r;
 	ep_t q[2];
 	fp12_t e;
+	fp6_t t[2][RLC_PP_TABLE], *_t[2] = { t[0], t[1] };
 	int j;
 
 	bn_null(k);
@@ -233,6 +236,13 @@ static void pairing12(void) {
 		ep_new(q[0]);
 	}
 
+	for (j = 0; j < RLC_PP_TABLE; j++) {
+		fp6_null(t[0][j]);
+		fp6_null(t[1][j]);
+		fp6_new(t[0][j]);
+		fp6_new(t[1][j]);
+	}
+
 	ep2_curve_get_ord(n);
 
 	BENCH_BEGIN("pp_add_k12") {
@@ -404,6 +414,31 @@ static void pairing12(void) {
 		BENCH_ADD(pp_map_sim_oatep_k12(e, q, p, 2));
 	}
 	BENCH_END;
+
+	BENCH_BEGIN("pp_map_pre_k12") {
+		ep2_rand(p[0]);
+		BENCH_ADD(pp_map_pre_k12(t[0], p[0]));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("pp_map_fix_oatep_k12") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		pp_map_pre_k12(t[0], p[0]);
+		BENCH_ADD(pp_map_fix_oatep_k12(e, q[0], t[0]));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("pp_map_sim_fix_oatep_k12 (2)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		pp_map_pre_k12(t[0], p[0]);
+		pp_map_pre_k12(t[1], p[1]);
+		BENCH_ADD(pp_map_sim_fix_oatep_k12(e, q, _t, 2));
+	}
+	BENCH_END;
 #endif
 
 	bn_free(k);
@@ -415,8 +450,76 @@ static void pairing12(void) {
 		ep2_free(p[j]);
 		ep_free(q[j]);
 	}
+	for (j = 0; j < RLC_PP_TABLE; j++) {
+		fp6_free(t[0][j]);
+		fp6_free(t[1][j]);
+	}
 }
 
+#if PP_MAP == OATEP || !defined(STRIP)
+
+static void lot12(void) {
+	int n = 256, reps;
+	char label[40];
+	fp12_t e;
+	ep_t *p = (ep_t *)calloc(n, sizeof(ep_t));
+	ep2_t *q = (ep2_t *)calloc(n, sizeof(ep2_t));
+
+	if (p == NULL || q == NULL) {
+		free(p);
+		free(q);
+		return;
+	}
+
+	fp12_null(e);
+	fp12_new(e);
+	for (int i = 0; i < n; i++) {
+		ep_null(p[i]);
+		ep2_null(q[i]);
+		ep_new(p[i]);
+		ep2_new(q[i]);
+		ep_rand(p[i]);
+		ep2_rand(q[i]);
+	}
+
+	/* Sweep the number of pairings, reporting the cost per pairing. */
+	for (int j = 1; j <= n; j *= 2) {
+		reps = RLC_MAX(1, BENCH * 4 / j);
+
+		bench_reset();
+		sprintf(label, "pp_map_sim_lot_oatep_k12 (%d)", j);
+		bench_label(label, 40);
+		bench_before();
+		for (int i = 0; i < reps; i++) {
+			pp_map_sim_lot_oatep_k12(e, p, q, j);
+		}
+		bench_after();
+		bench_compute(reps * j);
+		bench_print();
+
+		bench_reset();
+		sprintf(label, "pp_map_sim_oatep_k12 (%d)", j);
+		bench_label(label, 40);
+		bench_before();
+		for (int i = 0; i < reps; i++) {
+			pp_map_sim_oatep_k12(e, p, q, j);
+		}
+		bench_after();
+		bench_compute(reps * j);
+		bench_print();
+	}
+
+	fp12_free(e);
+	for (int i = 0; i < n; i++) {
+		ep_free(p[i]);
+		ep2_free(q[i]);
+	}
+	free(p);
+	free(q);
+}
+
+#endif
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -442,6 +545,10 @@ int main(void) {
 
 	if (ep_param_embed() == 12) {
 		pairing12();
+#if PP_MAP == OATEP || !defined(STRIP)
+		util_banner("Multi-pairing of many points (cost per pairing):", 1);
+		lot12();
+#endif
 	}
 
 	core_clean();
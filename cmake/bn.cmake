@@ -6,13 +6,17 @@ message("      BN_PRECI=n        The base precision in bits. Let w be n in words
 message("      BN_MAGNI=DOUBLE   A multiple precision integer can store 2w words.")
 message("      BN_MAGNI=CARRY    A multiple precision integer can store w+1 words.")
 message("      BN_MAGNI=SINGLE   A multiple precision integer can store w words.")
-message("      BN_KARAT=n        The number of Karatsuba steps.\n")
+message("      BN_KARAT=n        The number of Karatsuba steps.")
+message("      BN_DEPTH=w        Width w in [2,8] of precomputation table for fixed base methods.\n")
 
 message("   ** Available multiple precision arithmetic methods (default = COMBA;COMBA;MONTY;SLIDE;STEIN;BASIC):\n")
 
 message("      Integer multiplication:")
 message("      BN_METHD=BASIC    Schoolbook multiplication.")
-message("      BN_METHD=COMBA    Comba multiplication.\n")
+message("      BN_METHD=COMBA    Comba multiplication.")
+message("      Note: with ALLOC=DYNAMIC, large integers switch to Karatsuba, Toom-3 or NTT")
+message("      multiplication. With ALLOC=AUTO or STACK, integers cannot grow past")
+message("      BN_PRECI, so these sizes cannot be represented.\n")
 
 message("      Integer squaring:")
 message("      BN_METHD=BASIC    Schoolbook squaring.")
@@ -52,6 +56,12 @@ if (NOT BN_KARAT)
 endif(NOT BN_KARAT)
 set(BN_KARAT ${BN_KARAT} CACHE INTEGER "Number of Karatsuba levels.")
 
+# Fix the width of precomputation tables for fixed base exponentiation.
+if (NOT BN_DEPTH)
+	set(BN_DEPTH 4)
+endif(NOT BN_DEPTH)
+set(BN_DEPTH "${BN_DEPTH}" CACHE STRING "Width of precomputation table for fixed base methods.")
+
 if (NOT BN_MAGNI)
 	set(BN_MAGNI "DOUBLE")
 endif(NOT BN_MAGNI)
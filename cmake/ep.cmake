@@ -10,7 +10,7 @@ message("      EP_PRECO=[off|on] Build precomputation table for generator.")
 message("      EP_DEPTH=w        Width w in [2,8] of precomputation table for fixed point methods.")
 message("      EP_WIDTH=w        Width w in [2,6] of window processing for unknown point methods.\n")
 
-message("   ** Available prime elliptic curve methods (default = PROJC;LWNAF;COMBS;INTER):\n")
+message("   ** Available prime elliptic curve methods (default = PROJC;LWNAF;COMBS;INTER;BASIC):\n")
 
 message("      Point representation:")
 message("      EP_METHD=BASIC    Affine coordinates.")
@@ -32,6 +32,11 @@ message("      EP_METHD=TRICK    Shamir's trick for simultaneous multiplication.
 message("      EP_METHD=INTER    Interleaving of window NAFs (GLV for Koblitz curves).")
 message("      EP_METHD=JOINT    Joint sparse form.\n")
 
+message("      Hashing to the curve:")
+message("      EP_METHD=BASIC    Try-and-increment hashing.")
+message("      EP_METHD=SVDWM    RFC 9380 hashing with the Shallue-van de Woestijne map.")
+message("      Note: SVDWM is about 2-3 times slower than BASIC and gives different points.\n")
+
 if (NOT EP_DEPTH)
 	set(EP_DEPTH 4)
 endif(NOT EP_DEPTH)
@@ -49,15 +54,20 @@ option(EP_PRECO "Build precomputation table for generator" on)
 
 # Choose the arithmetic methods.
 if (NOT EP_METHD)
-	set(EP_METHD "PROJC;LWNAF;COMBS;INTER")
+	set(EP_METHD "PROJC;LWNAF;COMBS;INTER;BASIC")
 endif(NOT EP_METHD)
 list(LENGTH EP_METHD EP_LEN)
 if (EP_LEN LESS 4)
 	message(FATAL_ERROR "Incomplete EP_METHD specification: ${EP_METHD}")
 endif(EP_LEN LESS 4)
+# Older specifications do not choose a hashing method.
+if (EP_LEN LESS 5)
+	list(APPEND EP_METHD "BASIC")
+endif(EP_LEN LESS 5)
 
 list(GET EP_METHD 0 EP_ADD)
 list(GET EP_METHD 1 EP_MUL)
 list(GET EP_METHD 2 EP_FIX)
 list(GET EP_METHD 3 EP_SIM)
+list(GET EP_METHD 4 EP_MAP)
 set(EP_METHD ${EP_METHD} CACHE STRING "Method for prime elliptic curve arithmetic.")
@@ -30,6 +30,19 @@
  *
  * Interface of useful routines for benchmarking.
  *
+ * Besides the human-readable line printed for each benchmark, the following
+ * environment variables are read once by the first benchmark:
+ *
+ * - RELIC_BENCH_OUT: file to which one record per benchmark is appended, with
+ *   the label, configuration and per-operation statistics (samples, mean, min,
+ *   median, 99th percentile, standard deviation and operations per second).
+ * - RELIC_BENCH_FMT: record format, "csv" (default) or "json" (JSON Lines).
+ * - RELIC_BENCH_BASE: file of records saved by a previous run, whose medians
+ *   are compared against the current ones.
+ * - RELIC_BENCH_WARM: number of leading samples of each benchmark discarded
+ *   as warm-up runs (0 by default).
+ * - RELIC_BENCH_CPU: processor to which the benchmark is pinned (GNU/Linux).
+ *
  * @ingroup bench
  */
 
@@ -40,6 +53,20 @@
 #include "relic_label.h"
 #include "relic_util.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Maximum length of a benchmark label, including the terminator.
+ */
+#define RLC_BENCH_LABEL		64
+
+/**
+ * Maximum number of baseline records loaded for comparison.
+ */
+#define RLC_BENCH_BASE		1024
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -52,7 +79,7 @@
  */
 #define BENCH_ONCE(LABEL, FUNCTION)											\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL, 32);													\
 	bench_before();															\
 	FUNCTION;																\
 	bench_after();															\
@@ -67,7 +94,7 @@
  */
 #define BENCH_SMALL(LABEL, FUNCTION)										\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL, 32);													\
 	bench_before();															\
 	for (int i = 0; i < BENCH; i++)	{										\
 		FUNCTION;															\
@@ -83,7 +110,7 @@
  */
 #define BENCH_BEGIN(LABEL)													\
 	bench_reset();															\
-	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
+	bench_label(LABEL, 32);													\
 	for (int i = 0; i < BENCH; i++)	{										\
 
 /**
@@ -155,10 +182,17 @@ void bench_overhead(void);
 
 /**
  * Resets the benchmark data.
+ */
+void bench_reset(void);
+
+/**
+ * Sets the label of the current benchmark and prints it, padded to a given
+ * width.
  *
  * @param[in] label			- the benchmark label.
+ * @param[in] width			- the width of the printed label.
  */
-void bench_reset(void);
+void bench_label(const char *label, int width);
 
 /**
  * Measures the time before a benchmark is executed.
@@ -178,7 +212,8 @@ void bench_after(void);
 void bench_compute(int benches);
 
 /**
- * Prints the last benchmark.
+ * Prints the last benchmark, appends its record to the output file and
+ * compares it against the baseline, if any.
  */
 void bench_print(void);
 
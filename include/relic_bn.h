@@ -71,6 +71,11 @@
 #define RLC_BN_SIZE		((int)RLC_BN_DIGS)
 #endif
 
+/**
+ * Size of a precomputation table for fixed base modular exponentiation.
+ */
+#define RLC_BN_TABLE	(1 << BN_DEPTH)
+
 /**
  * Positive sign of a multiple precision integer.
  */
@@ -117,6 +122,30 @@ typedef bn_st bn_t[1];
 typedef bn_st *bn_t;
 #endif
 
+/**
+ * Represents a Montgomery context for a fixed odd modulus, caching the values
+ * needed to move operands in and out of Montgomery form.
+ */
+typedef struct {
+	/** The modulus. */
+	bn_t m;
+	/** The Montgomery constant -1/m mod 2^RLC_DIG. */
+	bn_t u;
+	/** The square of the Montgomery radix R modulo m. */
+	bn_t r2;
+	/** The Montgomery radix R modulo m, or one in Montgomery form. */
+	bn_t one;
+} bn_mon_st;
+
+/**
+ * Pointer to a Montgomery context.
+ */
+#if ALLOC == AUTO
+typedef bn_mon_st bn_mon_t[1];
+#else
+typedef bn_mon_st *bn_mon_t;
+#endif
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -209,7 +238,84 @@ typedef bn_st *bn_t;
 #endif
 
 /**
- * Multiples two multiple precision integers. Computes c = a * b.
+ * Initializes a Montgomery context with a null value.
+ *
+ * @param[out] A			- the context to initialize.
+ */
+#if ALLOC == AUTO
+#define bn_mon_null(A)			/* empty */
+#else
+#define bn_mon_null(A)		A = NULL;
+#endif
+
+/**
+ * Calls a function to allocate and initialize a Montgomery context.
+ *
+ * @param[out] A			- the new context.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#if ALLOC == DYNAMIC
+#define bn_mon_new(A)														\
+	A = (bn_mon_t)calloc(1, sizeof(bn_mon_st));								\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#elif ALLOC == AUTO
+#define bn_mon_new(A)														\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#elif ALLOC == STACK
+#define bn_mon_new(A)														\
+	A = (bn_mon_t)alloca(sizeof(bn_mon_st));								\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#endif
+
+/**
+ * Calls a function to clean and free a Montgomery context.
+ *
+ * @param[out] A			- the context to clean and free.
+ */
+#if ALLOC == DYNAMIC
+#define bn_mon_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->m);													\
+		bn_free((A)->u);													\
+		bn_free((A)->r2);													\
+		bn_free((A)->one);													\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define bn_mon_free(A)			/* empty */
+
+#elif ALLOC == STACK
+#define bn_mon_free(A)														\
+	bn_free((A)->m);														\
+	bn_free((A)->u);														\
+	bn_free((A)->r2);														\
+	bn_free((A)->one);														\
+	A = NULL;																\
+
+#endif
+
+/**
+ * Multiples two multiple precision integers. Computes c = a * b. With
+ * ALLOC = DYNAMIC, integers may outgrow the precision, so the multiplication
+ * is dispatched by size and large operands use Karatsuba, Toom-3 or the
+ * number-theoretic transform.
  *
  * @param[out] C			- the result.
  * @param[in] A				- the first multiple precision integer to multiply.
@@ -217,6 +323,8 @@ typedef bn_st *bn_t;
  */
 #if BN_KARAT > 0
 #define bn_mul(C, A, B)		bn_mul_karat(C, A, B)
+#elif ALLOC == DYNAMIC
+#define bn_mul(C, A, B)		bn_mul_dyn(C, A, B)
 #elif BN_MUL == BASIC
 #define bn_mul(C, A, B)		bn_mul_basic(C, A, B)
 #elif BN_MUL == COMBA
@@ -748,6 +856,40 @@ void bn_mul_comba(bn_t c, const bn_t a, const bn_t b);
  */
 void bn_mul_karat(bn_t c, const bn_t a, const bn_t b);
 
+/**
+ * Multiplies two multiple precision integers using one step of Toom-3
+ * multiplication, evaluating at 0, 1, -1, -2 and infinity and computing the
+ * five products with bn_mul_dyn.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer to multiply.
+ * @param[in] b				- the second multiple precision integer to multiply.
+ */
+void bn_mul_toom3(bn_t c, const bn_t a, const bn_t b);
+
+/**
+ * Multiplies two multiple precision integers using a number-theoretic
+ * transform modulo 2^64 - 2^32 + 1 over coefficients of 16 bits.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer to multiply.
+ * @param[in] b				- the second multiple precision integer to multiply.
+ */
+void bn_mul_ntt(bn_t c, const bn_t a, const bn_t b);
+
+/**
+ * Multiplies two multiple precision integers choosing Comba, Karatsuba, Toom-3
+ * or the number-theoretic transform by the size of the operands, and splitting
+ * unbalanced operands. Operands below the Karatsuba threshold are multiplied
+ * with the method chosen by BN_MUL. With ALLOC = DYNAMIC, operands and result
+ * may exceed the precision set by BN_PRECI, and bn_mul() calls this function.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer to multiply.
+ * @param[in] b				- the second multiple precision integer to multiply.
+ */
+void bn_mul_dyn(bn_t c, const bn_t a, const bn_t b);
+
 /**
  * Computes the square of a multiple precision integer using Schoolbook
  * squaring.
@@ -974,6 +1116,78 @@ void bn_mod_pre_pmers(bn_t u, const bn_t m);
  */
 void bn_mod_pmers(bn_t c, const bn_t a, const bn_t m, const bn_t u);
 
+/**
+ * Inverts a multiple precision integer modulo an odd modulus in constant time
+ * using Bernstein-Yang division steps. Computes c = a^{-1} mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to invert.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is not odd or the integer is not
+ * 							invertible.
+ */
+void bn_mod_inv(bn_t c, const bn_t a, const bn_t m);
+
+/**
+ * Prepares a Montgomery context for an odd modulus, caching the Montgomery
+ * constant, R^2 mod m and the representation of one.
+ *
+ * @param[out] mon			- the Montgomery context.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is not odd.
+ */
+void bn_mon_set(bn_mon_t mon, const bn_t m);
+
+/**
+ * Tests if a Montgomery context was prepared for a given modulus.
+ *
+ * @param[in] mon			- the Montgomery context.
+ * @param[in] m				- the modulus.
+ * @return 1 if the context matches the modulus, 0 otherwise.
+ */
+int bn_mon_is(const bn_mon_t mon, const bn_t m);
+
+/**
+ * Converts a multiple precision integer to Montgomery form using a Montgomery
+ * context. Computes c = a * R mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to convert.
+ * @param[in] mon			- the Montgomery context.
+ */
+void bn_mon_conv(bn_t c, const bn_t a, const bn_mon_t mon);
+
+/**
+ * Converts a multiple precision integer from Montgomery form using a
+ * Montgomery context. Computes c = a * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to convert.
+ * @param[in] mon			- the Montgomery context.
+ */
+void bn_mon_back(bn_t c, const bn_t a, const bn_mon_t mon);
+
+/**
+ * Multiplies two multiple precision integers in Montgomery form modulo the
+ * modulus of a Montgomery context. Computes c = a * b * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first integer to multiply.
+ * @param[in] b				- the second integer to multiply.
+ * @param[in] mon			- the Montgomery context.
+ */
+void bn_mul_mon(bn_t c, const bn_t a, const bn_t b, const bn_mon_t mon);
+
+/**
+ * Squares a multiple precision integer in Montgomery form modulo the modulus
+ * of a Montgomery context. Computes c = a * a * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the integer to square.
+ * @param[in] mon			- the Montgomery context.
+ */
+void bn_sqr_mon(bn_t c, const bn_t a, const bn_mon_t mon);
+
 /**
  * Exponentiates a multiple precision integer modulo a positive integer using
  * the binary method.
@@ -1018,6 +1232,71 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m);
  */
 void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m);
 
+/**
+ * Builds a precomputation table for exponentiating a fixed multiple precision
+ * integer modulo a positive integer using the single-table comb method. The
+ * table has RLC_BN_TABLE entries, kept in the representation used by the
+ * chosen modular reduction method.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] a				- the basis.
+ * @param[in] m				- the modulus.
+ */
+void bn_mxp_pre(bn_t *t, const bn_t a, const bn_t m);
+
+/**
+ * Exponentiates a fixed multiple precision integer modulo a positive integer
+ * using a precomputation table. Exponents longer than the modulus or negative
+ * are handled by the variable base method.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the precomputation table.
+ * @param[in] b				- the exponent.
+ * @param[in] m				- the modulus.
+ */
+void bn_mxp_fix(bn_t c, const bn_t *t, const bn_t b, const bn_t m);
+
+/**
+ * Computes the product of many powers of multiple precision integers modulo a
+ * positive integer by interleaving sliding windows of the exponents, sharing
+ * the squarings among them. Computes c = prod a[i]^b[i] mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of bases.
+ * @param[in] m				- the modulus.
+ */
+void bn_mxp_sim(bn_t c, const bn_t *a, const bn_t *b, int n, const bn_t m);
+
+/**
+ * Exponentiates a multiple precision integer in Montgomery form modulo the
+ * modulus of a Montgomery context, without converting the operands. The basis
+ * and the result are in Montgomery form.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ * @param[in] mon			- the Montgomery context.
+ * @throw ERR_NO_VALID		- if the exponent is negative and the basis is not
+ * 							invertible.
+ */
+void bn_mxp_mon(bn_t c, const bn_t a, const bn_t b, const bn_mon_t mon);
+
+/**
+ * Exponentiates a multiple precision integer modulo another multiple precision
+ * integer, reusing a Montgomery context if it was prepared for that modulus
+ * and falling back to bn_mxp() otherwise.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ * @param[in] m				- the modulus.
+ * @param[in] mon			- the Montgomery context.
+ */
+void bn_mxp_ctx(bn_t c, const bn_t a, const bn_t b, const bn_t m,
+		const bn_mon_t mon);
+
 /**
  * Extracts an approximate integer square-root of a multiple precision integer.
  *
@@ -1227,6 +1506,18 @@ void bn_gen_prime_safep(bn_t a, int bits);
  */
 void bn_gen_prime_stron(bn_t a, int bits);
 
+/**
+ * Generates a probable prime number, or a safe prime if requested, by sieving
+ * disjoint windows of candidates on several threads. Falls back to a single
+ * thread if the library is built without multithreading support.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bits			- the length of the number in bits.
+ * @param[in] safe			- the flag to generate a safe prime.
+ * @param[in] n				- the number of threads.
+ */
+void bn_gen_prime_par(bn_t a, int bits, int safe, int n);
+
 /**
  * Tries to factorize an integer using Pollard (p - 1) factoring algorithm.
  * The maximum length of the returned factor is 16 bits.
@@ -1359,6 +1650,18 @@ void bn_rec_reg(int8_t *naf, int *len, const bn_t k, int n, int w);
  */
 void bn_rec_jsf(int8_t *jsf, int *len, const bn_t k, const bn_t l);
 
+/**
+ * Recodes an integer in signed windows of w bits, with digits in the interval
+ * [-2^(w - 1), 2^(w - 1)], as used by the bucket method for multi-scalar
+ * multiplication. The sign of the integer is ignored.
+ *
+ * @param[out] win			- the recoded integer.
+ * @param[in] len			- the number of digits to produce.
+ * @param[in] k				- the integer to recode.
+ * @param[in] w				- the window size in bits.
+ */
+void bn_rec_sdw(int *win, int len, const bn_t k, int w);
+
 /**
  * Recodes a positive integer into two parts k0,k1 such that k = k0 + phi(k1),
  * where phi is an efficient curve endomorphism. If a negative integer is
@@ -137,25 +137,12 @@
 /*============================================================================*/
 
 /**
- * Library context.
+ * Curve context, storing the configured fields and curves together with their
+ * precomputed constants and tables. The default curve context is shared by all
+ * library contexts in the process, so that threads only keep a copy of the
+ * error and random number generator states.
  */
-typedef struct _ctx_t {
-	/** The value returned by the last call, can be RLC_OK or RLC_ERR. */
-	int code;
-
-#ifdef CHECK
-	/** The state of the last error caught. */
-	sts_t *last;
-	/** Error state to be used outside try-catch blocks. */
-	sts_t error;
-	/** Error number to be used outside try-catch blocks. */
-	err_t number;
-	/** The error message respective to the last error. */
-	char *reason[ERR_MAX];
-	/** A flag to indicate if the last error was already caught. */
-	int caught;
-#endif /* CHECK */
-
+typedef struct _crv_t {
 #ifdef WITH_FB
 	/** Identifier of the currently configured binary field. */
 	int fb_id;
@@ -230,6 +217,8 @@ typedef struct _ctx_t {
 	bn_st conv;
 	/** Value of constant one in Montgomery form. */
 	bn_st one;
+	/** Value (R^3 mod p) for converting inverses to Montgomery form. */
+	bn_st conv3;
 #endif /* FP_RDC == MONTY */
 	/** Prime modulus modulo 8. */
 	dig_t mod8;
@@ -239,6 +228,14 @@ typedef struct _ctx_t {
 	int qnr;
 	/** Cubic non-residue. */
 	int cnr;
+	/** Exponent used for extracting square roots. */
+	bn_st srt;
+	/** Exponent (p - 1)/2 used for computing Legendre symbols. */
+	bn_st leg;
+	/** Root of unity of order 2^srt_f used for extracting square roots. */
+	fp_st srt_z;
+	/** Largest integer f such that 2^f divides p - 1. */
+	int srt_f;
 #if FP_RDC == QUICK || !defined(STRIP)
 	/** Sparse representation of prime modulus. */
 	int sps[RLC_TERMS + 1];
@@ -277,6 +274,10 @@ typedef struct _ctx_t {
 	int ep_is_endom;
 	/** Flag that stores if the prime curve is supersingular. */
 	int ep_is_super;
+#if EP_MAP == SVDWM || !defined(STRIP)
+	/** Constants Z, c1, ..., c6 of the Shallue-van de Woestijne map. */
+	fp_st ep_map_c[7];
+#endif /* EP_MAP == SVDWM */
 #ifdef EP_PRECO
 	/** Precomputation table for generator multiplication. */
 	ep_st ep_pre[RLC_EP_TABLE];
@@ -306,6 +307,10 @@ typedef struct _ctx_t {
 	bn_st ep2_h;
 	/** Flag that stores if the prime curve is a twist. */
 	int ep2_is_twist;
+#if EP_MAP == SVDWM || !defined(STRIP)
+	/** Constants Z, c1, c2, c3, c4 of the Shallue-van de Woestijne map. */
+	fp2_st ep2_map_c[5];
+#endif /* EP_MAP == SVDWM */
 #ifdef EP_PRECO
 	/** Precomputation table for generator multiplication.*/
 	ep2_st ep2_pre[RLC_EP_TABLE];
@@ -357,6 +362,32 @@ typedef struct _ctx_t {
 	fp_st fp3_p5[5];
 	/** @} */
 #endif /* WITH_PP */
+} crv_t;
+
+/**
+ * Library context.
+ */
+typedef struct _ctx_t {
+	/** The value returned by the last call, can be RLC_OK or RLC_ERR. */
+	int code;
+
+#ifdef CHECK
+	/** The state of the last error caught. */
+	sts_t *last;
+	/** Error state to be used outside try-catch blocks. */
+	sts_t error;
+	/** Error number to be used outside try-catch blocks. */
+	err_t number;
+	/** The error message respective to the last error. */
+	char *reason[ERR_MAX];
+	/** A flag to indicate if the last error was already caught. */
+	int caught;
+#endif /* CHECK */
+
+	/** Active curve context, pointing to the shared default one by default. */
+	crv_t *crv;
+	/** Private copy of the default curve context, made on first write. */
+	crv_t *own;
 
 #if BENCH > 0
 	/** Stores the time measured before the execution of the benchmark. */
@@ -416,4 +447,51 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Initializes a curve context and activates it in the current library
+ * context. Fields and curves configured afterwards are stored in it.
+ *
+ * @param[out] crv					- the curve context to initialize.
+ */
+void core_init_crv(crv_t *crv);
+
+/**
+ * Finalizes a curve context.
+ *
+ * @param[in,out] crv				- the curve context to finalize.
+ */
+void core_clean_crv(crv_t *crv);
+
+/**
+ * Returns a pointer to the active curve context.
+ *
+ * @return a pointer to the curve context.
+ */
+crv_t *core_get_crv(void);
+
+/**
+ * Activates a configured curve context in the current library context. A null
+ * pointer activates the default curve context.
+ *
+ * @param[in] crv					- the curve context to activate.
+ */
+void core_set_crv(crv_t *crv);
+
+/**
+ * Returns a pointer to the active curve context for modification. If the
+ * active context is the default one and other library contexts share it, the
+ * current library context first switches to a private copy of it, so that the
+ * shared default is never written while other threads read it. Otherwise, the
+ * default is written in place and other contexts cannot start sharing it until
+ * the write finishes with core_done_crv().
+ *
+ * @return a pointer to the curve context, or NULL if no copy can be allocated.
+ */
+crv_t *core_own_crv(void);
+
+/**
+ * Finishes a write to the curve context returned by core_own_crv().
+ */
+void core_done_crv(void);
+
 #endif /* !RLC_CORE_H */
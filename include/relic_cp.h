@@ -42,12 +42,28 @@
 #include "relic_ec.h"
 #include "relic_pc.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Maximum number of primes in a multi-prime RSA modulus.
+ */
+#define RLC_RSA_PRIMES		4
+
+/**
+ * Minimum length in bits of each prime in a multi-prime RSA modulus.
+ */
+#define RLC_RSA_PRIME_MIN	256
+
 /*============================================================================*/
 /* Type definitions.                                                          */
 /*============================================================================*/
 
 /**
- * Represents an RSA key pair.
+ * Represents an RSA key pair. Unlike the Paillier and Benaloh keys, it keeps
+ * no Montgomery contexts: single operations gain nothing from them, and batch
+ * operations build one per prime for the whole batch.
  */
 typedef struct _rsa_t {
 	/** The modulus n = pq. */
@@ -66,6 +82,12 @@ typedef struct _rsa_t {
 	bn_t dq;
 	/** The inverse of q modulo p. */
 	bn_t qi;
+	/** The additional primes of a multi-prime modulus, zero if unused. */
+	bn_t r[RLC_RSA_PRIMES - 2];
+	/** The inverses of e modulo (r_i - 1). */
+	bn_t dr[RLC_RSA_PRIMES - 2];
+	/** The inverses of p * q * r_3 * ... * r_(i-1) modulo r_i. */
+	bn_t ri[RLC_RSA_PRIMES - 2];
 } relic_rsa_st;
 
 /**
@@ -116,6 +138,12 @@ typedef struct _bdpe_t {
 	bn_t y;
 	/** The divisor of (p-1) such that gcd(t, (p-1)/t) = gcd(t, q-1) = 1. */
 	dig_t t;
+	/** The element y^((p-1)(q-1)/t) of order t, used in decryption. */
+	bn_t g;
+	/** The tables of residues used in decryption, or NULL if not built. */
+	dig_t *tab;
+	/** The Montgomery context for the modulus n. */
+	bn_mon_t mn;
 } bdpe_st;
 
 /**
@@ -127,6 +155,49 @@ typedef bdpe_st bdpe_t[1];
 typedef bdpe_st *bdpe_t;
 #endif
 
+/**
+ * Represents a Paillier's Homomorphic Probabilistic Encryption key pair.
+ */
+typedef struct _phpe_t {
+	/** The modulus n = pq. */
+	bn_t n;
+	/** The square of the modulus. */
+	bn_t n2;
+	/** The first prime p. */
+	bn_t p;
+	/** The second prime q. */
+	bn_t q;
+	/** The square of the first prime. */
+	bn_t p2;
+	/** The square of the second prime. */
+	bn_t q2;
+	/** The inverse of L_p(g^(p-1) mod p^2) modulo p. */
+	bn_t hp;
+	/** The inverse of L_q(g^(q-1) mod q^2) modulo q. */
+	bn_t hq;
+	/** The inverse of q modulo p. */
+	bn_t qi;
+	/** The pool of precomputed randomizers r^n mod n^2, not thread-safe. */
+	uint8_t *pool;
+	/** The number of randomizers in the pool. */
+	int pool_len;
+	/** The Montgomery context for the square of the modulus. */
+	bn_mon_t mn2;
+	/** The Montgomery context for the square of the first prime. */
+	bn_mon_t mp2;
+	/** The Montgomery context for the square of the second prime. */
+	bn_mon_t mq2;
+} phpe_st;
+
+/**
+ * Pointer to a Paillier's Homomorphic Probabilistic Encryption key pair.
+ */
+#if ALLOC == AUTO
+typedef phpe_st phpe_t[1];
+#else
+typedef phpe_st *phpe_t;
+#endif
+
 /**
  * Represents a SOKAKA key pair.
  */
@@ -179,6 +250,42 @@ typedef bgn_st bgn_t[1];
 typedef bgn_st *bgn_t;
 #endif
 
+/**
+ * Represents a precomputed table for solving the discrete logarithms in
+ * Boneh-Goh-Nissim decryption with the baby-step giant-step method.
+ */
+typedef struct _bgn_tab_t {
+	/** The group of the ciphertexts, 1 for G_1, 2 for G_2 or 3 for G_T. */
+	int grp;
+	/** The number of baby steps. */
+	dig_t steps;
+	/** The number of giant steps. */
+	dig_t giants;
+	/** The hash table of baby steps with fingerprints and indices. */
+	uint64_t *tab;
+	/** The base in G_1. */
+	g1_t u1;
+	/** The giant step in G_1. */
+	g1_t v1;
+	/** The base in G_2. */
+	g2_t u2;
+	/** The giant step in G_2. */
+	g2_t v2;
+	/** The base in G_T. */
+	gt_t ut;
+	/** The giant step in G_T. */
+	gt_t vt;
+} bgn_tab_st;
+
+/**
+ * Pointer to a table for Boneh-Goh-Nissim decryption.
+ */
+#if ALLOC == AUTO
+typedef bgn_tab_st bgn_tab_t[1];
+#else
+typedef bgn_tab_st *bgn_tab_t;
+#endif
+
 /**
  * Represents a vBNN-IBS keg generation center.
  */
@@ -237,7 +344,7 @@ typedef vbnn_user_st *vbnn_user_t;
  */
 #if ALLOC == DYNAMIC
 #define rsa_new(A)															\
-	A = (rsa_t)calloc(1, sizeof(relic_rsa_st));									\
+	A = (rsa_t)calloc(1, sizeof(relic_rsa_st));								\
 	if (A == NULL) {														\
 		THROW(ERR_NO_MEMORY);												\
 	}																		\
@@ -257,6 +364,14 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
+	for (int _i = 0; _i < RLC_RSA_PRIMES - 2; _i++) {						\
+		bn_null((A)->r[_i]);												\
+		bn_null((A)->dr[_i]);												\
+		bn_null((A)->ri[_i]);												\
+		bn_new((A)->r[_i]);													\
+		bn_new((A)->dr[_i]);												\
+		bn_new((A)->ri[_i]);												\
+	}																		\
 
 #elif ALLOC == AUTO
 #define rsa_new(A)															\
@@ -268,10 +383,18 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
+	for (int _i = 0; _i < RLC_RSA_PRIMES - 2; _i++) {						\
+		bn_null((A)->r[_i]);												\
+		bn_null((A)->dr[_i]);												\
+		bn_null((A)->ri[_i]);												\
+		bn_new((A)->r[_i]);													\
+		bn_new((A)->dr[_i]);												\
+		bn_new((A)->ri[_i]);												\
+	}																		\
 
 #elif ALLOC == STACK
 #define rsa_new(A)															\
-	A = (rsa_t)alloca(sizeof(relic_rsa_st));										\
+	A = (rsa_t)alloca(sizeof(relic_rsa_st));								\
 	bn_new((A)->e);															\
 	bn_new((A)->n);															\
 	bn_new((A)->d);															\
@@ -280,6 +403,14 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
+	for (int _i = 0; _i < RLC_RSA_PRIMES - 2; _i++) {						\
+		bn_null((A)->r[_i]);												\
+		bn_null((A)->dr[_i]);												\
+		bn_null((A)->ri[_i]);												\
+		bn_new((A)->r[_i]);													\
+		bn_new((A)->dr[_i]);												\
+		bn_new((A)->ri[_i]);												\
+	}																		\
 
 #endif
 
@@ -299,6 +430,11 @@ typedef vbnn_user_st *vbnn_user_t;
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
 		bn_free((A)->qi);													\
+		for (int _i = 0; _i < RLC_RSA_PRIMES - 2; _i++) {					\
+			bn_free((A)->r[_i]);											\
+			bn_free((A)->dr[_i]);											\
+			bn_free((A)->ri[_i]);											\
+		}																	\
 		free(A);															\
 		A = NULL;															\
 	}
@@ -316,6 +452,11 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_free((A)->p);														\
 	bn_free((A)->q);														\
 	bn_free((A)->qi);														\
+	for (int _i = 0; _i < RLC_RSA_PRIMES - 2; _i++) {						\
+		bn_free((A)->r[_i]);												\
+		bn_free((A)->dr[_i]);												\
+		bn_free((A)->ri[_i]);												\
+	}																		\
 	A = NULL;																\
 
 #endif
@@ -424,7 +565,10 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_new((A)->y);															\
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
+	bn_new((A)->g);															\
+	bn_mon_new((A)->mn);													\
 	(A)->t = 0;																\
+	(A)->tab = NULL;														\
 
 #elif ALLOC == AUTO
 #define bdpe_new(A)															\
@@ -432,7 +576,10 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_new((A)->y);															\
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
+	bn_new((A)->g);															\
+	bn_mon_new((A)->mn);													\
 	(A)->t = 0;																\
+	(A)->tab = NULL;														\
 
 #elif ALLOC == STACK
 #define bdpe_new(A)															\
@@ -441,6 +588,9 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_new((A)->y);															\
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
+	bn_new((A)->g);															\
+	bn_mon_new((A)->mn);													\
+	(A)->tab = NULL;														\
 
 #endif
 
@@ -456,13 +606,18 @@ typedef vbnn_user_st *vbnn_user_t;
 		bn_free((A)->y);													\
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
+		bn_free((A)->g);													\
+		bn_mon_free((A)->mn);												\
+		free((A)->tab);														\
 		(A)->t = 0;															\
 		free(A);															\
 		A = NULL;															\
 	}
 
 #elif ALLOC == AUTO
-#define bdpe_free(A)			/* empty */
+#define bdpe_free(A)														\
+	free((A)->tab);															\
+	(A)->tab = NULL;														\
 
 #elif ALLOC == STACK
 #define bdpe_free(A)														\
@@ -470,11 +625,139 @@ typedef vbnn_user_st *vbnn_user_t;
 	bn_free((A)->y);														\
 	bn_free((A)->p);														\
 	bn_free((A)->q);														\
+	bn_free((A)->g);														\
+	bn_mon_free((A)->mn);													\
+	free((A)->tab);															\
 	(A)->t = 0;																\
 	A = NULL;																\
 
 #endif
 
+/**
+ * Initializes a Paillier's key pair with a null value.
+ *
+ * @param[out] A			- the key pair to initialize.
+ */
+#if ALLOC == AUTO
+#define phpe_null(A)			/* empty */
+#else
+#define phpe_null(A)			A = NULL;
+#endif
+
+/**
+ * Calls a function to allocate and initialize a Paillier's key pair.
+ *
+ * @param[out] A			- the new key pair.
+ */
+#if ALLOC == DYNAMIC
+#define phpe_new(A)															\
+	A = (phpe_t)calloc(1, sizeof(phpe_st));									\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_new((A)->n);															\
+	bn_new((A)->n2);														\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	bn_new((A)->p2);														\
+	bn_new((A)->q2);														\
+	bn_new((A)->hp);														\
+	bn_new((A)->hq);														\
+	bn_new((A)->qi);														\
+	bn_mon_new((A)->mn2);													\
+	bn_mon_new((A)->mp2);													\
+	bn_mon_new((A)->mq2);													\
+	(A)->pool = NULL;														\
+	(A)->pool_len = 0;														\
+
+#elif ALLOC == AUTO
+#define phpe_new(A)															\
+	bn_new((A)->n);															\
+	bn_new((A)->n2);														\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	bn_new((A)->p2);														\
+	bn_new((A)->q2);														\
+	bn_new((A)->hp);														\
+	bn_new((A)->hq);														\
+	bn_new((A)->qi);														\
+	bn_mon_new((A)->mn2);													\
+	bn_mon_new((A)->mp2);													\
+	bn_mon_new((A)->mq2);													\
+	(A)->pool = NULL;														\
+	(A)->pool_len = 0;														\
+
+#elif ALLOC == STACK
+#define phpe_new(A)															\
+	A = (phpe_t)alloca(sizeof(phpe_st));									\
+	bn_new((A)->n);															\
+	bn_new((A)->n2);														\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	bn_new((A)->p2);														\
+	bn_new((A)->q2);														\
+	bn_new((A)->hp);														\
+	bn_new((A)->hq);														\
+	bn_new((A)->qi);														\
+	bn_mon_new((A)->mn2);													\
+	bn_mon_new((A)->mp2);													\
+	bn_mon_new((A)->mq2);													\
+	(A)->pool = NULL;														\
+	(A)->pool_len = 0;														\
+
+#endif
+
+/**
+ * Calls a function to clean and free a Paillier's key pair, including its
+ * pool of randomizers.
+ *
+ * @param[out] A			- the key pair to clean and free.
+ */
+#if ALLOC == DYNAMIC
+#define phpe_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->n);													\
+		bn_free((A)->n2);													\
+		bn_free((A)->p);													\
+		bn_free((A)->q);													\
+		bn_free((A)->p2);													\
+		bn_free((A)->q2);													\
+		bn_free((A)->hp);													\
+		bn_free((A)->hq);													\
+		bn_free((A)->qi);													\
+		bn_mon_free((A)->mn2);												\
+		bn_mon_free((A)->mp2);												\
+		bn_mon_free((A)->mq2);												\
+		free((A)->pool);													\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define phpe_free(A)														\
+	free((A)->pool);														\
+	(A)->pool = NULL;														\
+	(A)->pool_len = 0;														\
+
+#elif ALLOC == STACK
+#define phpe_free(A)														\
+	bn_free((A)->n);														\
+	bn_free((A)->n2);														\
+	bn_free((A)->p);														\
+	bn_free((A)->q);														\
+	bn_free((A)->p2);														\
+	bn_free((A)->q2);														\
+	bn_free((A)->hp);														\
+	bn_free((A)->hq);														\
+	bn_free((A)->qi);														\
+	bn_mon_free((A)->mn2);													\
+	bn_mon_free((A)->mp2);													\
+	bn_mon_free((A)->mq2);													\
+	free((A)->pool);														\
+	A = NULL;																\
+
+#endif
+
 /**
  * Initializes a SOKAKA key pair with a null value.
  *
@@ -625,6 +908,89 @@ typedef vbnn_user_st *vbnn_user_t;
 
 #endif
 
+/**
+ * Initializes a BGN decryption table with a null value.
+ *
+ * @param[out] A			- the table to initialize.
+ */
+#if ALLOC == AUTO
+#define bgn_tab_null(A)			(A)->tab = NULL;
+#else
+#define bgn_tab_null(A)		A = NULL;
+#endif
+
+/**
+ * Calls a function to allocate and initialize a BGN decryption table.
+ *
+ * @param[out] A			- the new table.
+ */
+#if ALLOC == DYNAMIC
+#define bgn_tab_new(A)														\
+	A = (bgn_tab_t)calloc(1, sizeof(bgn_tab_st));							\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	g1_new((A)->u1);														\
+	g1_new((A)->v1);														\
+	g2_new((A)->u2);														\
+	g2_new((A)->v2);														\
+	gt_new((A)->ut);														\
+	gt_new((A)->vt);														\
+
+#elif ALLOC == AUTO
+#define bgn_tab_new(A)			/* empty */
+
+#elif ALLOC == STACK
+#define bgn_tab_new(A)														\
+	A = (bgn_tab_t)alloca(sizeof(bgn_tab_st));								\
+	(A)->tab = NULL;														\
+	g1_new((A)->u1);														\
+	g1_new((A)->v1);														\
+	g2_new((A)->u2);														\
+	g2_new((A)->v2);														\
+	gt_new((A)->ut);														\
+	gt_new((A)->vt);														\
+
+#endif
+
+/**
+ * Calls a function to clean and free a BGN decryption table, including the
+ * hash table allocated when the table is generated or read.
+ *
+ * @param[out] A			- the table to clean and free.
+ */
+#if ALLOC == DYNAMIC
+#define bgn_tab_free(A)														\
+	if (A != NULL) {														\
+		free((A)->tab);														\
+		g1_free((A)->u1);													\
+		g1_free((A)->v1);													\
+		g2_free((A)->u2);													\
+		g2_free((A)->v2);													\
+		gt_free((A)->ut);													\
+		gt_free((A)->vt);													\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define bgn_tab_free(A)														\
+	free((A)->tab);															\
+	(A)->tab = NULL;														\
+
+#elif ALLOC == STACK
+#define bgn_tab_free(A)														\
+	free((A)->tab);															\
+	g1_free((A)->u1);														\
+	g1_free((A)->v1);														\
+	g2_free((A)->u2);														\
+	g2_free((A)->v2);														\
+	gt_free((A)->ut);														\
+	gt_free((A)->vt);														\
+	A = NULL;																\
+
+#endif
+
 /**
  * Initialize a vBNN-IBS key generation center with a null value.
  *
@@ -826,6 +1192,19 @@ int cp_rsa_gen_basic(rsa_t pub, rsa_t prv, int bits);
  */
 int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits);
 
+/**
+ * Generates a key pair for multi-prime RSA with k primes of about bits / k
+ * bits each, so that the CRT methods exponentiate modulo smaller primes. The
+ * primes must have at least RLC_RSA_PRIME_MIN bits.
+ *
+ * @param[out] pub			- the public key.
+ * @param[out] prv			- the private key.
+ * @param[in] bits			- the key length in bits.
+ * @param[in] k				- the number of primes, from 2 to RLC_RSA_PRIMES.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_rsa_gen_multi(rsa_t pub, rsa_t prv, int bits, int k);
+
 /**
  * Encrypts using the RSA cryptosystem.
  *
@@ -852,7 +1231,8 @@ int cp_rsa_dec_basic(uint8_t *out, int *out_len, uint8_t *in, int in_len,
 		rsa_t prv);
 
 /**
- * Decrypts using the fast RSA decryption with CRT optimization.
+ * Decrypts using the fast RSA decryption with CRT optimization. Works with
+ * keys of two or more primes.
  *
  * @param[out] out			- the output buffer.
  * @param[in, out] out_len	- the buffer capacity and number of bytes written.
@@ -894,6 +1274,40 @@ int cp_rsa_sig_basic(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len,
 int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len,
 		int hash, rsa_t prv);
 
+/**
+ * Decrypts many ciphertexts with the same key using the CRT optimization. The
+ * ciphertexts are exponentiated modulo each prime in turn with one Montgomery
+ * context per prime, which saves little next to the exponentiations.
+ *
+ * @param[out] out			- the output buffers.
+ * @param[in, out] out_len	- the capacities and numbers of bytes written.
+ * @param[in] in			- the input buffers.
+ * @param[in] in_len		- the numbers of bytes to decrypt.
+ * @param[in] n				- the number of ciphertexts.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_rsa_dec_batch(uint8_t **out, int *out_len, uint8_t **in, int *in_len,
+		int n, rsa_t prv);
+
+/**
+ * Signs many messages with the same key using the CRT optimization. The
+ * messages are exponentiated modulo each prime in turn with one Montgomery
+ * context per prime, which saves little next to the exponentiations. The flag
+ * must be non-zero if the messages being signed are already hash values.
+ *
+ * @param[out] sig			- the signatures.
+ * @param[in, out] sig_len	- the capacities and numbers of bytes written.
+ * @param[in] msg			- the messages to sign.
+ * @param[in] msg_len		- the numbers of bytes to sign.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] n				- the number of messages.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_rsa_sig_batch(uint8_t **sig, int *sig_len, uint8_t **msg, int *msg_len,
+		int hash, int n, rsa_t prv);
+
 /**
  * Verifies an RSA signature. The flag must be non-zero if the message being
  * signed is already a hash value.
@@ -946,7 +1360,11 @@ int cp_rabin_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len,
 		rabin_t prv);
 
 /**
- * Generates a key pair for Benaloh's Dense Probabilistic Encryption.
+ * Generates a key pair for Benaloh's Dense Probabilistic Encryption. The
+ * block size may be composite, in which case decryption solves one discrete
+ * logarithm for each prime factor. It must be odd, because it cannot divide
+ * the even q - 1: even block sizes, including 2, make this function return
+ * RLC_ERR. The tables used in decryption are precomputed in the private key.
  *
  * @param[out] pub			- the public key.
  * @param[out] prv			- the private key.
@@ -968,7 +1386,8 @@ int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits);
 int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub);
 
 /**
- * Decrypts using Benaloh's cryptosystem.
+ * Decrypts using Benaloh's cryptosystem. The private key is not modified, and
+ * its tables must have been built by cp_bdpe_gen() or cp_bdpe_pre().
  *
  * @param[out] out			- the decrypted small integer.
  * @param[in] in			- the input buffer.
@@ -978,6 +1397,18 @@ int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub);
  */
 int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv);
 
+/**
+ * Precomputes the tables of residues used in Benaloh's decryption, mapping
+ * powers of an element of order l to their exponents for each prime factor l
+ * of the block size, and attaches a Montgomery context for the modulus to the
+ * key. Called by key generation, and must be called on private keys whose
+ * tables were not built, for instance after reading them back.
+ *
+ * @param[in,out] prv		- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bdpe_pre(bdpe_t prv);
+
 /**
  * Generates a key pair for Paillier's Homomorphic Probabilistic Encryption.
  *
@@ -1015,6 +1446,104 @@ int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n);
 int cp_phpe_dec(uint8_t *out, int out_len, uint8_t *in, int in_len, bn_t n,
 		bn_t l);
 
+/**
+ * Generates a key pair for Paillier's cryptosystem with g = n + 1, keeping the
+ * factorization and the constants needed for decryption with the CRT.
+ *
+ * @param[out] pub			- the public key.
+ * @param[out] prv			- the private key.
+ * @param[in] bits			- the key length in bits.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_gen_key(phpe_t pub, phpe_t prv, int bits);
+
+/**
+ * Precomputes randomizers r^n mod n^2 for later encryptions, filling the pool
+ * of a key until it holds a given number of them. Also attaches Montgomery
+ * contexts for the moduli held by the key if missing, so a key built by hand
+ * can be prepared with a pool length of zero. Like cp_phpe_enc_key(), this
+ * function is not thread-safe with respect to the key.
+ *
+ * @param[in,out] pub		- the public or private key.
+ * @param[in] len			- the number of randomizers to keep.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_pre(phpe_t pub, int len);
+
+/**
+ * Encrypts an integer using Paillier's cryptosystem, consuming a randomizer
+ * from the pool of the key if one is available. Taking a randomizer modifies
+ * the key without locking, so threads that encrypt concurrently must each use
+ * their own copy of the public key or synchronize the calls. A randomizer must
+ * never be used twice.
+ *
+ * @param[out] c			- the ciphertext.
+ * @param[in] m				- the plaintext in [0, n).
+ * @param[in,out] pub		- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_enc_key(bn_t c, const bn_t m, phpe_t pub);
+
+/**
+ * Decrypts a ciphertext using Paillier's cryptosystem and the CRT.
+ *
+ * @param[out] m			- the plaintext.
+ * @param[in] c				- the ciphertext.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_dec_key(bn_t m, const bn_t c, phpe_t prv);
+
+/**
+ * Homomorphically adds two Paillier ciphertexts.
+ *
+ * @param[out] c			- the ciphertext of the sum.
+ * @param[in] a				- the first ciphertext.
+ * @param[in] b				- the second ciphertext.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_add(bn_t c, const bn_t a, const bn_t b, phpe_t pub);
+
+/**
+ * Homomorphically multiplies a Paillier ciphertext by an integer.
+ *
+ * @param[out] c			- the ciphertext of the product.
+ * @param[in] a				- the ciphertext.
+ * @param[in] k				- the integer.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_mul(bn_t c, const bn_t a, const bn_t k, phpe_t pub);
+
+/**
+ * Homomorphically adds many pairs of Paillier ciphertexts. The products modulo
+ * n^2 share one Montgomery context, built once for the batch if the key has
+ * none, so each of them costs two Montgomery reductions instead of a division.
+ *
+ * @param[out] c			- the ciphertexts of the sums.
+ * @param[in] a				- the first ciphertexts.
+ * @param[in] b				- the second ciphertexts.
+ * @param[in] len			- the number of pairs.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_add_batch(bn_t *c, bn_t *a, bn_t *b, int len, phpe_t pub);
+
+/**
+ * Homomorphically multiplies many Paillier ciphertexts by integers. The
+ * exponentiations modulo n^2 share one Montgomery context, built once for the
+ * batch if the key has none.
+ *
+ * @param[out] c			- the ciphertexts of the products.
+ * @param[in] a				- the ciphertexts.
+ * @param[in] k				- the integers.
+ * @param[in] len			- the number of ciphertexts.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_mul_batch(bn_t *c, bn_t *a, bn_t *k, int len, phpe_t pub);
+
 /**
  * Generates an ECDH key pair.
  *
@@ -1134,6 +1663,27 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d);
  */
 int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q);
 
+/**
+ * Verifies a batch of messages signed with ECDSA. If the recovery bits are
+ * given, all signatures are checked with a single multi-scalar multiplication
+ * over random linear combinations, falling back to individual verification
+ * when the batch fails.
+ *
+ * @param[out] b			- the validity of each signature, can be NULL.
+ * @param[in] r				- the first components of the signatures.
+ * @param[in] s				- the second components of the signatures.
+ * @param[in] v				- the parity of the y-coordinates of the
+ * 							  commitments, can be NULL.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_ecdsa_ver_batch(int *b, bn_t *r, bn_t *s, int *v, uint8_t **msg,
+		int *len, int hash, ec_t *q, int n);
+
 /**
  * Generates an Elliptic Curve Schnorr Signature key pair.
  *
@@ -1168,6 +1718,27 @@ int cp_ecss_sig(bn_t e, bn_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q);
 
+/**
+ * Verifies a batch of messages signed with the Elliptic Curve Schnorr
+ * Signature. If the commitments are given, all signatures are checked with a
+ * single multi-scalar multiplication over random linear combinations, falling
+ * back to individual verification when the batch fails.
+ *
+ * @param[out] b			- the validity of each signature, can be NULL.
+ * @param[in] e				- the first components of the signatures.
+ * @param[in] s				- the second components of the signatures.
+ * @param[in] r				- the x-coordinates of the commitments, can be NULL.
+ * @param[in] v				- the parity of the y-coordinates of the
+ * 							  commitments, can be NULL.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_ecss_ver_batch(int *b, bn_t *e, bn_t *s, bn_t *r, int *v, uint8_t **msg,
+		int *len, ec_t *q, int n);
+
 /**
  * Generates a master key for the SOKAKA identity-based non-interactive
  * authenticated key agreement protocol.
@@ -1282,6 +1853,126 @@ int cp_bgn_mul(gt_t e[4], g1_t c[2], g2_t d[2]);
  */
 int cp_bgn_dec(dig_t *out, gt_t in[4], bgn_t prv);
 
+/**
+ * Precomputes a table to decrypt BGN ciphertexts in a group with the
+ * baby-step giant-step method. Plaintexts in [0, range) are recovered with at
+ * most range/steps giant steps, using memory proportional to steps.
+ *
+ * @param[out] tab			- the table.
+ * @param[in] grp			- the group of the ciphertexts, 1 for G_1, 2 for G_2
+ * 							  or 3 for G_T.
+ * @param[in] range			- the number of plaintexts that can be decrypted.
+ * @param[in] steps			- the number of baby steps, or 0 for sqrt(range),
+ * 							  at most 2^26.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_tab_gen(bgn_tab_t tab, int grp, dig_t range, dig_t steps,
+		bgn_t prv);
+
+/**
+ * Returns the number of bytes necessary to store a BGN decryption table.
+ *
+ * @param[in] tab			- the table.
+ * @return the number of bytes.
+ */
+int cp_bgn_tab_size(bgn_tab_t tab);
+
+/**
+ * Writes a BGN decryption table to a byte vector.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] tab			- the table.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_tab_write(uint8_t *bin, int len, bgn_tab_t tab);
+
+/**
+ * Reads a BGN decryption table from a byte vector.
+ *
+ * @param[out] tab			- the table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_tab_read(bgn_tab_t tab, const uint8_t *bin, int len);
+
+/**
+ * Decrypts in G_1 using the BGN cryptosystem and a precomputed table.
+ *
+ * @param[out] out 			- the decrypted small integer.
+ * @param[in] in 			- the ciphertext.
+ * @param[in] prv 			- the private key.
+ * @param[in] tab			- the table for G_1.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_dec1_tab(dig_t *out, g1_t in[2], bgn_t prv, bgn_tab_t tab);
+
+/**
+ * Decrypts in G_2 using the BGN cryptosystem and a precomputed table.
+ *
+ * @param[out] out 			- the decrypted small integer.
+ * @param[in] in 			- the ciphertext.
+ * @param[in] prv 			- the private key.
+ * @param[in] tab			- the table for G_2.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_dec2_tab(dig_t *out, g2_t in[2], bgn_t prv, bgn_tab_t tab);
+
+/**
+ * Decrypts in G_T using the BGN cryptosystem and a precomputed table.
+ *
+ * @param[out] out 			- the decrypted small integer.
+ * @param[in] in 			- the ciphertext.
+ * @param[in] prv 			- the private key.
+ * @param[in] tab			- the table for G_T.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_dec_tab(dig_t *out, gt_t in[4], bgn_t prv, bgn_tab_t tab);
+
+/**
+ * Decrypts many ciphertexts in G_1 using the BGN cryptosystem and a
+ * precomputed table, sharing the inversions of the giant-step search.
+ *
+ * @param[out] out 			- the decrypted small integers.
+ * @param[in] in 			- the ciphertexts.
+ * @param[in] n				- the number of ciphertexts.
+ * @param[in] prv 			- the private key.
+ * @param[in] tab			- the table for G_1.
+ * @return RLC_OK if all ciphertexts were decrypted, RLC_ERR otherwise.
+ */
+int cp_bgn_dec1_batch(dig_t *out, g1_t in[][2], int n, bgn_t prv,
+		bgn_tab_t tab);
+
+/**
+ * Decrypts many ciphertexts in G_2 using the BGN cryptosystem and a
+ * precomputed table, sharing the inversions of the giant-step search.
+ *
+ * @param[out] out 			- the decrypted small integers.
+ * @param[in] in 			- the ciphertexts.
+ * @param[in] n				- the number of ciphertexts.
+ * @param[in] prv 			- the private key.
+ * @param[in] tab			- the table for G_2.
+ * @return RLC_OK if all ciphertexts were decrypted, RLC_ERR otherwise.
+ */
+int cp_bgn_dec2_batch(dig_t *out, g2_t in[][2], int n, bgn_t prv,
+		bgn_tab_t tab);
+
+/**
+ * Decrypts many ciphertexts in G_T using the BGN cryptosystem and a
+ * precomputed table.
+ *
+ * @param[out] out 			- the decrypted small integers.
+ * @param[in] in 			- the ciphertexts.
+ * @param[in] n				- the number of ciphertexts.
+ * @param[in] prv 			- the private key.
+ * @param[in] tab			- the table for G_T.
+ * @return RLC_OK if all ciphertexts were decrypted, RLC_ERR otherwise.
+ */
+int cp_bgn_dec_batch(dig_t *out, gt_t in[][4], int n, bgn_t prv,
+		bgn_tab_t tab);
+
 /**
  * Generates a master key for a Private Key Generator (PKG) in the
  * Boneh-Franklin Identity-Based Encryption (BF-IBE).
@@ -1359,6 +2050,43 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q);
 
+/**
+ * Aggregates BLS signatures into a single signature. The aggregate verifies
+ * against the aggregate public key when all signers signed the same message.
+ *
+ * @param[out] s			- the aggregate signature.
+ * @param[in] sig			- the signatures to aggregate.
+ * @param[in] n				- the number of signatures.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bls_agg_sig(g1_t s, g1_t *sig, int n);
+
+/**
+ * Aggregates BLS public keys into a single public key.
+ *
+ * @param[out] q			- the aggregate public key.
+ * @param[in] key			- the public keys to aggregate.
+ * @param[in] n				- the number of public keys.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bls_agg_key(g2_t q, g2_t *key, int n);
+
+/**
+ * Verifies a batch of messages signed with the BLS protocol using small
+ * random exponents and a single multi-pairing. If the batch is rejected, the
+ * signatures are verified one by one to identify the invalid ones.
+ *
+ * @param[out] b			- the validity of each signature, or NULL.
+ * @param[in] s				- the signatures.
+ * @param[in] msg			- the signed messages.
+ * @param[in] len			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_bls_ver_batch(int *b, g1_t *s, uint8_t **msg, int *len, g2_t *q,
+		int n);
+
 /**
  * Generates a key pair for the Boneh-Boyen (BB) signature protocol.
  *
@@ -237,6 +237,18 @@ int dv_cmp(const dig_t *a, const dig_t *b, int size);
  */
 int dv_cmp_const(const dig_t *a, const dig_t *b, int size);
 
+/**
+ * Inverts a digit vector modulo an odd modulus in constant time using
+ * Bernstein-Yang division steps. Computes c = a^{-1} mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the digit vector to invert, smaller than m.
+ * @param[in] m				- the modulus, with a non-zero top digit.
+ * @param[in] digits		- the length in digits of the vectors.
+ * @return RLC_OK if a is invertible and RLC_ERR otherwise.
+ */
+int dv_inv_divst(dig_t *c, const dig_t *a, const dig_t *m, int digits);
+
 /**
  * Allocates and initializes a temporary double-precision digit vector.
  *
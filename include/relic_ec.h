@@ -393,6 +393,19 @@ typedef RLC_CAT(EC_LOWER, t) ec_t;
  */
 #define ec_mul_sim_gen(R, K, Q, L)	RLC_CAT(EC_LOWER, mul_sim_gen)(R, K, Q, L)
 
+/**
+ * Multiplies and adds many elliptic curve points simultaneously. Computes
+ * R = \sum k_iP_i. Only available for prime curves.
+ *
+ * @param[out] R				- the result.
+ * @param[in] P					- the points to multiply.
+ * @param[in] K					- the integer scalars.
+ * @param[in] N					- the number of points to multiply.
+ */
+#if EC_CUR == PRIME
+#define ec_mul_sim_lot(R, P, K, N)	ep_mul_sim_lot(R, P, K, N)
+#endif
+
 /**
  * Converts a point to affine coordinates.
  *
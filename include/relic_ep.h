@@ -373,6 +373,19 @@ typedef ep_st *ep_t;
 #define ep_mul_sim(R, P, K, Q, M)	ep_mul_sim_joint(R, P, K, Q, M)
 #endif
 
+/**
+ * Maps a byte array to a point in a prime elliptic curve.
+ *
+ * @param[out] P			- the result.
+ * @param[in] M				- the byte array to map.
+ * @param[in] L				- the array length in bytes.
+ */
+#if EP_MAP == BASIC
+#define ep_map(P, M, L)		ep_map_basic(P, M, L)
+#elif EP_MAP == SVDWM
+#define ep_map(P, M, L)		ep_map_svdwm(P, M, L)
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -406,6 +419,15 @@ dig_t *ep_curve_get_b(void);
  */
 dig_t *ep_curve_get_beta(void);
 
+/**
+ * Returns a constant of the Shallue-van de Woestijne map for the currently
+ * configured prime elliptic curve.
+ *
+ * @param[in] i				- the index of the constant, Z for 0 or c_i otherwise.
+ * @return the constant.
+ */
+dig_t *ep_curve_get_map(int i);
+
 /**
  * Returns the parameter V1 of the prime curve.
  */
@@ -671,6 +693,19 @@ int ep_size_bin(const ep_t a, int pack);
  */
 void ep_read_bin(ep_t a, const uint8_t *bin, int len);
 
+/**
+ * Reads several prime elliptic curve points from consecutive encodings of the
+ * same length and checks that they are on the curve.
+ *
+ * @param[out] a			- the results.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the length of each encoding.
+ * @param[in] n				- the number of points.
+ * @throw ERR_NO_VALID		- if an encoded point is invalid.
+ * @throw ERR_NO_BUFFER		- if the encoding length is invalid.
+ */
+void ep_read_bin_sim(ep_t *a, const uint8_t *bin, int len, int n);
+
 /**
  * Writes a prime elliptic curve point to a byte vector in big-endian format
  * with optional point compression.
@@ -1015,6 +1050,18 @@ void ep_mul_sim_joint(ep_t r, const ep_t p, const bn_t k, const ep_t q,
  */
 void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m);
 
+/**
+ * Multiplies prime elliptic curve points by integers and adds the results
+ * simultaneously using the bucket method of Pippenger. Computes
+ * R = \sum_i k[i] * P[i].
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integers.
+ * @param[in] n				- the number of points.
+ */
+void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n);
+
 /**
  * Converts a point to affine coordinates.
  *
@@ -1033,13 +1080,42 @@ void ep_norm(ep_t r, const ep_t p);
 void ep_norm_sim(ep_t *r, const ep_t *t, int n);
 
 /**
- * Maps a byte array to a point in a prime elliptic curve.
+ * Maps a byte array to a point in a prime elliptic curve using the
+ * try-and-increment method.
  *
  * @param[out] p			- the result.
  * @param[in] msg			- the byte array to map.
  * @param[in] len			- the array length in bytes.
  */
-void ep_map(ep_t p, const uint8_t *msg, int len);
+void ep_map_basic(ep_t p, const uint8_t *msg, int len);
+
+/**
+ * Maps a byte array to a point in a prime elliptic curve with the RFC 9380
+ * hash_to_curve encoding using the Shallue-van de Woestijne map, with the
+ * default domain separation tag of the library.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ */
+void ep_map_svdwm(ep_t p, const uint8_t *msg, int len);
+
+/**
+ * Maps a byte array to a point in a prime elliptic curve with the RFC 9380
+ * hash_to_curve encoding using the Shallue-van de Woestijne map. The message
+ * is expanded with expand_message_xmd and the given domain separation tag, and
+ * the map runs in a fixed sequence of field operations. The reduction of the
+ * expanded message, the point addition and the cofactor clearing still branch
+ * on data.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the tag length in bytes.
+ */
+void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst,
+		int dst_len);
 
 /**
  * Compresses a point.
@@ -1058,4 +1134,15 @@ void ep_pck(ep_t r, const ep_t p);
  */
 int ep_upk(ep_t r, const ep_t p);
 
+/**
+ * Decompresses a point given by its x-coordinate as an integer and the least
+ * significant bit of its y-coordinate, as recovered from signatures.
+ *
+ * @param[out] r			- the result.
+ * @param[in] x				- the x-coordinate.
+ * @param[in] y				- the least significant bit of the y-coordinate.
+ * @return a boolean value indicating if the decompression was successful.
+ */
+int ep_upk_x(ep_t r, const bn_t x, int y);
+
 #endif /* !RLC_EP_H */
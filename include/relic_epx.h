@@ -340,6 +340,19 @@ typedef ep3_st *ep3_t;
 #define ep2_mul_sim(R, P, K, Q, M)	ep2_mul_sim_joint(R, P, K, Q, M)
 #endif
 
+/**
+ * Maps a byte array to a point in an elliptic curve over a quadratic extension.
+ *
+ * @param[out] P			- the result.
+ * @param[in] M				- the byte array to map.
+ * @param[in] L				- the array length in bytes.
+ */
+#if EP_MAP == BASIC
+#define ep2_map(P, M, L)		ep2_map_basic(P, M, L)
+#elif EP_MAP == SVDWM
+#define ep2_map(P, M, L)		ep2_map_svdwm(P, M, L)
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -368,6 +381,15 @@ void ep2_curve_get_a(fp2_t a);
  */
 void ep2_curve_get_b(fp2_t b);
 
+/**
+ * Returns a constant of the Shallue-van de Woestijne map for the currently
+ * configured elliptic curve.
+ *
+ * @param[out] c			- the constant.
+ * @param[in] i				- the index of the constant, Z for 0 or c_i otherwise.
+ */
+void ep2_curve_get_map(fp2_t c, int i);
+
 /**
  * Returns the vector of coefficients required to perform GLV method.
  *
@@ -528,6 +550,20 @@ int ep2_size_bin(ep2_t a, int pack);
  */
 void ep2_read_bin(ep2_t a, const uint8_t *bin, int len);
 
+/**
+ * Reads several prime elliptic curve points over a quadratic extension from
+ * consecutive encodings of the same length and checks that they are on the
+ * curve.
+ *
+ * @param[out] a			- the results.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the length of each encoding.
+ * @param[in] n				- the number of points.
+ * @throw ERR_NO_VALID		- if an encoded point is invalid.
+ * @throw ERR_NO_BUFFER		- if the encoding length is invalid.
+ */
+void ep2_read_bin_sim(ep2_t *a, const uint8_t *bin, int len, int n);
+
 /**
  * Writes a prime elliptic curve pointer over a quadratic extension to a byte
  * vector in big-endian format with optional point compression.
@@ -865,6 +901,18 @@ void ep2_mul_sim_joint(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t m);
  */
 void ep2_mul_sim_gen(ep2_t r, bn_t k, ep2_t q, bn_t m);
 
+/**
+ * Multiplies points in an elliptic curve over a quadratic extension by
+ * integers and adds the results simultaneously using the bucket method of
+ * Pippenger. Computes R = \sum_i k[i] * P[i].
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integers.
+ * @param[in] n				- the number of points.
+ */
+void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies a prime elliptic point by a small integer.
  *
@@ -892,13 +940,42 @@ void ep2_norm(ep2_t r, ep2_t p);
 void ep2_norm_sim(ep2_t *r, ep2_t *t, int n);
 
 /**
- * Maps a byte array to a point in an elliptic curve over a quadratic extension.
+ * Maps a byte array to a point in an elliptic curve over a quadratic extension
+ * using the try-and-increment method.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ */
+void ep2_map_basic(ep2_t p, const uint8_t *msg, int len);
+
+/**
+ * Maps a byte array to a point in an elliptic curve over a quadratic extension
+ * with the RFC 9380 hash_to_curve encoding using the Shallue-van de Woestijne
+ * map, with the default domain separation tag of the library.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ */
+void ep2_map_svdwm(ep2_t p, const uint8_t *msg, int len);
+
+/**
+ * Maps a byte array to a point in an elliptic curve over a quadratic extension
+ * with the RFC 9380 hash_to_curve encoding using the Shallue-van de Woestijne
+ * map. The message is expanded with expand_message_xmd and the given domain
+ * separation tag, and the map runs in a fixed sequence of field operations.
+ * The reduction of the expanded message, the point addition and the cofactor
+ * clearing still branch on data.
  *
  * @param[out] p			- the result.
  * @param[in] msg			- the byte array to map.
  * @param[in] len			- the array length in bytes.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the tag length in bytes.
  */
-void ep2_map(ep2_t p, const uint8_t *msg, int len);
+void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst,
+		int dst_len);
 
 /**
  * Computes a power of the Gailbraith-Lin-Scott homomorphism of a point
@@ -914,6 +991,18 @@ void ep2_map(ep2_t p, const uint8_t *msg, int len);
  */
 void ep2_frb(ep2_t r, ep2_t p, int i);
 
+/**
+ * Decomposes an integer into four subscalars such that multiplying a point
+ * by the integer is the same as multiplying the powers of the
+ * Gailbraith-Lin-Scott homomorphism of the point by the subscalars, that is,
+ * kP = \sum_i k_i Psi^i(P). If the curve does not admit a decomposition, the
+ * integer is returned as the first subscalar.
+ *
+ * @param[out] ki			- the four subscalars.
+ * @param[in] k				- the integer to decompose.
+ */
+void ep2_frb_rec(bn_t *ki, const bn_t k);
+
 /**
  * Compresses a point in an elliptic curve over a quadratic extension.
  *
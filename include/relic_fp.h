@@ -341,6 +341,8 @@ typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)]
 #define fp_inv(C, A)	fp_inv_monty(C, A)
 #elif FP_INV == EXGCD
 #define fp_inv(C, A)	fp_inv_exgcd(C, A)
+#elif FP_INV == DIVST
+#define fp_inv(C, A)	fp_inv_divst(C, A)
 #elif FP_INV == LOWER
 #define fp_inv(C, A)	fp_inv_lower(C, A)
 #endif
@@ -984,6 +986,16 @@ void fp_inv_monty(fp_t c, const fp_t a);
  */
 void fp_inv_exgcd(fp_t c, const fp_t a);
 
+/**
+ * Inverts a prime field element in constant time using Bernstein-Yang
+ * division steps.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the prime field element to invert.
+ * @throw ERR_NO_VALID		- if the field element is not invertible.
+ */
+void fp_inv_divst(fp_t c, const fp_t a);
+
 /**
  * Inverts a prime field element using a direct call to the lower layer.
  *
@@ -1041,4 +1053,36 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
  */
 int fp_srt(fp_t c, const fp_t a);
 
+/**
+ * Extracts the square root of the quotient of two prime field elements without
+ * computing an inversion. Computes c = sqrt(a/b).
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the numerator.
+ * @param[in] b				- the denominator.
+ * @return					- 1 if there is a square root, 0 otherwise.
+ * @throw ERR_NO_VALID		- if the denominator is zero.
+ */
+int fp_srt_rat(fp_t c, const fp_t a, const fp_t b);
+
+/**
+ * Extracts the inverse of the square root of a prime field element. Computes
+ * c = 1/sqrt(a).
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the prime field element.
+ * @return					- 1 if there is a square root, 0 otherwise.
+ * @throw ERR_NO_VALID		- if the field element is zero.
+ */
+int fp_srt_inv(fp_t c, const fp_t a);
+
+/**
+ * Computes the Legendre symbol of a prime field element.
+ *
+ * @param[in] a				- the prime field element.
+ * @return					- 1 if the element is a non-zero square, -1 if it
+ * 							is a non-square and 0 if it is zero.
+ */
+int fp_smb(const fp_t a);
+
 #endif /* !RLC_FP_H */
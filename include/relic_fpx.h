@@ -1621,6 +1621,16 @@ void fp12_mul_dxs_basic(fp12_t c, fp12_t a, fp12_t b);
  */
 void fp12_mul_dxs_lazyr(fp12_t c, fp12_t a, fp12_t b);
 
+/**
+ * Multiplies two sparse dodecic extension field elements with the sparsity of
+ * line function evaluations. The result is not sparse.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the sparse dodecic extension field element.
+ * @param[in] b				- the sparse dodecic extension field element.
+ */
+void fp12_mul_sxs(fp12_t c, fp12_t a, fp12_t b);
+
 /**
  * Computes the square of a dodecic extension field element using basic
  * arithmetic.
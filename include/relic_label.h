@@ -53,11 +53,23 @@
 #undef core_clean
 #undef core_get
 #undef core_set
+#undef core_init_crv
+#undef core_clean_crv
+#undef core_get_crv
+#undef core_set_crv
+#undef core_own_crv
+#undef core_done_crv
 
 #define core_init 	PREFIX(core_init)
 #define core_clean 	PREFIX(core_clean)
 #define core_get 	PREFIX(core_get)
 #define core_set 	PREFIX(core_set)
+#define core_init_crv 	PREFIX(core_init_crv)
+#define core_clean_crv 	PREFIX(core_clean_crv)
+#define core_get_crv 	PREFIX(core_get_crv)
+#define core_set_crv 	PREFIX(core_set_crv)
+#define core_own_crv 	PREFIX(core_own_crv)
+#define core_done_crv 	PREFIX(core_done_crv)
 
 #undef arch_init
 #undef arch_clean
@@ -71,6 +83,7 @@
 
 #undef bench_overhead
 #undef bench_reset
+#undef bench_label
 #undef bench_before
 #undef bench_after
 #undef bench_compute
@@ -79,6 +92,7 @@
 
 #define bench_overhead 	PREFIX(bench_overhead)
 #define bench_reset 	PREFIX(bench_reset)
+#define bench_label 	PREFIX(bench_label)
 #define bench_before 	PREFIX(bench_before)
 #define bench_after 	PREFIX(bench_after)
 #define bench_compute 	PREFIX(bench_compute)
@@ -144,6 +158,7 @@
 #undef dv_swap_cond
 #undef dv_cmp
 #undef dv_cmp_const
+#undef dv_inv_divst
 #undef dv_new_dynam
 #undef dv_free_dynam
 
@@ -154,6 +169,7 @@
 #define dv_swap_cond 	PREFIX(dv_swap_cond)
 #define dv_cmp 	PREFIX(dv_cmp)
 #define dv_cmp_const 	PREFIX(dv_cmp_const)
+#define dv_inv_divst 	PREFIX(dv_inv_divst)
 #define dv_new_dynam 	PREFIX(dv_new_dynam)
 #define dv_free_dynam 	PREFIX(dv_free_dynam)
 
@@ -205,6 +221,9 @@
 #undef bn_mul_basic
 #undef bn_mul_comba
 #undef bn_mul_karat
+#undef bn_mul_toom3
+#undef bn_mul_ntt
+#undef bn_mul_dyn
 #undef bn_sqr_basic
 #undef bn_sqr_comba
 #undef bn_sqr_karat
@@ -228,10 +247,22 @@
 #undef bn_mod_monty_comba
 #undef bn_mod_pre_pmers
 #undef bn_mod_pmers
+#undef bn_mod_inv
+#undef bn_mon_set
+#undef bn_mon_is
+#undef bn_mon_conv
+#undef bn_mon_back
+#undef bn_mul_mon
+#undef bn_sqr_mon
 #undef bn_mxp_basic
 #undef bn_mxp_slide
 #undef bn_mxp_monty
 #undef bn_mxp_dig
+#undef bn_mxp_pre
+#undef bn_mxp_fix
+#undef bn_mxp_sim
+#undef bn_mxp_mon
+#undef bn_mxp_ctx
 #undef bn_srt
 #undef bn_gcd_basic
 #undef bn_gcd_lehme
@@ -253,6 +284,7 @@
 #undef bn_gen_prime_basic
 #undef bn_gen_prime_safep
 #undef bn_gen_prime_stron
+#undef bn_gen_prime_par
 #undef bn_factor
 #undef bn_is_factor
 #undef bn_rec_win
@@ -264,6 +296,7 @@
 #undef bn_rec_tnaf_mod
 #undef bn_rec_reg
 #undef bn_rec_jsf
+#undef bn_rec_sdw
 #undef bn_rec_glv
 
 #define bn_init 	PREFIX(bn_init)
@@ -307,6 +340,9 @@
 #define bn_mul_basic 	PREFIX(bn_mul_basic)
 #define bn_mul_comba 	PREFIX(bn_mul_comba)
 #define bn_mul_karat 	PREFIX(bn_mul_karat)
+#define bn_mul_toom3 	PREFIX(bn_mul_toom3)
+#define bn_mul_ntt 	PREFIX(bn_mul_ntt)
+#define bn_mul_dyn 	PREFIX(bn_mul_dyn)
 #define bn_sqr_basic 	PREFIX(bn_sqr_basic)
 #define bn_sqr_comba 	PREFIX(bn_sqr_comba)
 #define bn_sqr_karat 	PREFIX(bn_sqr_karat)
@@ -330,10 +366,22 @@
 #define bn_mod_monty_comba 	PREFIX(bn_mod_monty_comba)
 #define bn_mod_pre_pmers 	PREFIX(bn_mod_pre_pmers)
 #define bn_mod_pmers 	PREFIX(bn_mod_pmers)
+#define bn_mod_inv 	PREFIX(bn_mod_inv)
+#define bn_mon_set 	PREFIX(bn_mon_set)
+#define bn_mon_is 	PREFIX(bn_mon_is)
+#define bn_mon_conv 	PREFIX(bn_mon_conv)
+#define bn_mon_back 	PREFIX(bn_mon_back)
+#define bn_mul_mon 	PREFIX(bn_mul_mon)
+#define bn_sqr_mon 	PREFIX(bn_sqr_mon)
 #define bn_mxp_basic 	PREFIX(bn_mxp_basic)
 #define bn_mxp_slide 	PREFIX(bn_mxp_slide)
 #define bn_mxp_monty 	PREFIX(bn_mxp_monty)
 #define bn_mxp_dig 	PREFIX(bn_mxp_dig)
+#define bn_mxp_pre 	PREFIX(bn_mxp_pre)
+#define bn_mxp_fix 	PREFIX(bn_mxp_fix)
+#define bn_mxp_sim 	PREFIX(bn_mxp_sim)
+#define bn_mxp_mon 	PREFIX(bn_mxp_mon)
+#define bn_mxp_ctx 	PREFIX(bn_mxp_ctx)
 #define bn_srt 	PREFIX(bn_srt)
 #define bn_gcd_basic 	PREFIX(bn_gcd_basic)
 #define bn_gcd_lehme 	PREFIX(bn_gcd_lehme)
@@ -355,6 +403,7 @@
 #define bn_gen_prime_basic 	PREFIX(bn_gen_prime_basic)
 #define bn_gen_prime_safep 	PREFIX(bn_gen_prime_safep)
 #define bn_gen_prime_stron 	PREFIX(bn_gen_prime_stron)
+#define bn_gen_prime_par 	PREFIX(bn_gen_prime_par)
 #define bn_factor 	PREFIX(bn_factor)
 #define bn_is_factor 	PREFIX(bn_is_factor)
 #define bn_rec_win 	PREFIX(bn_rec_win)
@@ -366,6 +415,7 @@
 #define bn_rec_tnaf_mod 	PREFIX(bn_rec_tnaf_mod)
 #define bn_rec_reg 	PREFIX(bn_rec_reg)
 #define bn_rec_jsf 	PREFIX(bn_rec_jsf)
+#define bn_rec_sdw 	PREFIX(bn_rec_sdw)
 #define bn_rec_glv 	PREFIX(bn_rec_glv)
 
 #undef bn_add1_low
@@ -490,12 +540,16 @@
 #undef fp_inv_binar
 #undef fp_inv_monty
 #undef fp_inv_exgcd
+#undef fp_inv_divst
 #undef fp_inv_lower
 #undef fp_inv_sim
 #undef fp_exp_basic
 #undef fp_exp_slide
 #undef fp_exp_monty
 #undef fp_srt
+#undef fp_srt_rat
+#undef fp_srt_inv
+#undef fp_smb
 
 #define fp_prime_init 	PREFIX(fp_prime_init)
 #define fp_prime_clean 	PREFIX(fp_prime_clean)
@@ -570,12 +624,16 @@
 #define fp_inv_binar 	PREFIX(fp_inv_binar)
 #define fp_inv_monty 	PREFIX(fp_inv_monty)
 #define fp_inv_exgcd 	PREFIX(fp_inv_exgcd)
+#define fp_inv_divst 	PREFIX(fp_inv_divst)
 #define fp_inv_lower 	PREFIX(fp_inv_lower)
 #define fp_inv_sim 	PREFIX(fp_inv_sim)
 #define fp_exp_basic 	PREFIX(fp_exp_basic)
 #define fp_exp_slide 	PREFIX(fp_exp_slide)
 #define fp_exp_monty 	PREFIX(fp_exp_monty)
 #define fp_srt 	PREFIX(fp_srt)
+#define fp_srt_rat 	PREFIX(fp_srt_rat)
+#define fp_srt_inv 	PREFIX(fp_srt_inv)
+#define fp_smb 	PREFIX(fp_smb)
 
 #undef fp_add1_low
 #undef fp_addn_low
@@ -846,6 +904,7 @@
 #undef ep_curve_get_a
 #undef ep_curve_get_b
 #undef ep_curve_get_beta
+#undef ep_curve_get_map
 #undef ep_curve_get_v1
 #undef ep_curve_get_v2
 #undef ep_curve_opt_a
@@ -880,6 +939,7 @@
 #undef ep_print
 #undef ep_size_bin
 #undef ep_read_bin
+#undef ep_read_bin_sim
 #undef ep_write_bin
 #undef ep_neg_basic
 #undef ep_neg_projc
@@ -915,17 +975,22 @@
 #undef ep_mul_sim_inter
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_gen
+#undef ep_mul_sim_lot
 #undef ep_norm
 #undef ep_norm_sim
-#undef ep_map
+#undef ep_map_basic
+#undef ep_map_svdwm
+#undef ep_map_dst
 #undef ep_pck
 #undef ep_upk
+#undef ep_upk_x
 
 #define ep_curve_init 	PREFIX(ep_curve_init)
 #define ep_curve_clean 	PREFIX(ep_curve_clean)
 #define ep_curve_get_a 	PREFIX(ep_curve_get_a)
 #define ep_curve_get_b 	PREFIX(ep_curve_get_b)
 #define ep_curve_get_beta 	PREFIX(ep_curve_get_beta)
+#define ep_curve_get_map 	PREFIX(ep_curve_get_map)
 #define ep_curve_get_v1 	PREFIX(ep_curve_get_v1)
 #define ep_curve_get_v2 	PREFIX(ep_curve_get_v2)
 #define ep_curve_opt_a 	PREFIX(ep_curve_opt_a)
@@ -960,6 +1025,7 @@
 #define ep_print 	PREFIX(ep_print)
 #define ep_size_bin 	PREFIX(ep_size_bin)
 #define ep_read_bin 	PREFIX(ep_read_bin)
+#define ep_read_bin_sim 	PREFIX(ep_read_bin_sim)
 #define ep_write_bin 	PREFIX(ep_write_bin)
 #define ep_neg_basic 	PREFIX(ep_neg_basic)
 #define ep_neg_projc 	PREFIX(ep_neg_projc)
@@ -995,11 +1061,15 @@
 #define ep_mul_sim_inter 	PREFIX(ep_mul_sim_inter)
 #define ep_mul_sim_joint 	PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_gen 	PREFIX(ep_mul_sim_gen)
+#define ep_mul_sim_lot 	PREFIX(ep_mul_sim_lot)
 #define ep_norm 	PREFIX(ep_norm)
 #define ep_norm_sim 	PREFIX(ep_norm_sim)
-#define ep_map 	PREFIX(ep_map)
+#define ep_map_basic 	PREFIX(ep_map_basic)
+#define ep_map_svdwm 	PREFIX(ep_map_svdwm)
+#define ep_map_dst 	PREFIX(ep_map_dst)
 #define ep_pck 	PREFIX(ep_pck)
 #define ep_upk 	PREFIX(ep_upk)
+#define ep_upk_x 	PREFIX(ep_upk_x)
 
 #undef ed_st
 #undef ed_t
@@ -1300,6 +1370,7 @@
 #undef ep2_curve_clean
 #undef ep2_curve_get_a
 #undef ep2_curve_get_b
+#undef ep2_curve_get_map
 #undef ep2_curve_get_vs
 #undef ep2_curve_opt_a
 #undef ep2_curve_is_twist
@@ -1320,6 +1391,7 @@
 #undef ep2_print
 #undef ep2_size_bin
 #undef ep2_read_bin
+#undef ep2_read_bin_sim
 #undef ep2_write_bin
 #undef ep2_neg_basic
 #undef ep2_neg_projc
@@ -1354,11 +1426,15 @@
 #undef ep2_mul_sim_inter
 #undef ep2_mul_sim_joint
 #undef ep2_mul_sim_gen
+#undef ep2_mul_sim_lot
 #undef ep2_mul_dig
 #undef ep2_norm
 #undef ep2_norm_sim
-#undef ep2_map
+#undef ep2_map_basic
+#undef ep2_map_svdwm
+#undef ep2_map_dst
 #undef ep2_frb
+#undef ep2_frb_rec
 #undef ep2_pck
 #undef ep2_upk
 
@@ -1366,6 +1442,7 @@
 #define ep2_curve_clean 	PREFIX(ep2_curve_clean)
 #define ep2_curve_get_a 	PREFIX(ep2_curve_get_a)
 #define ep2_curve_get_b 	PREFIX(ep2_curve_get_b)
+#define ep2_curve_get_map 	PREFIX(ep2_curve_get_map)
 #define ep2_curve_get_vs 	PREFIX(ep2_curve_get_vs)
 #define ep2_curve_opt_a 	PREFIX(ep2_curve_opt_a)
 #define ep2_curve_is_twist 	PREFIX(ep2_curve_is_twist)
@@ -1386,6 +1463,7 @@
 #define ep2_print 	PREFIX(ep2_print)
 #define ep2_size_bin 	PREFIX(ep2_size_bin)
 #define ep2_read_bin 	PREFIX(ep2_read_bin)
+#define ep2_read_bin_sim 	PREFIX(ep2_read_bin_sim)
 #define ep2_write_bin 	PREFIX(ep2_write_bin)
 #define ep2_neg_basic 	PREFIX(ep2_neg_basic)
 #define ep2_neg_projc 	PREFIX(ep2_neg_projc)
@@ -1420,11 +1498,15 @@
 #define ep2_mul_sim_inter 	PREFIX(ep2_mul_sim_inter)
 #define ep2_mul_sim_joint 	PREFIX(ep2_mul_sim_joint)
 #define ep2_mul_sim_gen 	PREFIX(ep2_mul_sim_gen)
+#define ep2_mul_sim_lot 	PREFIX(ep2_mul_sim_lot)
 #define ep2_mul_dig 	PREFIX(ep2_mul_dig)
 #define ep2_norm 	PREFIX(ep2_norm)
 #define ep2_norm_sim 	PREFIX(ep2_norm_sim)
-#define ep2_map 	PREFIX(ep2_map)
+#define ep2_map_basic 	PREFIX(ep2_map_basic)
+#define ep2_map_svdwm 	PREFIX(ep2_map_svdwm)
+#define ep2_map_dst 	PREFIX(ep2_map_dst)
 #define ep2_frb 	PREFIX(ep2_frb)
+#define ep2_frb_rec 	PREFIX(ep2_frb_rec)
 #define ep2_pck 	PREFIX(ep2_pck)
 #define ep2_upk 	PREFIX(ep2_upk)
 
@@ -1719,6 +1801,7 @@
 #undef fp12_mul_lazyr
 #undef fp12_mul_dxs_basic
 #undef fp12_mul_dxs_lazyr
+#undef fp12_mul_sxs
 #undef fp12_sqr_basic
 #undef fp12_sqr_lazyr
 #undef fp12_sqr_cyc_basic
@@ -1758,6 +1841,7 @@
 #define fp12_mul_lazyr 	PREFIX(fp12_mul_lazyr)
 #define fp12_mul_dxs_basic 	PREFIX(fp12_mul_dxs_basic)
 #define fp12_mul_dxs_lazyr 	PREFIX(fp12_mul_dxs_lazyr)
+#define fp12_mul_sxs 	PREFIX(fp12_mul_sxs)
 #define fp12_sqr_basic 	PREFIX(fp12_sqr_basic)
 #define fp12_sqr_lazyr 	PREFIX(fp12_sqr_lazyr)
 #define fp12_sqr_cyc_basic 	PREFIX(fp12_sqr_cyc_basic)
@@ -1884,6 +1968,10 @@
 #undef pp_map_sim_weilp_k12
 #undef pp_map_oatep_k12
 #undef pp_map_sim_oatep_k12
+#undef pp_map_sim_lot_oatep_k12
+#undef pp_map_pre_k12
+#undef pp_map_fix_oatep_k12
+#undef pp_map_sim_fix_oatep_k12
 
 #define pp_map_init 	PREFIX(pp_map_init)
 #define pp_map_clean 	PREFIX(pp_map_clean)
@@ -1915,6 +2003,16 @@
 #define pp_map_sim_weilp_k12 	PREFIX(pp_map_sim_weilp_k12)
 #define pp_map_oatep_k12 	PREFIX(pp_map_oatep_k12)
 #define pp_map_sim_oatep_k12 	PREFIX(pp_map_sim_oatep_k12)
+#define pp_map_sim_lot_oatep_k12 	PREFIX(pp_map_sim_lot_oatep_k12)
+#define pp_map_pre_k12 	PREFIX(pp_map_pre_k12)
+#define pp_map_fix_oatep_k12 	PREFIX(pp_map_fix_oatep_k12)
+#define pp_map_sim_fix_oatep_k12 	PREFIX(pp_map_sim_fix_oatep_k12)
+
+#undef g1_read_bin_sim
+#undef g2_read_bin_sim
+
+#define g1_read_bin_sim 	PREFIX(g1_read_bin_sim)
+#define g2_read_bin_sim 	PREFIX(g2_read_bin_sim)
 
 #undef rsa_t
 #undef rabin_t
@@ -1927,11 +2025,14 @@
 
 #undef cp_rsa_gen_basic
 #undef cp_rsa_gen_quick
+#undef cp_rsa_gen_multi
 #undef cp_rsa_enc
 #undef cp_rsa_dec_basic
 #undef cp_rsa_dec_quick
 #undef cp_rsa_sig_basic
 #undef cp_rsa_sig_quick
+#undef cp_rsa_dec_batch
+#undef cp_rsa_sig_batch
 #undef cp_rsa_ver
 #undef cp_rabin_gen
 #undef cp_rabin_enc
@@ -1939,9 +2040,18 @@
 #undef cp_bdpe_gen
 #undef cp_bdpe_enc
 #undef cp_bdpe_dec
+#undef cp_bdpe_pre
 #undef cp_phpe_gen
 #undef cp_phpe_enc
 #undef cp_phpe_dec
+#undef cp_phpe_gen_key
+#undef cp_phpe_pre
+#undef cp_phpe_enc_key
+#undef cp_phpe_dec_key
+#undef cp_phpe_add
+#undef cp_phpe_mul
+#undef cp_phpe_add_batch
+#undef cp_phpe_mul_batch
 #undef cp_ecdh_gen
 #undef cp_ecdh_key
 #undef cp_ecmqv_gen
@@ -1952,9 +2062,11 @@
 #undef cp_ecdsa_gen
 #undef cp_ecdsa_sig
 #undef cp_ecdsa_ver
+#undef cp_ecdsa_ver_batch
 #undef cp_ecss_gen
 #undef cp_ecss_sig
 #undef cp_ecss_ver
+#undef cp_ecss_ver_batch
 #undef cp_sokaka_gen
 #undef cp_sokaka_gen_prv
 #undef cp_sokaka_key
@@ -1966,6 +2078,16 @@
 #undef cp_bgn_add
 #undef cp_bgn_mul
 #undef cp_bgn_dec
+#undef cp_bgn_tab_gen
+#undef cp_bgn_tab_size
+#undef cp_bgn_tab_write
+#undef cp_bgn_tab_read
+#undef cp_bgn_dec1_tab
+#undef cp_bgn_dec2_tab
+#undef cp_bgn_dec_tab
+#undef cp_bgn_dec1_batch
+#undef cp_bgn_dec2_batch
+#undef cp_bgn_dec_batch
 #undef cp_ibe_gen
 #undef cp_ibe_gen_prv
 #undef cp_ibe_enc
@@ -1973,6 +2095,9 @@
 #undef cp_bls_gen
 #undef cp_bls_sig
 #undef cp_bls_ver
+#undef cp_bls_agg_sig
+#undef cp_bls_agg_key
+#undef cp_bls_ver_batch
 #undef cp_bbs_gen
 #undef cp_bbs_sig
 #undef cp_bbs_ver
@@ -2001,11 +2126,14 @@
 
 #define cp_rsa_gen_basic 	PREFIX(cp_rsa_gen_basic)
 #define cp_rsa_gen_quick 	PREFIX(cp_rsa_gen_quick)
+#define cp_rsa_gen_multi 	PREFIX(cp_rsa_gen_multi)
 #define cp_rsa_enc 	PREFIX(cp_rsa_enc)
 #define cp_rsa_dec_basic 	PREFIX(cp_rsa_dec_basic)
 #define cp_rsa_dec_quick 	PREFIX(cp_rsa_dec_quick)
 #define cp_rsa_sig_basic 	PREFIX(cp_rsa_sig_basic)
 #define cp_rsa_sig_quick 	PREFIX(cp_rsa_sig_quick)
+#define cp_rsa_dec_batch 	PREFIX(cp_rsa_dec_batch)
+#define cp_rsa_sig_batch 	PREFIX(cp_rsa_sig_batch)
 #define cp_rsa_ver 	PREFIX(cp_rsa_ver)
 #define cp_rabin_gen 	PREFIX(cp_rabin_gen)
 #define cp_rabin_enc 	PREFIX(cp_rabin_enc)
@@ -2013,9 +2141,18 @@
 #define cp_bdpe_gen 	PREFIX(cp_bdpe_gen)
 #define cp_bdpe_enc 	PREFIX(cp_bdpe_enc)
 #define cp_bdpe_dec 	PREFIX(cp_bdpe_dec)
+#define cp_bdpe_pre 	PREFIX(cp_bdpe_pre)
 #define cp_phpe_gen 	PREFIX(cp_phpe_gen)
 #define cp_phpe_enc 	PREFIX(cp_phpe_enc)
 #define cp_phpe_dec 	PREFIX(cp_phpe_dec)
+#define cp_phpe_gen_key 	PREFIX(cp_phpe_gen_key)
+#define cp_phpe_pre 	PREFIX(cp_phpe_pre)
+#define cp_phpe_enc_key 	PREFIX(cp_phpe_enc_key)
+#define cp_phpe_dec_key 	PREFIX(cp_phpe_dec_key)
+#define cp_phpe_add 	PREFIX(cp_phpe_add)
+#define cp_phpe_mul 	PREFIX(cp_phpe_mul)
+#define cp_phpe_add_batch 	PREFIX(cp_phpe_add_batch)
+#define cp_phpe_mul_batch 	PREFIX(cp_phpe_mul_batch)
 #define cp_ecdh_gen 	PREFIX(cp_ecdh_gen)
 #define cp_ecdh_key 	PREFIX(cp_ecdh_key)
 #define cp_ecmqv_gen 	PREFIX(cp_ecmqv_gen)
@@ -2026,9 +2163,11 @@
 #define cp_ecdsa_gen 	PREFIX(cp_ecdsa_gen)
 #define cp_ecdsa_sig 	PREFIX(cp_ecdsa_sig)
 #define cp_ecdsa_ver 	PREFIX(cp_ecdsa_ver)
+#define cp_ecdsa_ver_batch 	PREFIX(cp_ecdsa_ver_batch)
 #define cp_ecss_gen 	PREFIX(cp_ecss_gen)
 #define cp_ecss_sig 	PREFIX(cp_ecss_sig)
 #define cp_ecss_ver 	PREFIX(cp_ecss_ver)
+#define cp_ecss_ver_batch 	PREFIX(cp_ecss_ver_batch)
 #define cp_sokaka_gen 	PREFIX(cp_sokaka_gen)
 #define cp_sokaka_gen_prv 	PREFIX(cp_sokaka_gen_prv)
 #define cp_sokaka_key 	PREFIX(cp_sokaka_key)
@@ -2040,6 +2179,16 @@
 #define cp_bgn_add 	PREFIX(cp_bgn_add)
 #define cp_bgn_mul 	PREFIX(cp_bgn_mul)
 #define cp_bgn_dec 	PREFIX(cp_bgn_dec)
+#define cp_bgn_tab_gen 	PREFIX(cp_bgn_tab_gen)
+#define cp_bgn_tab_size 	PREFIX(cp_bgn_tab_size)
+#define cp_bgn_tab_write 	PREFIX(cp_bgn_tab_write)
+#define cp_bgn_tab_read 	PREFIX(cp_bgn_tab_read)
+#define cp_bgn_dec1_tab 	PREFIX(cp_bgn_dec1_tab)
+#define cp_bgn_dec2_tab 	PREFIX(cp_bgn_dec2_tab)
+#define cp_bgn_dec_tab 	PREFIX(cp_bgn_dec_tab)
+#define cp_bgn_dec1_batch 	PREFIX(cp_bgn_dec1_batch)
+#define cp_bgn_dec2_batch 	PREFIX(cp_bgn_dec2_batch)
+#define cp_bgn_dec_batch 	PREFIX(cp_bgn_dec_batch)
 #define cp_ibe_gen 	PREFIX(cp_ibe_gen)
 #define cp_ibe_gen_prv 	PREFIX(cp_ibe_gen_prv)
 #define cp_ibe_enc 	PREFIX(cp_ibe_enc)
@@ -2047,6 +2196,9 @@
 #define cp_bls_gen 	PREFIX(cp_bls_gen)
 #define cp_bls_sig 	PREFIX(cp_bls_sig)
 #define cp_bls_ver 	PREFIX(cp_bls_ver)
+#define cp_bls_agg_sig 	PREFIX(cp_bls_agg_sig)
+#define cp_bls_agg_key 	PREFIX(cp_bls_agg_key)
+#define cp_bls_ver_batch 	PREFIX(cp_bls_ver_batch)
 #define cp_bbs_gen 	PREFIX(cp_bbs_gen)
 #define cp_bbs_sig 	PREFIX(cp_bbs_sig)
 #define cp_bbs_ver 	PREFIX(cp_bbs_ver)
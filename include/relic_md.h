@@ -216,6 +216,21 @@ void md_kdf2(uint8_t *key, int key_len, const uint8_t *in, int in_len);
  */
 void md_mgf1(uint8_t *mask, int mask_len, const uint8_t *in, int in_len);
 
+/**
+ * Expands a message into a uniformly random byte string with the
+ * expand_message_xmd function of RFC 9380.
+ *
+ * @param[out] buf				- the resulting byte string.
+ * @param[in] buf_len			- the intended length in bytes, at most 65535.
+ * @param[in] in				- the message.
+ * @param[in] in_len			- the length of the message in bytes.
+ * @param[in] dst				- the domain separation tag.
+ * @param[in] dst_len			- the length of the tag in bytes, at most 255.
+ * @throw ERR_NO_VALID			- if a length is out of range.
+ */
+void md_xmd(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
+		const uint8_t *dst, int dst_len);
+
 /**
  * Computes a Message Authentication Code through HMAC.
  *
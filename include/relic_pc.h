@@ -601,6 +601,24 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  */
 #define g2_norm(R, P)		RLC_CAT(G2_LOWER, norm)(R, P)
 
+/**
+ * Normalizes multiple elements of G_1 simultaneously.
+ *
+ * @param[out] R			- the results.
+ * @param[in] P				- the elements to normalize.
+ * @param[in] N				- the number of elements.
+ */
+#define g1_norm_sim(R, P, N)	RLC_CAT(G1_LOWER, norm_sim)(R, P, N)
+
+/**
+ * Normalizes multiple elements of G_2 simultaneously.
+ *
+ * @param[out] R			- the results.
+ * @param[in] P				- the elements to normalize.
+ * @param[in] N				- the number of elements.
+ */
+#define g2_norm_sim(R, P, N)	RLC_CAT(G2_LOWER, norm_sim)(R, P, N)
+
 /**
  * Multiplies an element from G_1 by an integer. Computes R = kP.
  *
@@ -733,6 +751,28 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  */
 #define g2_mul_sim_gen(R, K, Q, L)	RLC_CAT(G2_LOWER, mul_sim_gen)(R, K, Q, L)
 
+/**
+ * Multiplies simultaneously many elements from G_1. Computes
+ * R = \sum_i K[i] * P[i].
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the G_1 elements to multiply.
+ * @param[in] K				- the integer scalars.
+ * @param[in] N				- the number of elements.
+ */
+#define g1_mul_sim_lot(R, P, K, N)	RLC_CAT(G1_LOWER, mul_sim_lot)(R, P, K, N)
+
+/**
+ * Multiplies simultaneously many elements from G_2. Computes
+ * R = \sum_i K[i] * P[i].
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the G_2 elements to multiply.
+ * @param[in] K				- the integer scalars.
+ * @param[in] N				- the number of elements.
+ */
+#define g2_mul_sim_lot(R, P, K, N)	RLC_CAT(G2_LOWER, mul_sim_lot)(R, P, K, N)
+
 /**
  * Maps a byte array to an element in G_1.
  *
@@ -775,9 +815,24 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  * @param[in] M 			- the number of pairing arguments.
  */
 #if FP_PRIME < 1536
-#define pc_map_sim(R, P, Q, M);	RLC_CAT(PC_LOWER, map_sim_k12)(R, P, Q, M)
+#define pc_map_sim(R, P, Q, M)		RLC_CAT(PC_LOWER, map_sim_k12)(R, P, Q, M)
+#else
+#define pc_map_sim(R, P, Q, M)		RLC_CAT(PC_LOWER, map_sim_k2)(R, P, Q, M)
+#endif
+
+/**
+ * Computes the multi-pairing of many G_1 elements and G_2 elements. Computes
+ * R = \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the second pairing arguments.
+ * @param[in] M 			- the number of pairing arguments.
+ */
+#if FP_PRIME < 1536
+#define pc_map_sim_lot(R, P, Q, M)	RLC_CAT(PC_LOWER, map_sim_lot_k12)(R, P, Q, M)
 #else
-#define pc_map_sim(R, P, Q, M);	RLC_CAT(PC_LOWER, map_sim_k2)(R, P, Q, M)
+#define pc_map_sim_lot(R, P, Q, M)	RLC_CAT(PC_LOWER, map_sim_k2)(R, P, Q, M)
 #endif
 
 /**
@@ -840,4 +895,34 @@ int g2_is_valid(g2_t a);
  */
 int gt_is_valid(gt_t a);
 
+/**
+ * Reads several G_1 elements from consecutive encodings of the same length
+ * and checks that they are valid. Subgroup membership is tested on random
+ * linear combinations of the elements, and on each element only if that
+ * test fails.
+ *
+ * @param[out] a			- the results.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the length of each encoding.
+ * @param[in] n				- the number of elements.
+ * @throw ERR_NO_VALID		- if an element is invalid.
+ * @throw ERR_NO_BUFFER		- if the encoding length is invalid.
+ */
+void g1_read_bin_sim(g1_t *a, const uint8_t *bin, int len, int n);
+
+/**
+ * Reads several G_2 elements from consecutive encodings of the same length
+ * and checks that they are valid. Subgroup membership is tested on random
+ * linear combinations of the elements, and on each element only if that
+ * test fails.
+ *
+ * @param[out] a			- the results.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the length of each encoding.
+ * @param[in] n				- the number of elements.
+ * @throw ERR_NO_VALID		- if an element is invalid.
+ * @throw ERR_NO_BUFFER		- if the encoding length is invalid.
+ */
+void g2_read_bin_sim(g2_t *a, const uint8_t *bin, int len, int n);
+
 #endif /* !RLC_PC_H */
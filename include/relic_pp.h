@@ -41,6 +41,16 @@
 #include "relic_epx.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Size of a precomputation table of line functions for fixed-argument
+ * pairings, enough for loop parameters of up to half the field size.
+ */
+#define RLC_PP_TABLE		(RLC_FP_BITS / 2 + 2)
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -234,6 +244,21 @@
 #define pp_map_sim_k12(R, P, Q, M)		pp_map_sim_oatep_k12(R, P, Q, M)
 #endif
 
+/**
+ * Computes a multi-pairing of many arguments in a parameterized elliptic curve
+ * with embedding degree 12. Computes R = \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the second pairing arguments.
+ * @param[in] M 			- the number of pairings to evaluate.
+ */
+#if PP_MAP == OATEP
+#define pp_map_sim_lot_k12(R, P, Q, M)	pp_map_sim_lot_oatep_k12(R, P, Q, M)
+#else
+#define pp_map_sim_lot_k12(R, P, Q, M)	pp_map_sim_k12(R, P, Q, M)
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -455,8 +480,8 @@ void pp_norm_k12(ep2_t c, ep2_t a);
  * with embedding degree 12.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first elliptic curve point.
- * @param[in] p				- the second elliptic curve point.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the second elliptic curve point.
  */
 void pp_map_tatep_k2(fp2_t r, ep_t p, ep_t q);
 
@@ -465,8 +490,8 @@ void pp_map_tatep_k2(fp2_t r, ep_t p, ep_t q);
  * embedding degree 2.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first pairing arguments.
- * @param[in] p				- the second pairing arguments.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
  * @param[in] m 			- the number of pairings to evaluate.
  */
 void pp_map_sim_tatep_k2(fp2_t r, ep_t *p, ep_t *q, int m);
@@ -476,8 +501,8 @@ void pp_map_sim_tatep_k2(fp2_t r, ep_t *p, ep_t *q, int m);
  * with embedding degree 2.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first elliptic curve point.
- * @param[in] p				- the second elliptic curve point.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the second elliptic curve point.
  */
 void pp_map_weilp_k2(fp2_t r, ep_t p, ep_t q);
 
@@ -486,8 +511,8 @@ void pp_map_weilp_k2(fp2_t r, ep_t p, ep_t q);
  * embedding degree 2.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first pairing arguments.
- * @param[in] p				- the second pairing arguments.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
  * @param[in] m 			- the number of pairings to evaluate.
  */
 void pp_map_sim_weilp_k2(fp2_t r, ep_t *p, ep_t *q, int m);
@@ -497,8 +522,8 @@ void pp_map_sim_weilp_k2(fp2_t r, ep_t *p, ep_t *q, int m);
  * with embedding degree 12.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first elliptic curve point.
- * @param[in] p				- the second elliptic curve point.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the second elliptic curve point.
  */
 void pp_map_tatep_k12(fp12_t r, ep_t p, ep2_t q);
 
@@ -507,8 +532,8 @@ void pp_map_tatep_k12(fp12_t r, ep_t p, ep2_t q);
  * embedding degree 12.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first pairing arguments.
- * @param[in] p				- the second pairing arguments.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
  * @param[in] m 			- the number of pairings to evaluate.
  */
 void pp_map_sim_tatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
@@ -518,8 +543,8 @@ void pp_map_sim_tatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
  * with embedding degree 12.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first elliptic curve point.
- * @param[in] p				- the second elliptic curve point.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the second elliptic curve point.
  */
 void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q);
 
@@ -528,8 +553,8 @@ void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q);
  * embedding degree 12.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first pairing arguments.
- * @param[in] p				- the second pairing arguments.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
  * @param[in] m 			- the number of pairings to evaluate.
  */
 void pp_map_sim_weilp_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
@@ -539,8 +564,8 @@ void pp_map_sim_weilp_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
  * curve with embedding degree 12.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first elliptic curve point.
- * @param[in] p				- the second elliptic curve point.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] q				- the second elliptic curve point.
  */
 void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q);
 
@@ -549,10 +574,56 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q);
  * curve with embedding degree 12.
  *
  * @param[out] r			- the result.
- * @param[in] q				- the first pairing arguments.
- * @param[in] p				- the second pairing arguments.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
  * @param[in] m 			- the number of pairings to evaluate.
  */
 void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
 
+/**
+ * Computes the optimal ate multi-pairing of many arguments in a parameterized
+ * elliptic curve with embedding degree 12. Points are normalized together and
+ * the line functions of pairs of arguments are multiplied before accumulation,
+ * which pays off for large numbers of pairings.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_lot_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Precomputes the line functions of the optimal ate pairing for a fixed
+ * second argument in a parameterized elliptic curve with embedding degree 12.
+ * Each line is stored as its three non-zero coefficients in a sextic element.
+ *
+ * @param[out] t			- the precomputation table with RLC_PP_TABLE entries.
+ * @param[in] q				- the second pairing argument.
+ */
+void pp_map_pre_k12(fp6_t *t, ep2_t q);
+
+/**
+ * Computes the optimal ate pairing of two points in a parameterized elliptic
+ * curve with embedding degree 12, with the second point given by its
+ * precomputation table.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] t				- the precomputation table of the second point.
+ */
+void pp_map_fix_oatep_k12(fp12_t r, ep_t p, fp6_t *t);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 12, with the second arguments given by their
+ * precomputation tables.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] t				- the precomputation tables of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_fix_oatep_k12(fp12_t r, ep_t *p, fp6_t *t[], int m);
+
 #endif /* !RLC_PP_H */
@@ -160,7 +160,7 @@ void bn_div_dig(bn_t c, const bn_t a, dig_t b) {
 	}
 
 	TRY {
-		bn_new(q);
+		bn_new_size(q, a->used);
 		int size = a->used;
 		const dig_t *ap = a->dp;
 
@@ -202,7 +202,7 @@ void bn_div_rem_dig(bn_t c, dig_t *d, const bn_t a, dig_t b) {
 	}
 
 	TRY {
-		bn_new(q);
+		bn_new_size(q, a->used);
 		int size = a->used;
 		const dig_t *ap = a->dp;
 
@@ -0,0 +1,81 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the constant-time multiple precision modular inversion,
+ * built on the division steps of dv_inv_divst().
+ *
+ * @ingroup bn
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void bn_mod_inv(bn_t c, const bn_t a, const bn_t m) {
+	int i;
+	bn_t u;
+
+	bn_null(u);
+
+	if (bn_sign(m) == RLC_NEG || bn_is_even(m) || bn_cmp_dig(m, 1) == RLC_EQ) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	TRY {
+		bn_new_size(u, m->used);
+
+		if (bn_sign(a) == RLC_NEG || bn_cmp(a, m) != RLC_LT) {
+			bn_mod(u, a, m);
+			if (bn_sign(u) == RLC_NEG) {
+				bn_add(u, u, m);
+			}
+		} else {
+			bn_copy(u, a);
+		}
+		for (i = u->used; i < m->used; i++) {
+			u->dp[i] = 0;
+		}
+
+		bn_grow(c, m->used);
+		if (dv_inv_divst(u->dp, u->dp, m->dp, m->used) != RLC_OK) {
+			THROW(ERR_NO_VALID);
+		} else {
+			dv_copy(c->dp, u->dp, m->used);
+			c->used = m->used;
+			c->sign = RLC_POS;
+			bn_trim(c);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(u);
+	}
+}
@@ -338,3 +338,48 @@ void bn_mod_pmers(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 }
 
 #endif /* BN_MOD == PMERS || !defined(STRIP) */
+
+void bn_mon_set(bn_mon_t mon, const bn_t m) {
+	if (bn_is_even(m) || bn_sign(m) == RLC_NEG) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_copy(mon->m, m);
+	bn_mod_pre_monty(mon->u, m);
+	bn_set_2b(mon->one, m->used * RLC_DIG);
+	bn_mod(mon->one, mon->one, m);
+	bn_sqr(mon->r2, mon->one);
+	bn_mod(mon->r2, mon->r2, m);
+}
+
+int bn_mon_is(const bn_mon_t mon, const bn_t m) {
+	return !bn_is_zero(mon->m) && bn_cmp(mon->m, m) == RLC_EQ;
+}
+
+void bn_mon_conv(bn_t c, const bn_t a, const bn_mon_t mon) {
+	if (bn_sign(a) == RLC_NEG || bn_cmp(a, mon->m) != RLC_LT) {
+		bn_mod(c, a, mon->m);
+		if (bn_sign(c) == RLC_NEG) {
+			bn_add(c, c, mon->m);
+		}
+		bn_mul(c, c, mon->r2);
+	} else {
+		bn_mul(c, a, mon->r2);
+	}
+	bn_mod_monty(c, c, mon->m, mon->u);
+}
+
+void bn_mon_back(bn_t c, const bn_t a, const bn_mon_t mon) {
+	bn_mod_monty(c, a, mon->m, mon->u);
+}
+
+void bn_mul_mon(bn_t c, const bn_t a, const bn_t b, const bn_mon_t mon) {
+	bn_mul(c, a, b);
+	bn_mod_monty(c, c, mon->m, mon->u);
+}
+
+void bn_sqr_mon(bn_t c, const bn_t a, const bn_mon_t mon) {
+	bn_sqr(c, a);
+	bn_mod_monty(c, c, mon->m, mon->u);
+}
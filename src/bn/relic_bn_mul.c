@@ -170,6 +170,206 @@ static void bn_mul_karat_imp(bn_t c, const bn_t a, const bn_t b, int level) {
 
 #endif
 
+/**
+ * Number of digits from which bn_mul_dyn switches from Comba to Karatsuba.
+ * The crossover points were measured with the multiplication sweep of
+ * bench_bn on x86-64, where Comba stays ahead up to about 4096 bits.
+ */
+#define RLC_KARAT_CUT		(4096 / RLC_DIG)
+
+/**
+ * Number of digits from which bn_mul_dyn switches from Karatsuba to Toom-3.
+ */
+#define RLC_TOOM_CUT		(16384 / RLC_DIG)
+
+/**
+ * Number of digits from which bn_mul_dyn switches from Toom-3 to the
+ * number-theoretic transform.
+ */
+#define RLC_NTT_CUT			(262144 / RLC_DIG)
+
+/**
+ * The prime 2^64 - 2^32 + 1 used as modulus of the number-theoretic transform.
+ */
+#define RLC_NTT_P			((uint64_t)0xFFFFFFFF00000001ULL)
+
+/**
+ * Number of bits in each coefficient of the number-theoretic transform, small
+ * enough for convolutions of up to 2^31 coefficients not to wrap modulo the
+ * prime.
+ */
+#define RLC_NTT_BITS		16
+
+/**
+ * Copies a range of digits of a multiple precision integer, ignoring the sign.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer.
+ * @param[in] i				- the first digit to copy.
+ * @param[in] n				- the number of digits to copy.
+ */
+static void bn_mul_get(bn_t c, const bn_t a, int i, int n) {
+	n = RLC_MAX(RLC_MIN(n, a->used - i), 0);
+	bn_grow(c, RLC_MAX(n, 1));
+	for (int j = 0; j < n; j++) {
+		c->dp[j] = a->dp[i + j];
+	}
+	c->used = n;
+	c->sign = RLC_POS;
+	bn_trim(c);
+}
+
+/**
+ * Computes one step of Karatsuba multiplication on operands of similar size,
+ * multiplying the halves with bn_mul_dyn.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer.
+ * @param[in] b				- the second multiple precision integer.
+ */
+static void bn_mul_kstep(bn_t c, const bn_t a, const bn_t b) {
+	int h = (RLC_MAX(a->used, b->used) + 1) >> 1;
+	bn_t a0, a1, b0, b1, t;
+
+	bn_null(a0);
+	bn_null(a1);
+	bn_null(b0);
+	bn_null(b1);
+	bn_null(t);
+
+	TRY {
+		bn_new_size(a0, h + 1);
+		bn_new_size(a1, h + 1);
+		bn_new_size(b0, h + 1);
+		bn_new_size(b1, h + 1);
+		bn_new_size(t, a->used + b->used);
+
+		bn_mul_get(a0, a, 0, h);
+		bn_mul_get(a1, a, h, h);
+		bn_mul_get(b0, b, 0, h);
+		bn_mul_get(b1, b, h, h);
+
+		/* c = a1b1 * x^2 + ((a0 + a1)(b0 + b1) - a0b0 - a1b1) * x + a0b0. */
+		bn_mul_dyn(c, a0, b0);
+		bn_mul_dyn(t, a1, b1);
+		bn_add(a0, a0, a1);
+		bn_add(b0, b0, b1);
+		bn_mul_dyn(a1, a0, b0);
+		bn_sub(a1, a1, c);
+		bn_sub(a1, a1, t);
+		bn_lsh(t, t, 2 * h * RLC_DIG);
+		bn_lsh(a1, a1, h * RLC_DIG);
+		bn_add(c, c, a1);
+		bn_add(c, c, t);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(a0);
+		bn_free(a1);
+		bn_free(b0);
+		bn_free(b1);
+		bn_free(t);
+	}
+}
+
+/**
+ * Multiplies two integers modulo the prime of the number-theoretic transform.
+ *
+ * @param[in] a				- the first integer.
+ * @param[in] b				- the second integer.
+ * @return the product modulo the prime.
+ */
+static uint64_t bn_ntt_mul(uint64_t a, uint64_t b) {
+	uint64_t lo, hi, t0, t1;
+#if WSIZE == 64
+	dbl_t t = (dbl_t)a * b;
+
+	lo = (uint64_t)t;
+	hi = (uint64_t)(t >> 64);
+#else
+	uint64_t p00, p01, p10, mid;
+
+	p00 = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+	p01 = (a & 0xFFFFFFFF) * (b >> 32);
+	p10 = (a >> 32) * (b & 0xFFFFFFFF);
+	mid = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+	lo = (mid << 32) | (p00 & 0xFFFFFFFF);
+	hi = (a >> 32) * (b >> 32) + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+
+	/* Reduce using 2^64 = 2^32 - 1 and 2^96 = -1 modulo the prime, with masks
+	 * instead of branches since the conditions are unpredictable. */
+	t0 = lo - (hi >> 32);
+	t0 -= 0xFFFFFFFF & -(uint64_t)(lo < (hi >> 32));
+	t1 = (hi & 0xFFFFFFFF) * 0xFFFFFFFF;
+	lo = t0 + t1;
+	lo += 0xFFFFFFFF & -(uint64_t)(lo < t1);
+	lo -= RLC_NTT_P & -(uint64_t)(lo >= RLC_NTT_P);
+	return lo;
+}
+
+/**
+ * Computes an in-place number-theoretic transform of power-of-two length.
+ *
+ * @param[in,out] x			- the coefficients.
+ * @param[in] w				- the first n/2 powers of a root of unity of order n.
+ * @param[in] n				- the length of the transform.
+ */
+static void bn_ntt(uint64_t *x, const uint64_t *w, size_t n) {
+	size_t i, j, k, l;
+	uint64_t t, u, v;
+
+	/* Reorder the coefficients by bit reversal of their indices. */
+	for (i = 1, j = 0; i < n; i++) {
+		for (k = n >> 1; j & k; k >>= 1) {
+			j ^= k;
+		}
+		j ^= k;
+		if (i < j) {
+			u = x[i];
+			x[i] = x[j];
+			x[j] = u;
+		}
+	}
+
+	for (l = 2; l <= n; l <<= 1) {
+		for (i = 0; i < n; i += l) {
+			for (j = 0; j < l / 2; j++) {
+				u = x[i + j];
+				v = bn_ntt_mul(x[i + j + l / 2], w[j * (n / l)]);
+				t = u + v;
+				x[i + j] = t - (RLC_NTT_P & -(uint64_t)(t < u || t >= RLC_NTT_P));
+				x[i + j + l / 2] = u - v + (RLC_NTT_P & -(uint64_t)(u < v));
+			}
+		}
+	}
+}
+
+/**
+ * Splits the absolute value of a multiple precision integer into coefficients
+ * of RLC_NTT_BITS bits.
+ *
+ * @param[out] x			- the coefficients.
+ * @param[in] n				- the number of coefficients to fill.
+ * @param[in] a				- the multiple precision integer.
+ */
+static void bn_ntt_get(uint64_t *x, size_t n, const bn_t a) {
+	size_t i, j, bits = (size_t)a->used * RLC_DIG;
+
+	for (i = 0; i < n; i++) {
+		x[i] = 0;
+		for (j = 0; j < RLC_NTT_BITS; j += RLC_MIN(RLC_DIG, RLC_NTT_BITS)) {
+			size_t k = i * RLC_NTT_BITS + j;
+			if (k < bits) {
+				x[i] |= (uint64_t)((a->dp[k / RLC_DIG] >> (k % RLC_DIG)) &
+						RLC_MASK(RLC_MIN(RLC_DIG, RLC_NTT_BITS))) << j;
+			}
+		}
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -265,3 +465,260 @@ void bn_mul_karat(bn_t c, const bn_t a, const bn_t b) {
 }
 
 #endif
+
+void bn_mul_toom3(bn_t c, const bn_t a, const bn_t b) {
+	int k = (RLC_MAX(a->used, b->used) + 2) / 3;
+	bn_t a0, a1, a2, b0, b1, b2, r1, rm1, rm2, t;
+
+	bn_null(a0);
+	bn_null(a1);
+	bn_null(a2);
+	bn_null(b0);
+	bn_null(b1);
+	bn_null(b2);
+	bn_null(r1);
+	bn_null(rm1);
+	bn_null(rm2);
+	bn_null(t);
+
+	TRY {
+		bn_new_size(a0, k + 2);
+		bn_new_size(a1, k + 2);
+		bn_new_size(a2, k + 2);
+		bn_new_size(b0, k + 2);
+		bn_new_size(b1, k + 2);
+		bn_new_size(b2, k + 2);
+		bn_new_size(r1, 2 * k + 4);
+		bn_new_size(rm1, 2 * k + 4);
+		bn_new_size(rm2, 2 * k + 4);
+		bn_new_size(t, a->used + b->used);
+
+		bn_mul_get(a0, a, 0, k);
+		bn_mul_get(a1, a, k, k);
+		bn_mul_get(a2, a, 2 * k, k);
+		bn_mul_get(b0, b, 0, k);
+		bn_mul_get(b1, b, k, k);
+		bn_mul_get(b2, b, 2 * k, k);
+
+		/* Evaluate at 1, -1 and -2, reusing a1 and b1 for the last ones. */
+		bn_add(t, a0, a2);
+		bn_add(rm2, t, a1);
+		bn_sub(a1, t, a1);
+		bn_add(t, b0, b2);
+		bn_add(r1, t, b1);
+		bn_sub(b1, t, b1);
+		bn_mul_dyn(r1, rm2, r1);
+		bn_mul_dyn(rm1, a1, b1);
+		bn_add(a1, a1, a2);
+		bn_dbl(a1, a1);
+		bn_sub(a1, a1, a0);
+		bn_add(b1, b1, b2);
+		bn_dbl(b1, b1);
+		bn_sub(b1, b1, b0);
+		bn_mul_dyn(rm2, a1, b1);
+		/* Evaluate at 0 and infinity. */
+		bn_mul_dyn(a0, a0, b0);
+		bn_mul_dyn(a2, a2, b2);
+
+		/* Interpolate with Bodrato's sequence, where a0 = r(0), a2 = r(inf). */
+		bn_sub(rm2, rm2, r1);
+		bn_div_dig(rm2, rm2, 3);
+		bn_sub(r1, r1, rm1);
+		bn_hlv(r1, r1);
+		bn_sub(rm1, rm1, a0);
+		bn_sub(rm2, rm1, rm2);
+		bn_hlv(rm2, rm2);
+		bn_dbl(t, a2);
+		bn_add(rm2, rm2, t);
+		bn_add(rm1, rm1, r1);
+		bn_sub(rm1, rm1, a2);
+		bn_sub(r1, r1, rm2);
+
+		/* Recompose c = a2 x^4 + rm2 x^3 + rm1 x^2 + r1 x + a0. */
+		bn_lsh(t, a2, k * RLC_DIG);
+		bn_add(t, t, rm2);
+		bn_lsh(t, t, k * RLC_DIG);
+		bn_add(t, t, rm1);
+		bn_lsh(t, t, k * RLC_DIG);
+		bn_add(t, t, r1);
+		bn_lsh(t, t, k * RLC_DIG);
+		bn_add(t, t, a0);
+
+		if (!bn_is_zero(t)) {
+			t->sign = a->sign ^ b->sign;
+		}
+		bn_copy(c, t);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(a0);
+		bn_free(a1);
+		bn_free(a2);
+		bn_free(b0);
+		bn_free(b1);
+		bn_free(b2);
+		bn_free(r1);
+		bn_free(rm1);
+		bn_free(rm2);
+		bn_free(t);
+	}
+}
+
+void bn_mul_ntt(bn_t c, const bn_t a, const bn_t b) {
+	size_t i, j, k, n, na, nb;
+	uint64_t *x = NULL, *y = NULL, *w = NULL, r, acc;
+	bn_t t;
+
+	bn_null(t);
+
+	na = RLC_CEIL((size_t)a->used * RLC_DIG, RLC_NTT_BITS);
+	nb = RLC_CEIL((size_t)b->used * RLC_DIG, RLC_NTT_BITS);
+	n = 2;
+	while (n < na + nb) {
+		n <<= 1;
+	}
+
+	TRY {
+		bn_new_size(t, a->used + b->used);
+		x = (uint64_t *)malloc(n * sizeof(uint64_t));
+		y = (uint64_t *)malloc(n * sizeof(uint64_t));
+		w = (uint64_t *)malloc((n / 2) * sizeof(uint64_t));
+		if (x == NULL || y == NULL || w == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+
+		/* Compute the powers of a root of unity of order n, from 7^(p-1)/n. */
+		r = 7;
+		acc = 1;
+		for (k = (RLC_NTT_P - 1) / n; k > 0; k >>= 1) {
+			if (k & 1) {
+				acc = bn_ntt_mul(acc, r);
+			}
+			r = bn_ntt_mul(r, r);
+		}
+		w[0] = 1;
+		for (i = 1; i < n / 2; i++) {
+			w[i] = bn_ntt_mul(w[i - 1], acc);
+		}
+
+		bn_ntt_get(x, n, a);
+		bn_ntt(x, w, n);
+		if (a == b) {
+			for (i = 0; i < n; i++) {
+				x[i] = bn_ntt_mul(x[i], x[i]);
+			}
+		} else {
+			bn_ntt_get(y, n, b);
+			bn_ntt(y, w, n);
+			for (i = 0; i < n; i++) {
+				x[i] = bn_ntt_mul(x[i], y[i]);
+			}
+		}
+
+		/* Invert the transform by reversing x[1..n-1] and scaling by 1/n. */
+		bn_ntt(x, w, n);
+		for (i = 1, j = n - 1; i < j; i++, j--) {
+			r = x[i];
+			x[i] = x[j];
+			x[j] = r;
+		}
+		r = RLC_NTT_P - (RLC_NTT_P - 1) / n;
+
+		/* Propagate the carries of the convolution into the digits. */
+		bn_grow(t, a->used + b->used);
+		for (i = 0; i < (size_t)(a->used + b->used); i++) {
+			t->dp[i] = 0;
+		}
+		acc = 0;
+		for (i = 0; i < n && i * RLC_NTT_BITS < (size_t)(a->used + b->used) *
+				RLC_DIG; i++) {
+			acc += bn_ntt_mul(x[i], r);
+			for (j = 0; j < RLC_NTT_BITS; j += RLC_MIN(RLC_DIG, RLC_NTT_BITS)) {
+				k = i * RLC_NTT_BITS + j;
+				t->dp[k / RLC_DIG] |= (dig_t)(acc &
+						RLC_MASK(RLC_MIN(RLC_DIG, RLC_NTT_BITS))) << (k % RLC_DIG);
+				acc >>= RLC_MIN(RLC_DIG, RLC_NTT_BITS);
+			}
+		}
+		t->used = a->used + b->used;
+		t->sign = a->sign ^ b->sign;
+		bn_trim(t);
+		bn_copy(c, t);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		free(x);
+		free(y);
+		free(w);
+		bn_free(t);
+	}
+}
+
+void bn_mul_dyn(bn_t c, const bn_t a, const bn_t b) {
+	int i, n = b->used, sign = a->sign ^ b->sign;
+	bn_t t, u, v;
+
+	if (a->used < b->used) {
+		bn_mul_dyn(c, b, a);
+		return;
+	}
+
+	if (n < RLC_KARAT_CUT) {
+#if BN_MUL == BASIC
+		bn_mul_basic(c, a, b);
+#else
+		bn_mul_comba(c, a, b);
+#endif
+		return;
+	}
+
+	if (a->used < 2 * n) {
+		if (n < RLC_TOOM_CUT) {
+			bn_mul_kstep(c, a, b);
+		} else if (n < RLC_NTT_CUT) {
+			bn_mul_toom3(c, a, b);
+		} else {
+			bn_mul_ntt(c, a, b);
+		}
+		if (!bn_is_zero(c)) {
+			c->sign = sign;
+		}
+		return;
+	}
+
+	bn_null(t);
+	bn_null(u);
+	bn_null(v);
+
+	TRY {
+		bn_new_size(t, a->used + b->used);
+		bn_new_size(u, n);
+		bn_new_size(v, 2 * n + 1);
+
+		/* Multiply unbalanced operands in pieces of the size of the smaller. */
+		bn_zero(t);
+		for (i = 0; i < a->used; i += n) {
+			bn_mul_get(u, a, i, n);
+			bn_mul_dyn(v, u, b);
+			v->sign = RLC_POS;
+			bn_lsh(v, v, i * RLC_DIG);
+			bn_add(t, t, v);
+		}
+		if (!bn_is_zero(t)) {
+			t->sign = sign;
+		}
+		bn_copy(c, t);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(u);
+		bn_free(v);
+	}
+}
@@ -40,6 +40,35 @@
  */
 #define RLC_TABLE_SIZE			64
 
+/**
+ * Fills a table with the products of all subsets of up to BN_DEPTH integers,
+ * such that t[j] is the product of the g[i] for which bit i of j is set.
+ *
+ * @param[out] t			- the table.
+ * @param[in] g				- the integers, in the reduction representation.
+ * @param[in] k				- the number of integers.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reduction precomputation.
+ */
+static void bn_mxp_tab(bn_t *t, const bn_t *g, int k, const bn_t m,
+		const bn_t u) {
+	int i, j;
+
+	bn_set_dig(t[0], 1);
+#if BN_MOD == MONTY
+	bn_mod_monty_conv(t[0], t[0], m);
+#else
+	(void)u;
+#endif
+	for (i = 0; i < k; i++) {
+		bn_copy(t[1 << i], g[i]);
+		for (j = 1; j < (1 << i); j++) {
+			bn_mul(t[(1 << i) + j], t[j], g[i]);
+			bn_mod(t[(1 << i) + j], t[(1 << i) + j], m, u);
+		}
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -365,3 +394,407 @@ void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m) {
 		bn_free(r);
 	}
 }
+
+void bn_mxp_pre(bn_t *t, const bn_t a, const bn_t m) {
+	bn_t g[BN_DEPTH], u;
+	int i, j, l;
+
+	bn_null(u);
+	for (i = 0; i < BN_DEPTH; i++) {
+		bn_null(g[i]);
+	}
+
+	TRY {
+		bn_new(u);
+		for (i = 0; i < BN_DEPTH; i++) {
+			bn_new(g[i]);
+		}
+		bn_mod_pre(u, m);
+
+		l = RLC_CEIL(bn_bits(m), BN_DEPTH);
+
+		/* Compute g[i] = a^(2^(il)) mod m. */
+		bn_mod(g[0], a, m);
+#if BN_MOD == MONTY
+		bn_mod_monty_conv(g[0], g[0], m);
+#endif
+		for (i = 1; i < BN_DEPTH; i++) {
+			bn_copy(g[i], g[i - 1]);
+			for (j = 0; j < l; j++) {
+				bn_sqr(g[i], g[i]);
+				bn_mod(g[i], g[i], m, u);
+			}
+		}
+
+		bn_mxp_tab(t, (const bn_t *)g, BN_DEPTH, m, u);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(u);
+		for (i = 0; i < BN_DEPTH; i++) {
+			bn_free(g[i]);
+		}
+	}
+}
+
+void bn_mxp_fix(bn_t c, const bn_t *t, const bn_t b, const bn_t m) {
+	int i, j, l, w, n0, p0, p1;
+	bn_t r, u;
+
+	if (bn_is_zero(b)) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	bn_null(r);
+	bn_null(u);
+
+	TRY {
+		bn_new(r);
+		bn_new(u);
+
+		l = RLC_CEIL(bn_bits(m), BN_DEPTH);
+		n0 = bn_bits(b);
+
+		if (bn_sign(b) == RLC_NEG || n0 > BN_DEPTH * l) {
+			/* Recover the basis and fall back to the variable base method. */
+#if BN_MOD == MONTY
+			bn_mod_monty_back(r, t[1], m);
+#else
+			bn_copy(r, t[1]);
+#endif
+			bn_mxp(c, r, b, m);
+		} else {
+			bn_mod_pre(u, m);
+
+			p0 = BN_DEPTH * l - 1;
+			w = 0;
+			p1 = p0--;
+			for (j = BN_DEPTH - 1; j >= 0; j--, p1 -= l) {
+				w = w << 1;
+				if (p1 < n0 && bn_get_bit(b, p1)) {
+					w = w | 1;
+				}
+			}
+
+			bn_copy(r, t[w]);
+			for (i = l - 2; i >= 0; i--) {
+				bn_sqr(r, r);
+				bn_mod(r, r, m, u);
+
+				w = 0;
+				p1 = p0--;
+				for (j = BN_DEPTH - 1; j >= 0; j--, p1 -= l) {
+					w = w << 1;
+					if (p1 < n0 && bn_get_bit(b, p1)) {
+						w = w | 1;
+					}
+				}
+				if (w > 0) {
+					bn_mul(r, r, t[w]);
+					bn_mod(r, r, m, u);
+				}
+			}
+
+#if BN_MOD == MONTY
+			bn_mod_monty_back(c, r, m);
+#else
+			bn_copy(c, r);
+#endif
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(r);
+		bn_free(u);
+	}
+}
+
+void bn_mxp_sim(bn_t c, const bn_t *a, const bn_t *b, int n, const bn_t m) {
+	int i, j, k, l, w, h, v;
+	uint8_t *win = NULL;
+	bn_t *t = NULL, r, u;
+
+	if (n <= 0) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	/* Find window size from the longest exponent. */
+	l = 0;
+	for (i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(b[i]));
+	}
+	if (l <= 32) {
+		w = 2;
+	} else if (l <= 128) {
+		w = 3;
+	} else if (l <= 512) {
+		w = 4;
+	} else {
+		w = 5;
+	}
+	h = 1 << (w - 1);
+
+	bn_null(r);
+	bn_null(u);
+
+	TRY {
+		bn_new(r);
+		bn_new(u);
+		t = (bn_t *)calloc(n * h, sizeof(bn_t));
+		win = (uint8_t *)calloc((size_t)n * (l + 1), sizeof(uint8_t));
+		if (t == NULL || win == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n * h; i++) {
+			bn_null(t[i]);
+			bn_new(t[i]);
+		}
+		bn_mod_pre(u, m);
+
+		for (i = 0; i < n; i++) {
+			/* Build the odd powers a^1, a^3, ..., a^(2^w - 1) of each basis,
+			 * inverting the bases raised to negative exponents. */
+			bn_mod(t[i * h], a[i], m);
+			if (bn_sign(b[i]) == RLC_NEG) {
+				bn_gcd_ext(r, t[i * h], NULL, t[i * h], m);
+				if (bn_cmp_dig(r, 1) != RLC_EQ) {
+					THROW(ERR_NO_VALID);
+				}
+				if (bn_sign(t[i * h]) == RLC_NEG) {
+					bn_add(t[i * h], t[i * h], m);
+				}
+			}
+#if BN_MOD == MONTY
+			bn_mod_monty_conv(t[i * h], t[i * h], m);
+#endif
+			bn_sqr(r, t[i * h]);
+			bn_mod(r, r, m, u);
+			for (j = 1; j < h; j++) {
+				bn_mul(t[i * h + j], t[i * h + j - 1], r);
+				bn_mod(t[i * h + j], t[i * h + j], m, u);
+			}
+
+			/* Store each sliding window of the exponent at its lowest bit. */
+			for (j = bn_bits(b[i]) - 1; j >= 0; j--) {
+				if (bn_get_bit(b[i], j)) {
+					k = RLC_MAX(j - w + 1, 0);
+					while (!bn_get_bit(b[i], k)) {
+						k++;
+					}
+					for (v = 0; j >= k; j--) {
+						v = (v << 1) | bn_get_bit(b[i], j);
+					}
+					win[i * (l + 1) + k] = v;
+					j = k;
+				}
+			}
+		}
+
+		/* Interleave the windows of all exponents, sharing the squarings. */
+#if BN_MOD == MONTY
+		bn_set_dig(r, 1);
+		bn_mod_monty_conv(r, r, m);
+#else
+		bn_set_dig(r, 1);
+#endif
+		for (j = l - 1; j >= 0; j--) {
+			if (j < l - 1) {
+				bn_sqr(r, r);
+				bn_mod(r, r, m, u);
+			}
+			for (i = 0; i < n; i++) {
+				v = win[i * (l + 1) + j];
+				if (v > 0) {
+					bn_mul(r, r, t[i * h + (v >> 1)]);
+					bn_mod(r, r, m, u);
+				}
+			}
+		}
+
+#if BN_MOD == MONTY
+		bn_mod_monty_back(c, r, m);
+#else
+		bn_copy(c, r);
+#endif
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(r);
+		bn_free(u);
+		if (t != NULL) {
+			for (i = 0; i < n * h; i++) {
+				bn_free(t[i]);
+			}
+		}
+		free(t);
+		free(win);
+	}
+}
+
+void bn_mxp_mon(bn_t c, const bn_t a, const bn_t b, const bn_mon_t mon) {
+#if BN_MXP == MONTY
+	bn_t tab[2];
+	dig_t mask;
+	int i, j, t;
+#else
+	bn_t tab[RLC_TABLE_SIZE], t, r;
+	int i, j, l, w = 1;
+	uint8_t win[RLC_BN_BITS];
+#endif
+
+	if (bn_is_zero(b)) {
+		bn_copy(c, mon->one);
+		return;
+	}
+
+#if BN_MXP == MONTY
+	bn_null(tab[0]);
+	bn_null(tab[1]);
+
+	TRY {
+		bn_new(tab[0]);
+		bn_new(tab[1]);
+
+		bn_copy(tab[1], a);
+		if (bn_sign(b) == RLC_NEG) {
+			bn_mon_back(tab[1], tab[1], mon);
+			bn_gcd_ext(tab[0], tab[1], NULL, tab[1], mon->m);
+			if (bn_cmp_dig(tab[0], 1) != RLC_EQ) {
+				bn_zero(c);
+				THROW(ERR_NO_VALID);
+			}
+			bn_mon_conv(tab[1], tab[1], mon);
+		}
+		bn_copy(tab[0], mon->one);
+
+		for (i = bn_bits(b) - 1; i >= 0; i--) {
+			j = bn_get_bit(b, i);
+			dv_swap_cond(tab[0]->dp, tab[1]->dp, RLC_BN_DIGS, j ^ 1);
+			mask = -(j ^ 1);
+			t = (tab[0]->used ^ tab[1]->used) & mask;
+			tab[0]->used ^= t;
+			tab[1]->used ^= t;
+			bn_mul_mon(tab[0], tab[0], tab[1], mon);
+			bn_sqr_mon(tab[1], tab[1], mon);
+			dv_swap_cond(tab[0]->dp, tab[1]->dp, RLC_BN_DIGS, j ^ 1);
+			mask = -(j ^ 1);
+			t = (tab[0]->used ^ tab[1]->used) & mask;
+			tab[0]->used ^= t;
+			tab[1]->used ^= t;
+		}
+		bn_copy(c, tab[0]);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(tab[1]);
+		bn_free(tab[0]);
+	}
+#else
+	bn_null(t);
+	bn_null(r);
+	for (i = 0; i < RLC_TABLE_SIZE; i++) {
+		bn_null(tab[i]);
+	}
+
+	TRY {
+		/* Find window size. */
+		i = bn_bits(b);
+		if (i <= 21) {
+			w = 2;
+		} else if (i <= 32) {
+			w = 3;
+		} else if (i <= 128) {
+			w = 4;
+		} else if (i <= 256) {
+			w = 5;
+		} else {
+			w = 6;
+		}
+
+		for (i = 1; i < (1 << w); i += 2) {
+			bn_new(tab[i]);
+		}
+		bn_new(t);
+		bn_new(r);
+
+		bn_copy(tab[1], a);
+		if (bn_sign(b) == RLC_NEG) {
+			bn_mon_back(tab[1], tab[1], mon);
+			bn_gcd_ext(t, tab[1], NULL, tab[1], mon->m);
+			if (bn_cmp_dig(t, 1) != RLC_EQ) {
+				bn_zero(c);
+				THROW(ERR_NO_VALID);
+			}
+			bn_mon_conv(tab[1], tab[1], mon);
+		}
+
+		bn_sqr_mon(t, tab[1], mon);
+		/* Create table. */
+		for (i = 1; i < 1 << (w - 1); i++) {
+			bn_mul_mon(tab[2 * i + 1], tab[2 * i - 1], t, mon);
+		}
+
+		bn_copy(r, mon->one);
+		l = RLC_BN_BITS + 1;
+		bn_rec_slw(win, &l, b, w);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				bn_sqr_mon(r, r, mon);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					bn_sqr_mon(r, r, mon);
+				}
+				bn_mul_mon(r, r, tab[win[i]], mon);
+			}
+		}
+		bn_copy(c, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 1; i < (1 << w); i += 2) {
+			bn_free(tab[i]);
+		}
+		bn_free(t);
+		bn_free(r);
+	}
+#endif
+}
+
+void bn_mxp_ctx(bn_t c, const bn_t a, const bn_t b, const bn_t m,
+		const bn_mon_t mon) {
+	bn_t t;
+
+	if (!bn_mon_is(mon, m)) {
+		bn_mxp(c, a, b, m);
+		return;
+	}
+
+	bn_null(t);
+
+	TRY {
+		bn_new(t);
+
+		/* Work on a copy, as the result may alias the exponent. */
+		bn_mon_conv(t, a, mon);
+		bn_mxp_mon(t, t, b, mon);
+		bn_mon_back(c, t, mon);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+	}
+}
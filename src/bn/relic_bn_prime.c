@@ -32,6 +32,8 @@
  * @ingroup bn
  */
 
+#include <string.h>
+
 #include "relic_core.h"
 
 /*============================================================================*/
@@ -166,6 +168,434 @@ static void bn_exp(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 
 #endif
 
+/**
+ * Logarithm of the number of odd candidates examined in each sieving window.
+ */
+#define RLC_SIEVE_BITS		12
+
+/**
+ * Number of odd candidates examined in each sieving window.
+ */
+#define RLC_SIEVE_SIZE		(1 << RLC_SIEVE_BITS)
+
+/**
+ * Bound on the odd primes used to sieve the candidates.
+ */
+#if WSIZE == 8
+#define RLC_SIEVE_LIM		(1 << 8)
+#else
+#define RLC_SIEVE_LIM		(1 << 16)
+#endif
+
+/**
+ * Length in bits up to which candidates may coincide with the sieving primes,
+ * which would then be discarded as multiples of themselves.
+ */
+#if WSIZE == 8
+#define RLC_SIEVE_MIN		8
+#else
+#define RLC_SIEVE_MIN		16
+#endif
+
+/**
+ * Work assigned to a thread that searches for primes.
+ */
+typedef struct {
+	/** The prime found by any of the threads. */
+	bn_st *a;
+	/** The first candidate shared by all threads. */
+	bn_st *b;
+	/** The odd primes used for sieving. */
+	const uint32_t *p;
+	/** The number of odd primes used for sieving. */
+	int np;
+	/** The length of the prime in bits. */
+	int bits;
+	/** The flag to search for safe primes. */
+	int safe;
+	/** The index of the thread. */
+	int id;
+	/** The number of threads. */
+	int n;
+	/** The flag set to 1 when a prime is found and to 2 on errors. */
+	int *stop;
+} sieve_t;
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the prime found by the threads and the stop flag.
+ */
+static pthread_mutex_t sieve_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Reads the flag that stops the threads searching for primes.
+ *
+ * @param[in] stop			- the flag.
+ * @return the value of the flag.
+ */
+static int bn_sieve_get(int *stop) {
+	int r;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&sieve_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (sieve)
+#endif
+	r = *stop;
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&sieve_lock);
+#endif
+	return r;
+}
+
+/**
+ * Writes the flag that stops the threads searching for primes.
+ *
+ * @param[out] stop			- the flag.
+ * @param[in] value			- the value to write.
+ */
+static void bn_sieve_set(int *stop, int value) {
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&sieve_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (sieve)
+#endif
+	*stop = value;
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&sieve_lock);
+#endif
+}
+
+/**
+ * Generates a probable prime by testing random candidates one at a time. Used
+ * for lengths so small that candidates may coincide with the sieving primes.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bits			- the length of the number in bits.
+ * @param[in] safe			- the flag to generate a safe prime.
+ */
+static void bn_gen_prime_small(bn_t a, int bits, int safe) {
+	while (1) {
+		do {
+			bn_rand(a, RLC_POS, bits);
+		} while (bn_bits(a) != bits);
+		if (!safe) {
+			if (bn_is_prime(a)) {
+				return;
+			}
+			continue;
+		}
+		/* Check if (a - 1)/2 is prime. */
+		bn_sub_dig(a, a, 1);
+		bn_rsh(a, a, 1);
+		if (bn_is_prime(a)) {
+			/* Restore a. */
+			bn_lsh(a, a, 1);
+			bn_add_dig(a, a, 1);
+			if (bn_is_prime(a)) {
+				/* Should be prime now. */
+				return;
+			}
+		}
+	}
+}
+
+/**
+ * Computes the odd primes below RLC_SIEVE_LIM with the sieve of Eratosthenes.
+ *
+ * @param[out] np			- the number of primes.
+ * @return the table of primes allocated with malloc(), or NULL.
+ */
+static uint32_t *bn_sieve_init(int *np) {
+	uint8_t *c = (uint8_t *)calloc(RLC_SIEVE_LIM, 1);
+	uint32_t i, j, *p = NULL;
+
+	*np = 0;
+	if (c != NULL) {
+		for (i = 3; i * i < RLC_SIEVE_LIM; i += 2) {
+			if (!c[i]) {
+				for (j = i * i; j < RLC_SIEVE_LIM; j += 2 * i) {
+					c[j] = 1;
+				}
+			}
+		}
+		for (i = 3; i < RLC_SIEVE_LIM; i += 2) {
+			*np += !c[i];
+		}
+		p = (uint32_t *)malloc(*np * sizeof(uint32_t));
+		if (p != NULL) {
+			for (*np = 0, i = 3; i < RLC_SIEVE_LIM; i += 2) {
+				if (!c[i]) {
+					p[(*np)++] = i;
+				}
+			}
+		}
+		free(c);
+	}
+	return p;
+}
+
+/**
+ * Searches for a probable prime among the odd candidates b, b + 2, ...,
+ * b + 2 * (RLC_SIEVE_SIZE - 1). The residues of b modulo the sieving primes
+ * are computed once and each prime marks the candidates it divides, so that
+ * only the survivors go through the Miller-Rabin test. If a safe prime is
+ * requested, the candidates q are also sieved for 2 * q + 1 and the result is
+ * 2 * q + 1.
+ *
+ * @param[out] a			- the prime found.
+ * @param[in] b				- the first candidate, odd.
+ * @param[in] bits			- the length of the prime in bits.
+ * @param[in] safe			- the flag to search for safe primes.
+ * @param[in] ps			- the odd primes used for sieving.
+ * @param[in] np			- the number of odd primes used for sieving.
+ * @param[in] stop			- the flag set once another thread finds a prime.
+ * @return 1 if a prime was found, 0 otherwise.
+ */
+static int bn_sieve(bn_t a, const bn_t b, int bits, int safe,
+		const uint32_t *ps, int np, int *stop) {
+	uint8_t sieve[RLC_SIEVE_SIZE];
+	uint32_t j, p, r, h;
+	int i, result = 0;
+	dig_t t;
+	bn_t q;
+
+	bn_null(q);
+
+	TRY {
+		bn_new(q);
+
+		memset(sieve, 0, sizeof(sieve));
+		for (i = 0; i < np; i++) {
+			p = ps[i];
+			bn_mod_dig(&t, b, (dig_t)p);
+			r = t;
+			/* Compute h = 1/2 mod p. */
+			h = (p + 1) / 2;
+			/* Candidate b + 2j is divisible by p iff j = -r/2 mod p. */
+			for (j = (p - r) * h % p; j < RLC_SIEVE_SIZE; j += p) {
+				sieve[j] = 1;
+			}
+			if (safe) {
+				/* And 2(b + 2j) + 1 is divisible by p iff j = -(2r + 1)/4. */
+				j = (p - (2 * r + 1) % p) * h % p * h % p;
+				for (; j < RLC_SIEVE_SIZE; j += p) {
+					sieve[j] = 1;
+				}
+			}
+		}
+
+		bn_copy(q, b);
+		for (j = 0; j < RLC_SIEVE_SIZE && !result; j++) {
+			if (j > 0) {
+				bn_add_dig(q, q, 2);
+			}
+			if (bn_bits(q) > (safe ? bits - 1 : bits)) {
+				break;
+			}
+			if (sieve[j]) {
+				continue;
+			}
+			/* Give up on the window once another thread found a prime. */
+			if (bn_sieve_get(stop)) {
+				break;
+			}
+			if (!bn_is_prime_rabin(q)) {
+				continue;
+			}
+			if (safe) {
+				bn_dbl(a, q);
+				bn_add_dig(a, a, 1);
+				result = bn_is_prime_rabin(a);
+			} else {
+				bn_copy(a, q);
+				result = 1;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(q);
+	}
+	return result;
+}
+
+/**
+ * Searches the windows assigned to a thread until a prime is found by any
+ * thread or the candidates become too long. Thread i examines the windows
+ * starting at b + 2 * (i + k * n) * RLC_SIEVE_SIZE for k = 0, 1, ..., so the
+ * windows searched by different threads are disjoint.
+ *
+ * @param[in,out] ptr		- the work assigned to the thread.
+ * @return NULL.
+ */
+static void *bn_sieve_job(void *ptr) {
+	sieve_t *job = (sieve_t *)ptr;
+	int init = (core_get() == NULL);
+	bn_t a, b, s;
+
+	if (init) {
+		core_init();
+	}
+
+	bn_null(a);
+	bn_null(b);
+	bn_null(s);
+
+	TRY {
+		bn_new(a);
+		bn_new(b);
+		bn_new(s);
+
+		bn_set_dig(s, job->id);
+		bn_lsh(s, s, RLC_SIEVE_BITS + 1);
+		bn_add(b, job->b, s);
+		bn_set_dig(s, job->n);
+		bn_lsh(s, s, RLC_SIEVE_BITS + 1);
+
+		while (!bn_sieve_get(job->stop) &&
+				bn_bits(b) <= (job->safe ? job->bits - 1 : job->bits)) {
+			if (bn_sieve(a, b, job->bits, job->safe, job->p, job->np,
+					job->stop)) {
+#if MULTI == PTHREAD
+				pthread_mutex_lock(&sieve_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (sieve)
+#endif
+				{
+					if (!(*job->stop)) {
+						bn_copy(job->a, a);
+						*job->stop = 1;
+					}
+				}
+#if MULTI == PTHREAD
+				pthread_mutex_unlock(&sieve_lock);
+#endif
+			}
+			bn_add(b, b, s);
+		}
+	}
+	CATCH_ANY {
+		/* Stop the other threads and let the caller report the error. */
+		bn_sieve_set(job->stop, 2);
+	}
+	FINALLY {
+		bn_free(a);
+		bn_free(b);
+		bn_free(s);
+	}
+
+	if (init) {
+		core_clean();
+	}
+	return NULL;
+}
+
+/**
+ * Generates a probable prime by sieving windows of candidates from random
+ * starting points, splitting the windows among n threads.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bits			- the length of the number in bits.
+ * @param[in] safe			- the flag to generate a safe prime.
+ * @param[in] n				- the number of threads.
+ */
+static void bn_gen_prime_sieve(bn_t a, int bits, int safe, int n) {
+	int stop = 0;
+	sieve_t *job = NULL;
+	uint32_t *p = NULL;
+#if MULTI == PTHREAD
+	pthread_t *thread = NULL;
+	int j;
+#endif
+	int i, np, l = (safe ? bits - 1 : bits);
+	bn_t b;
+
+	if (l <= RLC_SIEVE_MIN) {
+		bn_gen_prime_small(a, bits, safe);
+		return;
+	}
+
+#if !defined(MULTI) || (MULTI != PTHREAD && MULTI != OPENMP)
+	n = 1;
+#endif
+	n = RLC_MAX(n, 1);
+
+	bn_null(b);
+
+	TRY {
+		bn_new(b);
+		job = (sieve_t *)malloc(n * sizeof(sieve_t));
+#if MULTI == PTHREAD
+		thread = (pthread_t *)malloc(n * sizeof(pthread_t));
+		if (thread == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+#endif
+		p = bn_sieve_init(&np);
+		if (job == NULL || p == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+
+		while (!stop) {
+			/* Draw an odd starting point with the right length. */
+			bn_rand(b, RLC_POS, l);
+			bn_set_bit(b, l - 1, 1);
+			bn_set_bit(b, 0, 1);
+			for (i = 0; i < n; i++) {
+				job[i].a = a;
+				job[i].b = b;
+				job[i].p = p;
+				job[i].np = np;
+				job[i].bits = bits;
+				job[i].safe = safe;
+				job[i].id = i;
+				job[i].n = n;
+				job[i].stop = &stop;
+			}
+#if MULTI == PTHREAD
+			for (i = 1; i < n; i++) {
+				if (pthread_create(&thread[i], NULL, bn_sieve_job, &job[i])) {
+					/* Stop the threads already running before failing. */
+					bn_sieve_set(&stop, 2);
+					break;
+				}
+			}
+			if (i == n) {
+				bn_sieve_job(&job[0]);
+			}
+			for (j = 1; j < i; j++) {
+				pthread_join(thread[j], NULL);
+			}
+#elif MULTI == OPENMP
+#pragma omp parallel for num_threads(n)
+			for (i = 0; i < n; i++) {
+				bn_sieve_job(&job[i]);
+			}
+#else
+			bn_sieve_job(&job[0]);
+#endif
+		}
+		if (stop != 1) {
+			THROW(ERR_CAUGHT);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(b);
+		free(job);
+		free(p);
+#if MULTI == PTHREAD
+		free(thread);
+#endif
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -390,14 +820,7 @@ int bn_is_prime_solov(const bn_t a) {
 #if BN_GEN == BASIC || !defined(STRIP)
 
 void bn_gen_prime_basic(bn_t a, int bits) {
-	while (1) {
-		do {
-			bn_rand(a, RLC_POS, bits);
-		} while (bn_bits(a) != bits);
-		if (bn_is_prime(a)) {
-			return;
-		}
-	}
+	bn_gen_prime_sieve(a, bits, 0, 1);
 }
 
 #endif
@@ -405,23 +828,7 @@ void bn_gen_prime_basic(bn_t a, int bits) {
 #if BN_GEN == SAFEP || !defined(STRIP)
 
 void bn_gen_prime_safep(bn_t a, int bits) {
-	while (1) {
-		do {
-			bn_rand(a, RLC_POS, bits);
-		} while (bn_bits(a) != bits);
-		/* Check if (a - 1)/2 is prime. */
-		bn_sub_dig(a, a, 1);
-		bn_rsh(a, a, 1);
-		if (bn_is_prime(a)) {
-			/* Restore a. */
-			bn_lsh(a, a, 1);
-			bn_add_dig(a, a, 1);
-			if (bn_is_prime(a)) {
-				/* Should be prime now. */
-				return;
-			}
-		}
-	}
+	bn_gen_prime_sieve(a, bits, 1, 1);
 }
 
 #endif
@@ -506,3 +913,7 @@ void bn_gen_prime_stron(bn_t a, int bits) {
 }
 
 #endif
+
+void bn_gen_prime_par(bn_t a, int bits, int safe, int n) {
+	bn_gen_prime_sieve(a, bits, safe, n);
+}
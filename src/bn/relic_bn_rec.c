@@ -798,6 +798,20 @@ void bn_rec_jsf(int8_t *jsf, int *len, const bn_t k, const bn_t l) {
 
 }
 
+void bn_rec_sdw(int *win, int len, const bn_t k, int w) {
+	int i, j, u, carry = 0;
+
+	for (i = 0; i < len; i++) {
+		u = 0;
+		for (j = 0; j < w; j++) {
+			u |= bn_get_bit(k, i * w + j) << j;
+		}
+		u += carry;
+		carry = (u > (1 << (w - 1)));
+		win[i] = u - (carry << w);
+	}
+}
+
 void bn_rec_glv(bn_t k0, bn_t k1, const bn_t k, const bn_t n, const bn_t *v1,
 		const bn_t *v2) {
 	bn_t t, b1, b2;
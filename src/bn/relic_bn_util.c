@@ -81,7 +81,10 @@ int bn_sign(const bn_t a) {
 void bn_zero(bn_t a) {
 	a->sign = RLC_POS;
 	a->used = 1;
-	dv_zero(a->dp, a->alloc);
+	/* Integers may be larger than a digit vector when ALLOC = DYNAMIC. */
+	for (int i = 0; i < a->alloc; i++) {
+		a->dp[i] = 0;
+	}
 }
 
 int bn_is_zero(const bn_t a) {
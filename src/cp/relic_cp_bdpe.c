@@ -39,13 +39,134 @@
 #include "relic_cp.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maximum number of distinct prime factors of a block size.
+ */
+#define BDPE_FACTS		(RLC_DIG / 2)
+
+/**
+ * Factors a block size into prime powers by trial division.
+ *
+ * @param[out] l			- the distinct prime factors.
+ * @param[out] e			- the multiplicities.
+ * @param[in] block			- the block size.
+ * @return the number of distinct prime factors.
+ */
+static int bdpe_factor(dig_t *l, int *e, dig_t block) {
+	int k = 0;
+
+	for (dig_t d = 2; d <= block / d; d += (d == 2 ? 1 : 2)) {
+		if (block % d == 0) {
+			l[k] = d;
+			e[k] = 0;
+			while (block % d == 0) {
+				block /= d;
+				e[k]++;
+			}
+			k++;
+		}
+	}
+	if (block > 1) {
+		l[k] = block;
+		e[k] = 1;
+		k++;
+	}
+	return k;
+}
+
+/**
+ * Returns the number of slots in the hash table for a prime factor, the
+ * smallest power of two keeping the load factor below one half.
+ *
+ * @param[in] l				- the prime factor.
+ * @return the number of slots.
+ */
+static size_t bdpe_slots(dig_t l) {
+	size_t slots = 2;
+
+	while (slots < 2 * (size_t)l) {
+		slots <<= 1;
+	}
+	return slots;
+}
+
+/**
+ * Computes t = (p - 1)(q - 1)/block.
+ *
+ * @param[out] t			- the result.
+ * @param[in] prv			- the private key.
+ */
+static void bdpe_phi(bn_t t, bdpe_t prv) {
+	bn_mul(t, prv->p, prv->q);
+	bn_sub(t, t, prv->p);
+	bn_sub(t, t, prv->q);
+	bn_add_dig(t, t, 1);
+	bn_div_dig(t, t, prv->t);
+}
+
+/**
+ * Finds the exponent of a residue of order dividing a prime factor. Every
+ * entry of the table matching the least significant digit of the residue is
+ * confirmed by exponentiating the base, so the result is exact.
+ *
+ * @param[out] d			- the exponent.
+ * @param[in] tab			- the tables of residues.
+ * @param[in] f				- the index of the prime factor.
+ * @param[in] s				- the residue.
+ * @param[in] h				- the base of order l.
+ * @param[in] n				- the modulus.
+ * @return 1 if the exponent was found, 0 otherwise.
+ */
+static int bdpe_get(dig_t *d, dig_t *tab, int f, const bn_t s, const bn_t h,
+		const bn_t n) {
+	dig_t key, *slot = tab + tab[1 + 4 * f + 3];
+	size_t j, mask = tab[1 + 4 * f + 2] - 1;
+	int result = 0;
+	bn_t z;
+
+	bn_null(z);
+
+	TRY {
+		bn_new(z);
+
+		bn_get_dig(&key, s);
+		for (j = key & mask; slot[2 * j + 1] != 0 && !result;
+				j = (j + 1) & mask) {
+			if (slot[2 * j] == key) {
+				bn_mxp_dig(z, h, slot[2 * j + 1] - 1, n);
+				if (bn_cmp(z, s) == RLC_EQ) {
+					*d = slot[2 * j + 1] - 1;
+					result = 1;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(z);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits) {
 	bn_t t, r;
-	int result = RLC_OK;
+	dig_t l[BDPE_FACTS];
+	int e[BDPE_FACTS], i, k, result = RLC_OK;
+
+	/* The block size must be odd to be coprime to q - 1. */
+	if (block < 3 || block % 2 == 0) {
+		return RLC_ERR;
+	}
 
 	bn_null(t);
 	bn_null(r);
@@ -55,12 +176,7 @@ int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits) {
 		bn_new(r);
 
 		prv->t = pub->t = block;
-
-		/* Make sure that block size is prime. */
-		bn_set_dig(t, block);
-		if (bn_is_prime_basic(t) == 0) {
-			THROW(ERR_NO_VALID);
-		}
+		k = bdpe_factor(l, e, block);
 
 		/* Generate prime q such that gcd(block, (q - 1)) = 1. */
 		do {
@@ -84,25 +200,31 @@ int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits) {
 			bn_add_dig(prv->p, prv->p, 1);
 		} while (bn_cmp_dig(t, 1) != RLC_EQ || bn_is_prime(prv->p) == 0);
 
-		/* Compute t = (p-1)*(q-1). */
-		bn_sub_dig(prv->q, prv->q, 1);
-		bn_sub_dig(prv->p, prv->p, 1);
-		bn_mul(t, prv->p, prv->q);
-		bn_div_dig(t, t, block);
-
 		/* Restore factors p and q and compute n = p * q. */
-		bn_add_dig(prv->p, prv->p, 1);
-		bn_add_dig(prv->q, prv->q, 1);
 		bn_mul(pub->n, prv->p, prv->q);
 		bn_copy(prv->n, pub->n);
+		bn_mon_set(pub->mn, pub->n);
 
-		/* Select random y such that y^{(p-1)(q-1)}/block \neq 1 mod N. */
+		/* Compute t = (p-1)*(q-1)/block. */
+		bdpe_phi(t, prv);
+
+		/* Select random y such that g = y^{(p-1)(q-1)/block} has order block,
+		 * that is, g^{block/l} \neq 1 mod N for every prime l | block. */
 		do {
 			bn_rand(pub->y, RLC_POS, bits);
-			bn_mxp(r, pub->y, t, pub->n);
-		} while (bn_cmp_dig(r, 1) == RLC_EQ);
+			bn_mxp_ctx(prv->g, pub->y, t, pub->n, pub->mn);
+			for (i = 0; i < k; i++) {
+				bn_mxp_dig(r, prv->g, block / l[i], pub->n);
+				if (bn_cmp_dig(r, 1) == RLC_EQ) {
+					break;
+				}
+			}
+		} while (i < k);
 
 		bn_copy(prv->y, pub->y);
+		if (cp_bdpe_pre(prv) != RLC_OK) {
+			THROW(ERR_CAUGHT);
+		}
 	}
 	CATCH_ANY {
 		result = RLC_ERR;
@@ -135,7 +257,7 @@ int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub) {
 		bn_set_dig(m, in);
 
 		bn_rand_mod(u, pub->n);
-		bn_mxp(m, pub->y, m, pub->n);
+		bn_mxp_ctx(m, pub->y, m, pub->n, pub->mn);
 		bn_mxp_dig(u, u, pub->t, pub->n);
 		bn_mul(m, m, u);
 		bn_mod(m, m, pub->n);
@@ -160,9 +282,9 @@ int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub) {
 }
 
 int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv) {
-	bn_t m, t, z;
-	int size, result = RLC_OK;
-	dig_t i;
+	bn_t m, t, a, b, h, z;
+	int f, k, size, result = RLC_OK;
+	dig_t d, l, le, lk, x;
 
 	size = bn_size_bin(prv->n);
 
@@ -170,35 +292,70 @@ int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv) {
 		return RLC_ERR;
 	}
 
+	if (prv->tab == NULL) {
+		return RLC_ERR;
+	}
+
 	bn_null(m);
 	bn_null(t);
+	bn_null(a);
+	bn_null(b);
+	bn_null(h);
 	bn_null(z);
 
 	TRY {
 		bn_new(m);
 		bn_new(t);
+		bn_new(a);
+		bn_new(b);
+		bn_new(h);
 		bn_new(z);
 
-		/* Compute t = (p-1)(q-1)/block. */
-		bn_mul(t, prv->p, prv->q);
-		bn_sub(t, t, prv->p);
-		bn_sub(t, t, prv->q);
-		bn_add_dig(t, t, 1);
-		bn_div_dig(t, t, prv->t);
+		/* Compute w = c^{(p-1)(q-1)/block} = g^m, the only full exponentiation. */
+		bdpe_phi(t, prv);
 		bn_read_bin(m, in, in_len);
-		bn_mxp(m, m, t, prv->n);
-		bn_mxp(t, prv->y, t, prv->n);
-
-		for (i = 0; i < prv->t; i++) {
-			bn_mxp_dig(z, t, i, prv->n);
-			if (bn_cmp(z, m) == RLC_EQ) {
-				*out = i;
-				break;
+		bn_mxp_ctx(m, m, t, prv->n, prv->mn);
+		bn_zero(t);
+
+		/* Recover m mod l^e for each prime power with Pohlig-Hellman. */
+		for (f = 0; f < (int)prv->tab[0] && result == RLC_OK; f++) {
+			l = prv->tab[1 + 4 * f];
+			le = 1;
+			for (k = 0; k < (int)prv->tab[1 + 4 * f + 1]; k++) {
+				le *= l;
+			}
+			bn_mxp_dig(a, m, prv->t / le, prv->n);
+			bn_mxp_dig(b, prv->g, prv->t / le, prv->n);
+			bn_mxp_dig(h, prv->g, prv->t / l, prv->n);
+
+			x = 0;
+			for (lk = 1; lk < le; lk *= l) {
+				/* Compute (a * b^{-x})^{l^e/(l^k * l)} and look it up. */
+				bn_mxp_dig(z, b, le - x, prv->n);
+				bn_mul(z, z, a);
+				bn_mod(z, z, prv->n);
+				bn_mxp_dig(z, z, le / lk / l, prv->n);
+				if (!bdpe_get(&d, prv->tab, f, z, h, prv->n)) {
+					result = RLC_ERR;
+					break;
+				}
+				x += d * lk;
+			}
+
+			/* Accumulate x * (block/l^e) * ((block/l^e)^{-1} mod l^e). */
+			bn_set_dig(a, (prv->t / le) % le);
+			bn_set_dig(b, le);
+			bn_gcd_ext(z, h, NULL, a, b);
+			if (bn_sign(h) == RLC_NEG) {
+				bn_add(h, h, b);
 			}
+			bn_mul_dig(h, h, x);
+			bn_mul_dig(h, h, prv->t / le);
+			bn_add(t, t, h);
 		}
 
-		if (i == prv->t) {
-			result = RLC_ERR;
+		if (result == RLC_OK) {
+			bn_mod_dig(out, t, prv->t);
 		}
 	} CATCH_ANY {
 		result = RLC_ERR;
@@ -206,6 +363,86 @@ int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv) {
 	FINALLY {
 		bn_free(m);
 		bn_free(t);
+		bn_free(a);
+		bn_free(b);
+		bn_free(h);
+		bn_free(z);
+	}
+
+	return result;
+}
+
+int cp_bdpe_pre(bdpe_t prv) {
+	bn_t t, h, z;
+	dig_t key, l[BDPE_FACTS], *tab = NULL, *slot;
+	int e[BDPE_FACTS], f, k, result = RLC_OK;
+	size_t i, j, mask, len;
+
+	if (prv->t < 2) {
+		return RLC_ERR;
+	}
+
+	k = bdpe_factor(l, e, prv->t);
+	len = 1 + 4 * k;
+	for (f = 0; f < k; f++) {
+		len += 2 * bdpe_slots(l[f]);
+	}
+
+	bn_null(t);
+	bn_null(h);
+	bn_null(z);
+
+	TRY {
+		bn_new(t);
+		bn_new(h);
+		bn_new(z);
+
+		tab = (dig_t *)calloc(len, sizeof(dig_t));
+		if (tab == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+
+		/* Recompute g = y^{(p-1)(q-1)/block}, as keys may be read back. */
+		bn_mon_set(prv->mn, prv->n);
+		bdpe_phi(t, prv);
+		bn_mxp_ctx(prv->g, prv->y, t, prv->n, prv->mn);
+
+		tab[0] = k;
+		len = 1 + 4 * k;
+		for (f = 0; f < k; f++) {
+			tab[1 + 4 * f] = l[f];
+			tab[1 + 4 * f + 1] = e[f];
+			tab[1 + 4 * f + 2] = bdpe_slots(l[f]);
+			tab[1 + 4 * f + 3] = len;
+			slot = tab + len;
+			mask = bdpe_slots(l[f]) - 1;
+			len += 2 * bdpe_slots(l[f]);
+
+			/* Insert h^i for 0 <= i < l, where h = g^{block/l} has order l,
+			 * walking the powers in Montgomery form. */
+			bn_mxp_dig(h, prv->g, prv->t / l[f], prv->n);
+			bn_mon_conv(h, h, prv->mn);
+			bn_copy(z, prv->mn->one);
+			for (i = 0; i < l[f]; i++) {
+				bn_mon_back(t, z, prv->mn);
+				bn_get_dig(&key, t);
+				for (j = key & mask; slot[2 * j + 1] != 0; j = (j + 1) & mask);
+				slot[2 * j] = key;
+				slot[2 * j + 1] = i + 1;
+				bn_mul_mon(z, z, h, prv->mn);
+			}
+		}
+
+		free(prv->tab);
+		prv->tab = tab;
+	}
+	CATCH_ANY {
+		free(tab);
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(h);
 		bn_free(z);
 	}
 
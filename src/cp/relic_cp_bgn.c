@@ -41,6 +41,371 @@
 #include "relic_cp.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of points normalized together in the giant-step search.
+ */
+#define BGN_LANES		64
+
+/**
+ * Number of bytes in the header of a serialized table.
+ */
+#define BGN_HEAD		17
+
+/**
+ * Largest number of baby steps, so that the size of a serialized table still
+ * fits in an int.
+ */
+#define BGN_STEPS		((dig_t)1 << 26)
+
+/**
+ * Returns the number of slots in the hash table for a number of baby steps,
+ * the smallest power of two keeping the load factor below one half.
+ *
+ * @param[in] steps			- the number of baby steps.
+ * @return the number of slots.
+ */
+static size_t bgn_slots(dig_t steps) {
+	size_t slots = 2;
+
+	while (slots < 2 * (size_t)steps) {
+		slots <<= 1;
+	}
+	return slots;
+}
+
+/**
+ * Returns the size in bytes of a serialized group element of a table.
+ *
+ * @param[in] grp			- the group.
+ * @return the number of bytes.
+ */
+static int bgn_elm(int grp) {
+	switch (grp) {
+		case 1:
+			return 2 * RLC_FP_BYTES + 1;
+		case 2:
+			return 4 * RLC_FP_BYTES + 1;
+		default:
+			return 12 * RLC_FP_BYTES;
+	}
+}
+
+/**
+ * Computes the fingerprint of a serialized normalized group element from its
+ * least significant bytes.
+ *
+ * @param[in] bin			- the serialized element.
+ * @param[in] len			- the number of bytes.
+ * @return the fingerprint.
+ */
+static uint64_t bgn_key(const uint8_t *bin, int len) {
+	uint64_t key = 0;
+
+	for (int i = len - 8; i < len; i++) {
+		key = (key << 8) | bin[i];
+	}
+	return key;
+}
+
+/**
+ * Inserts a baby step in the hash table. The slot is chosen by the lower half
+ * of the fingerprint and the upper half is stored together with the index,
+ * which is never zero so that empty slots can be recognized.
+ *
+ * @param[in,out] tab		- the table.
+ * @param[in] key			- the fingerprint of the baby step.
+ * @param[in] i				- the index of the baby step.
+ */
+static void bgn_ins(bgn_tab_t tab, uint64_t key, dig_t i) {
+	size_t mask = bgn_slots(tab->steps) - 1;
+	size_t j = (size_t)key & mask;
+
+	while (tab->tab[j] != 0) {
+		j = (j + 1) & mask;
+	}
+	tab->tab[j] = (key & 0xFFFFFFFF00000000ULL) | (uint64_t)i;
+}
+
+/**
+ * Looks up a fingerprint in the hash table, starting from a given probe.
+ *
+ * @param[out] i			- the index of the matching baby step.
+ * @param[in,out] j			- the slot where to continue the search.
+ * @param[in] tab			- the table.
+ * @param[in] key			- the fingerprint to look up.
+ * @return 1 if a candidate was found, 0 otherwise.
+ */
+static int bgn_get(dig_t *i, size_t *j, bgn_tab_t tab, uint64_t key) {
+	size_t mask = bgn_slots(tab->steps) - 1;
+
+	while (tab->tab[*j] != 0) {
+		uint64_t e = tab->tab[*j];
+		*j = (*j + 1) & mask;
+		if ((e & 0xFFFFFFFF00000000ULL) == (key & 0xFFFFFFFF00000000ULL)) {
+			*i = (dig_t)(e & 0xFFFFFFFF);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Computes the exponent (xy - z) that relates ciphertexts to plaintexts.
+ *
+ * @param[out] r			- the result.
+ * @param[in] prv			- the private key.
+ */
+static void bgn_exp(bn_t r, bgn_t prv) {
+	bn_t n;
+
+	bn_null(n);
+
+	TRY {
+		bn_new(n);
+
+		g1_get_ord(n);
+		bn_mul(r, prv->x, prv->y);
+		bn_sub(r, r, prv->z);
+		bn_mod(r, r, n);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+	}
+}
+
+/**
+ * Defines a function that finds the discrete logarithms of elements of a
+ * group G_1 or G_2 to the base of a table. Each element is searched in several
+ * lanes that advance by multiple giant steps, and the lanes of all pending
+ * elements are normalized together. The function returns RLC_OK if all
+ * logarithms were found and RLC_ERR otherwise.
+ *
+ * @param[in] F				- the name of the function.
+ * @param[in] G				- the prefix of the group functions.
+ * @param[in] U				- the table field with the base.
+ * @param[in] V				- the table field with the giant step.
+ * @param[in] B				- the size of a compressed group element.
+ * @param[in] C				- the qualifier expected by the normalization.
+ */
+#define BGN_LOG(F, G, U, V, B, C)											\
+static int F(dig_t *out, G##_t *t, int n, bgn_tab_t tab) {					\
+	int k, l, c, lanes = RLC_MAX(1, BGN_LANES / n), result = RLC_OK;		\
+	int *done = NULL;														\
+	dig_t i, j, r, rounds = (tab->giants + lanes - 1) / lanes;				\
+	size_t slot, mask = bgn_slots(tab->steps) - 1;							\
+	uint8_t bin[B];															\
+	uint64_t key;															\
+	G##_t *p = NULL, *q = NULL, s, w;										\
+																			\
+	G##_null(s);															\
+	G##_null(w);															\
+																			\
+	TRY {																	\
+		G##_new(s);															\
+		G##_new(w);															\
+		p = (G##_t *)calloc(n * lanes, sizeof(G##_t));						\
+		q = (G##_t *)calloc(n * lanes, sizeof(G##_t));						\
+		done = (int *)calloc(n, sizeof(int));								\
+		if (p == NULL || q == NULL || done == NULL) {						\
+			THROW(ERR_NO_MEMORY);											\
+		}																	\
+		for (k = 0; k < n * lanes; k++) {									\
+			G##_null(p[k]);													\
+			G##_null(q[k]);													\
+			G##_new(p[k]);													\
+			G##_new(q[k]);													\
+		}																	\
+																			\
+		/* Lane l of element k starts from T_k - l * steps * U. */			\
+		for (k = 0; k < n; k++) {											\
+			G##_copy(p[k * lanes], t[k]);									\
+			for (l = 1; l < lanes; l++) {									\
+				G##_add(p[k * lanes + l], p[k * lanes + l - 1], tab->V);	\
+			}																\
+		}																	\
+		G##_mul_dig(s, tab->V, lanes);										\
+		G##_norm(s, s);														\
+																			\
+		for (r = 0; r < rounds; r++) {										\
+			/* Solve lanes at infinity, normalize the others together. */	\
+			for (k = 0; k < n; k++) {										\
+				for (l = 0; l < lanes && !done[k]; l++) {					\
+					j = r * lanes + l;										\
+					if (j < tab->giants &&									\
+							G##_is_infty(p[k * lanes + l])) {				\
+						out[k] = j * tab->steps;							\
+						done[k] = 1;										\
+					}														\
+				}															\
+			}																\
+			c = 0;															\
+			for (k = 0; k < n; k++) {										\
+				for (l = 0; l < lanes && !done[k]; l++) {					\
+					if (r * lanes + l < tab->giants) {						\
+						G##_copy(q[c++], p[k * lanes + l]);					\
+					}														\
+				}															\
+			}																\
+			if (c == 0) {													\
+				break;														\
+			}																\
+			G##_norm_sim(q, (C G##_t *)q, c);								\
+																			\
+			/* Look up the lanes and confirm matches in the order they were	\
+			 * collected. */												\
+			c = 0;															\
+			for (k = 0; k < n; k++) {										\
+				if (done[k]) {												\
+					continue;												\
+				}															\
+				for (l = 0; l < lanes; l++) {								\
+					j = r * lanes + l;										\
+					if (j >= tab->giants) {									\
+						continue;											\
+					}														\
+					G##_copy(p[k * lanes + l], q[c++]);						\
+					G##_write_bin(bin, sizeof(bin), p[k * lanes + l], 1);	\
+					key = bgn_key(bin, sizeof(bin));						\
+					slot = (size_t)key & mask;								\
+					while (!done[k] && bgn_get(&i, &slot, tab, key)) {		\
+						G##_mul_dig(w, tab->U, j * tab->steps + i);			\
+						if (G##_cmp(w, t[k]) == RLC_EQ) {					\
+							out[k] = j * tab->steps + i;					\
+							done[k] = 1;									\
+						}													\
+					}														\
+				}															\
+			}																\
+																			\
+			/* Advance the pending lanes. */								\
+			for (k = 0; k < n; k++) {										\
+				for (l = 0; l < lanes && !done[k]; l++) {					\
+					G##_add(p[k * lanes + l], p[k * lanes + l], s);			\
+				}															\
+			}																\
+		}																	\
+																			\
+		for (k = 0; k < n; k++) {											\
+			if (!done[k]) {													\
+				result = RLC_ERR;											\
+			}																\
+		}																	\
+	}																		\
+	CATCH_ANY {																\
+		result = RLC_ERR;													\
+	}																		\
+	FINALLY {																\
+		G##_free(s);														\
+		G##_free(w);														\
+		for (k = 0; k < n * lanes; k++) {									\
+			if (p != NULL) {												\
+				G##_free(p[k]);												\
+			}																\
+			if (q != NULL) {												\
+				G##_free(q[k]);												\
+			}																\
+		}																	\
+		free(p);															\
+		free(q);															\
+		free(done);															\
+	}																		\
+	return result;															\
+}
+
+/**
+ * Finds the discrete logarithms of elements of G_1 to the base of a table.
+ *
+ * @param[out] out			- the discrete logarithms.
+ * @param[in] t				- the elements, in affine coordinates.
+ * @param[in] n				- the number of elements.
+ * @param[in] tab			- the table.
+ * @return RLC_OK if all logarithms were found, RLC_ERR otherwise.
+ */
+BGN_LOG(bgn_log1, g1, u1, v1, RLC_FP_BYTES + 1, const)
+
+/**
+ * Finds the discrete logarithms of elements of G_2 to the base of a table.
+ *
+ * @param[out] out			- the discrete logarithms.
+ * @param[in] t				- the elements, in affine coordinates.
+ * @param[in] n				- the number of elements.
+ * @param[in] tab			- the table.
+ * @return RLC_OK if all logarithms were found, RLC_ERR otherwise.
+ */
+BGN_LOG(bgn_log2, g2, u2, v2, 2 * RLC_FP_BYTES + 1, )
+
+/**
+ * Finds the discrete logarithms of elements of G_T to the base of a table.
+ *
+ * @param[out] out			- the discrete logarithms.
+ * @param[in] t				- the elements.
+ * @param[in] n				- the number of elements.
+ * @param[in] tab			- the table.
+ * @return RLC_OK if all logarithms were found, RLC_ERR otherwise.
+ */
+static int bgn_logt(dig_t *out, gt_t *t, int n, bgn_tab_t tab) {
+	int k, done, result = RLC_OK;
+	dig_t i, j;
+	size_t slot, mask = bgn_slots(tab->steps) - 1;
+	uint8_t bin[12 * RLC_FP_BYTES];
+	uint64_t key;
+	bn_t e;
+	gt_t p, w;
+
+	bn_null(e);
+	gt_null(p);
+	gt_null(w);
+
+	TRY {
+		bn_new(e);
+		gt_new(p);
+		gt_new(w);
+
+		for (k = 0; k < n; k++) {
+			done = 0;
+			gt_copy(p, t[k]);
+			for (j = 0; j < tab->giants && !done; j++) {
+				if (gt_is_unity(p)) {
+					out[k] = j * tab->steps;
+					done = 1;
+					break;
+				}
+				gt_write_bin(bin, sizeof(bin), p, 0);
+				key = bgn_key(bin, sizeof(bin));
+				slot = (size_t)key & mask;
+				while (!done && bgn_get(&i, &slot, tab, key)) {
+					bn_set_dig(e, j * tab->steps + i);
+					gt_exp(w, tab->ut, e);
+					if (gt_cmp(w, t[k]) == RLC_EQ) {
+						out[k] = j * tab->steps + i;
+						done = 1;
+					}
+				}
+				gt_mul(p, p, tab->vt);
+			}
+			if (!done) {
+				result = RLC_ERR;
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(e);
+		gt_free(p);
+		gt_free(w);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -375,3 +740,377 @@ int cp_bgn_dec(dig_t *out, gt_t in[4], bgn_t prv) {
 
 	return result;
 }
+
+int cp_bgn_tab_gen(bgn_tab_t tab, int grp, dig_t range, dig_t steps,
+		bgn_t prv) {
+	int k, c, result = RLC_OK;
+	dig_t i;
+	uint8_t bin[12 * RLC_FP_BYTES];
+	g1_t *p = NULL;
+	g2_t *q = NULL;
+	gt_t s;
+	bn_t r;
+
+	if (grp < 1 || grp > 3 || range == 0) {
+		return RLC_ERR;
+	}
+	if (steps == 0) {
+		steps = 1;
+		while (steps < range / steps) {
+			steps++;
+		}
+	}
+	if (steps < 2 || steps > BGN_STEPS) {
+		return RLC_ERR;
+	}
+
+	bn_null(r);
+	gt_null(s);
+
+	TRY {
+		bn_new(r);
+		gt_new(s);
+
+		free(tab->tab);
+		tab->grp = grp;
+		tab->steps = steps;
+		tab->giants = range / steps + (range % steps != 0);
+		tab->tab = (uint64_t *)calloc(bgn_slots(steps), sizeof(uint64_t));
+		p = (g1_t *)calloc(BGN_LANES, sizeof(g1_t));
+		q = (g2_t *)calloc(BGN_LANES, sizeof(g2_t));
+		if (tab->tab == NULL || p == NULL || q == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (k = 0; k < BGN_LANES; k++) {
+			g1_null(p[k]);
+			g2_null(q[k]);
+			g1_new(p[k]);
+			g2_new(q[k]);
+		}
+
+		bgn_exp(r, prv);
+		switch (grp) {
+			case 1:
+				/* Compute U = (xy - z)G and V = -steps * U. */
+				g1_mul_gen(tab->u1, r);
+				g1_mul_dig(tab->v1, tab->u1, steps);
+				g1_neg(tab->v1, tab->v1);
+				g1_norm(tab->v1, tab->v1);
+				/* Insert iU for 0 < i < steps, normalizing in chunks. */
+				g1_set_infty(p[BGN_LANES - 1]);
+				for (i = 1; i < steps; i += c) {
+					c = RLC_MIN(BGN_LANES, steps - i);
+					g1_add(p[0], p[BGN_LANES - 1], tab->u1);
+					for (k = 1; k < c; k++) {
+						g1_add(p[k], p[k - 1], tab->u1);
+					}
+					g1_norm_sim(p, (const g1_t *)p, c);
+					for (k = 0; k < c; k++) {
+						g1_write_bin(bin, RLC_FP_BYTES + 1, p[k], 1);
+						bgn_ins(tab, bgn_key(bin, RLC_FP_BYTES + 1), i + k);
+					}
+					g1_copy(p[BGN_LANES - 1], p[c - 1]);
+				}
+				break;
+			case 2:
+				g2_mul_gen(tab->u2, r);
+				g2_mul_dig(tab->v2, tab->u2, steps);
+				g2_neg(tab->v2, tab->v2);
+				g2_norm(tab->v2, tab->v2);
+				g2_set_infty(q[BGN_LANES - 1]);
+				for (i = 1; i < steps; i += c) {
+					c = RLC_MIN(BGN_LANES, steps - i);
+					g2_add(q[0], q[BGN_LANES - 1], tab->u2);
+					for (k = 1; k < c; k++) {
+						g2_add(q[k], q[k - 1], tab->u2);
+					}
+					g2_norm_sim(q, q, c);
+					for (k = 0; k < c; k++) {
+						g2_write_bin(bin, 2 * RLC_FP_BYTES + 1, q[k], 1);
+						bgn_ins(tab, bgn_key(bin, 2 * RLC_FP_BYTES + 1), i + k);
+					}
+					g2_copy(q[BGN_LANES - 1], q[c - 1]);
+				}
+				break;
+			default:
+				/* Compute U = e(G, H)^(xy - z)^2 and V = U^(-steps). */
+				g1_get_gen(p[0]);
+				g2_get_gen(q[0]);
+				pc_map(tab->ut, p[0], q[0]);
+				bn_sqr(r, r);
+				gt_exp(tab->ut, tab->ut, r);
+				bn_set_dig(r, steps);
+				gt_exp(tab->vt, tab->ut, r);
+				gt_inv(tab->vt, tab->vt);
+				gt_copy(s, tab->ut);
+				for (i = 1; i < steps; i++) {
+					gt_write_bin(bin, 12 * RLC_FP_BYTES, s, 0);
+					bgn_ins(tab, bgn_key(bin, 12 * RLC_FP_BYTES), i);
+					gt_mul(s, s, tab->ut);
+				}
+				break;
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(r);
+		gt_free(s);
+		for (k = 0; k < BGN_LANES; k++) {
+			if (p != NULL) {
+				g1_free(p[k]);
+			}
+			if (q != NULL) {
+				g2_free(q[k]);
+			}
+		}
+		free(p);
+		free(q);
+	}
+
+	return result;
+}
+
+int cp_bgn_tab_size(bgn_tab_t tab) {
+	return BGN_HEAD + 2 * bgn_elm(tab->grp) + 8 * bgn_slots(tab->steps);
+}
+
+int cp_bgn_tab_write(uint8_t *bin, int len, bgn_tab_t tab) {
+	int k, l = bgn_elm(tab->grp), result = RLC_OK;
+	size_t j, slots = bgn_slots(tab->steps);
+	uint8_t *ptr;
+
+	if (tab->tab == NULL || len < cp_bgn_tab_size(tab)) {
+		return RLC_ERR;
+	}
+
+	TRY {
+		bin[0] = (uint8_t)tab->grp;
+		for (k = 0; k < 8; k++) {
+			bin[1 + k] = (uint8_t)((uint64_t)tab->steps >> (56 - 8 * k));
+			bin[9 + k] = (uint8_t)((uint64_t)tab->giants >> (56 - 8 * k));
+		}
+		ptr = bin + BGN_HEAD;
+		switch (tab->grp) {
+			case 1:
+				g1_write_bin(ptr, l, tab->u1, 0);
+				g1_write_bin(ptr + l, l, tab->v1, 0);
+				break;
+			case 2:
+				g2_write_bin(ptr, l, tab->u2, 0);
+				g2_write_bin(ptr + l, l, tab->v2, 0);
+				break;
+			default:
+				gt_write_bin(ptr, l, tab->ut, 0);
+				gt_write_bin(ptr + l, l, tab->vt, 0);
+				break;
+		}
+		ptr += 2 * l;
+		for (j = 0; j < slots; j++) {
+			for (k = 0; k < 8; k++) {
+				ptr[8 * j + k] = (uint8_t)(tab->tab[j] >> (56 - 8 * k));
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	return result;
+}
+
+int cp_bgn_tab_read(bgn_tab_t tab, const uint8_t *bin, int len) {
+	int k, l, result = RLC_OK;
+	uint64_t steps = 0, giants = 0;
+	size_t j, slots;
+	const uint8_t *ptr;
+
+	if (len < BGN_HEAD || bin[0] < 1 || bin[0] > 3) {
+		return RLC_ERR;
+	}
+	for (k = 0; k < 8; k++) {
+		steps = (steps << 8) | bin[1 + k];
+		giants = (giants << 8) | bin[9 + k];
+	}
+	if (steps < 2 || steps > BGN_STEPS || giants == 0 ||
+			(dig_t)steps != steps || (dig_t)giants != giants) {
+		return RLC_ERR;
+	}
+	l = bgn_elm(bin[0]);
+	slots = bgn_slots(steps);
+	if ((size_t)len != BGN_HEAD + 2 * l + 8 * slots) {
+		return RLC_ERR;
+	}
+
+	TRY {
+		free(tab->tab);
+		tab->tab = (uint64_t *)calloc(slots, sizeof(uint64_t));
+		if (tab->tab == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		tab->grp = bin[0];
+		tab->steps = steps;
+		tab->giants = giants;
+		ptr = bin + BGN_HEAD;
+		switch (tab->grp) {
+			case 1:
+				g1_read_bin(tab->u1, ptr, l);
+				g1_read_bin(tab->v1, ptr + l, l);
+				break;
+			case 2:
+				g2_read_bin(tab->u2, ptr, l);
+				g2_read_bin(tab->v2, ptr + l, l);
+				break;
+			default:
+				gt_read_bin(tab->ut, ptr, l);
+				gt_read_bin(tab->vt, ptr + l, l);
+				break;
+		}
+		ptr += 2 * l;
+		for (j = 0; j < slots; j++) {
+			for (k = 0; k < 8; k++) {
+				tab->tab[j] = (tab->tab[j] << 8) | ptr[8 * j + k];
+			}
+			if ((tab->tab[j] & 0xFFFFFFFF) >= steps) {
+				THROW(ERR_NO_VALID);
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	return result;
+}
+
+int cp_bgn_dec1_tab(dig_t *out, g1_t in[2], bgn_t prv, bgn_tab_t tab) {
+	return cp_bgn_dec1_batch(out, (g1_t (*)[2])in, 1, prv, tab);
+}
+
+int cp_bgn_dec2_tab(dig_t *out, g2_t in[2], bgn_t prv, bgn_tab_t tab) {
+	return cp_bgn_dec2_batch(out, (g2_t (*)[2])in, 1, prv, tab);
+}
+
+int cp_bgn_dec_tab(dig_t *out, gt_t in[4], bgn_t prv, bgn_tab_t tab) {
+	return cp_bgn_dec_batch(out, (gt_t (*)[4])in, 1, prv, tab);
+}
+
+int cp_bgn_dec1_batch(dig_t *out, g1_t in[][2], int n, bgn_t prv,
+		bgn_tab_t tab) {
+	int k, result = RLC_OK;
+	g1_t *t = NULL;
+
+	if (n <= 0 || tab->grp != 1 || tab->tab == NULL) {
+		return RLC_ERR;
+	}
+
+	TRY {
+		t = (g1_t *)calloc(n, sizeof(g1_t));
+		if (t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (k = 0; k < n; k++) {
+			g1_null(t[k]);
+			g1_new(t[k]);
+			/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
+			g1_mul(t[k], in[k][0], prv->x);
+			g1_sub(t[k], t[k], in[k][1]);
+			g1_norm(t[k], t[k]);
+		}
+		result = bgn_log1(out, t, n, tab);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		for (k = 0; t != NULL && k < n; k++) {
+			g1_free(t[k]);
+		}
+		free(t);
+	}
+
+	return result;
+}
+
+int cp_bgn_dec2_batch(dig_t *out, g2_t in[][2], int n, bgn_t prv,
+		bgn_tab_t tab) {
+	int k, result = RLC_OK;
+	g2_t *t = NULL;
+
+	if (n <= 0 || tab->grp != 2 || tab->tab == NULL) {
+		return RLC_ERR;
+	}
+
+	TRY {
+		t = (g2_t *)calloc(n, sizeof(g2_t));
+		if (t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (k = 0; k < n; k++) {
+			g2_null(t[k]);
+			g2_new(t[k]);
+			/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
+			g2_mul(t[k], in[k][0], prv->x);
+			g2_sub(t[k], t[k], in[k][1]);
+			g2_norm(t[k], t[k]);
+		}
+		result = bgn_log2(out, t, n, tab);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		for (k = 0; t != NULL && k < n; k++) {
+			g2_free(t[k]);
+		}
+		free(t);
+	}
+
+	return result;
+}
+
+int cp_bgn_dec_batch(dig_t *out, gt_t in[][4], int n, bgn_t prv,
+		bgn_tab_t tab) {
+	int k, result = RLC_OK;
+	gt_t *t = NULL, u;
+
+	if (n <= 0 || tab->grp != 3 || tab->tab == NULL) {
+		return RLC_ERR;
+	}
+
+	gt_null(u);
+
+	TRY {
+		gt_new(u);
+		t = (gt_t *)calloc(n, sizeof(gt_t));
+		if (t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (k = 0; k < n; k++) {
+			gt_null(t[k]);
+			gt_new(t[k]);
+			/* Compute T = c3 * (c1 * c2)^(-x) * c0^(x^2). */
+			gt_exp(t[k], in[k][0], prv->x);
+			gt_exp(t[k], t[k], prv->x);
+			gt_mul(u, in[k][1], in[k][2]);
+			gt_exp(u, u, prv->x);
+			gt_inv(u, u);
+			gt_mul(t[k], t[k], u);
+			gt_mul(t[k], t[k], in[k][3]);
+		}
+		result = bgn_logt(out, t, n, tab);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		gt_free(u);
+		for (k = 0; t != NULL && k < n; k++) {
+			gt_free(t[k]);
+		}
+		free(t);
+	}
+
+	return result;
+}
@@ -31,6 +31,15 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Length in bits of the random exponents used in batch verification.
+ */
+#define BLS_BATCH_BITS		64
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -119,3 +128,107 @@ int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q) {
 	}
 	return result;
 }
+
+int cp_bls_agg_sig(g1_t s, g1_t *sig, int n) {
+	g1_set_infty(s);
+	for (int i = 0; i < n; i++) {
+		g1_add(s, s, sig[i]);
+	}
+	g1_norm(s, s);
+	return RLC_OK;
+}
+
+int cp_bls_agg_key(g2_t q, g2_t *key, int n) {
+	g2_set_infty(q);
+	for (int i = 0; i < n; i++) {
+		g2_add(q, q, key[i]);
+	}
+	g2_norm(q, q);
+	return RLC_OK;
+}
+
+int cp_bls_ver_batch(int *b, g1_t *s, uint8_t **msg, int *len, g2_t *q,
+		int n) {
+	g1_t *p = NULL;
+	g2_t *r = NULL;
+	bn_t *k = NULL;
+	gt_t e;
+	int i, result = 0;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	gt_null(e);
+
+	TRY {
+		gt_new(e);
+		p = (g1_t *)calloc(n + 1, sizeof(g1_t));
+		r = (g2_t *)calloc(n + 1, sizeof(g2_t));
+		k = (bn_t *)calloc(n, sizeof(bn_t));
+		if (p == NULL || r == NULL || k == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i <= n; i++) {
+			g1_null(p[i]);
+			g2_null(r[i]);
+			g1_new(p[i]);
+			g2_new(r[i]);
+		}
+		for (i = 0; i < n; i++) {
+			bn_null(k[i]);
+			bn_new(k[i]);
+		}
+
+		/* Check prod e(k_i * H(m_i), q_i) * e(sum k_i * s_i, -g) = 1. */
+		for (i = 0; i < n; i++) {
+			do {
+				bn_rand(k[i], RLC_POS, BLS_BATCH_BITS);
+			} while (bn_is_zero(k[i]));
+			g1_map(p[i], msg[i], len[i]);
+			g1_mul(p[i], p[i], k[i]);
+			g2_copy(r[i], q[i]);
+		}
+		g1_mul_sim_lot(p[n], (const g1_t *)s, (const bn_t *)k, n);
+		g2_get_gen(r[n]);
+		g2_neg(r[n], r[n]);
+
+		pc_map_sim_lot(e, p, r, n + 1);
+		if (gt_is_unity(e)) {
+			result = 1;
+			if (b != NULL) {
+				for (i = 0; i < n; i++) {
+					b[i] = 1;
+				}
+			}
+		} else if (b != NULL) {
+			/* Identify the invalid signatures one by one. */
+			for (i = 0; i < n; i++) {
+				b[i] = cp_bls_ver(s[i], msg[i], len[i], q[i]);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		gt_free(e);
+		for (i = 0; i <= n; i++) {
+			if (p != NULL) {
+				g1_free(p[i]);
+			}
+			if (r != NULL) {
+				g2_free(r[i]);
+			}
+		}
+		if (k != NULL) {
+			for (i = 0; i < n; i++) {
+				bn_free(k[i]);
+			}
+		}
+		free(p);
+		free(r);
+		free(k);
+	}
+	return result;
+}
@@ -32,6 +32,41 @@
 #include "relic.h"
 #include "relic_test.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Length in bits of the random multipliers used in batch verification.
+ */
+#define ECDSA_BATCH_BITS	128
+
+/**
+ * Converts a message to an integer with the bit length of the curve order.
+ *
+ * @param[out] e			- the resulting integer.
+ * @param[in] msg			- the message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] hash			- the flag to indicate the message is a hash.
+ * @param[in] n				- the curve order.
+ */
+static void ecdsa_msg(bn_t e, uint8_t *msg, int len, int hash, bn_t n) {
+	uint8_t h[MD_LEN];
+
+	if (!hash) {
+		md_map(h, msg, len);
+		msg = h;
+		len = MD_LEN;
+	}
+	if (8 * len > bn_bits(n)) {
+		len = RLC_CEIL(bn_bits(n), 8);
+		bn_read_bin(e, msg, len);
+		bn_rsh(e, e, 8 * len - bn_bits(n));
+	} else {
+		bn_read_bin(e, msg, len);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -62,7 +97,6 @@ int cp_ecdsa_gen(bn_t d, ec_t q) {
 int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 	bn_t n, k, x, e;
 	ec_t p;
-	uint8_t h[MD_LEN];
 	int result = RLC_OK;
 
 	bn_null(n);
@@ -79,6 +113,7 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 		ec_new(p);
 
 		ec_curve_get_ord(n);
+		ecdsa_msg(e, msg, len, hash, n);
 		do {
 			do {
 				bn_rand_mod(k, n);
@@ -87,27 +122,11 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 				bn_mod(r, x, n);
 			} while (bn_is_zero(r));
 
-			if (!hash) {
-				md_map(h, msg, len);
-				msg = h;
-				len = MD_LEN;
-			}
-			if (8 * len > bn_bits(n)) {
-				len = RLC_CEIL(bn_bits(n), 8);
-				bn_read_bin(e, msg, len);
-				bn_rsh(e, e, 8 * len - bn_bits(n));
-			} else {
-				bn_read_bin(e, msg, len);
-			}
-
 			bn_mul(s, d, r);
 			bn_mod(s, s, n);
 			bn_add(s, s, e);
 			bn_mod(s, s, n);
-			bn_gcd_ext(x, k, NULL, k, n);
-			if (bn_sign(k) == RLC_NEG) {
-				bn_add(k, k, n);
-			}
+			bn_mod_inv(k, k, n);
 			bn_mul(s, s, k);
 			bn_mod(s, s, n);
 		} while (bn_is_zero(s));
@@ -128,7 +147,6 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 	bn_t n, k, e, v;
 	ec_t p;
-	uint8_t h[MD_LEN];
 	int result = 0;
 
 	bn_null(n);
@@ -154,18 +172,7 @@ int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 					bn_add(k, k, n);
 				}
 
-				if (!hash) {
-					md_map(h, msg, len);
-					msg = h;
-					len = MD_LEN;
-				}
-				if (8 * len > bn_bits(n)) {
-					len = RLC_CEIL(bn_bits(n), 8);
-					bn_read_bin(e, msg, len);
-					bn_rsh(e, e, 8 * len - bn_bits(n));
-				} else {
-					bn_read_bin(e, msg, len);
-				}
+				ecdsa_msg(e, msg, len, hash, n);
 
 				bn_mul(e, e, k);
 				bn_mod(e, e, n);
@@ -202,3 +209,176 @@ int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 	}
 	return result;
 }
+
+int cp_ecdsa_ver_batch(int *b, bn_t *r, bn_t *s, int *v, uint8_t **msg,
+		int *len, int hash, ec_t *q, int n) {
+	bn_t ord, a, t, *u = NULL, *w = NULL, *k = NULL;
+	ec_t g, *p = NULL;
+	int i, m = 0, result = 1, *c = NULL;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	bn_null(ord);
+	bn_null(a);
+	bn_null(t);
+	ec_null(g);
+
+	TRY {
+		bn_new(ord);
+		bn_new(a);
+		bn_new(t);
+		ec_new(g);
+		u = (bn_t *)calloc(n, sizeof(bn_t));
+		w = (bn_t *)calloc(n, sizeof(bn_t));
+		k = (bn_t *)calloc(2 * n + 1, sizeof(bn_t));
+		p = (ec_t *)calloc(2 * n + 1, sizeof(ec_t));
+		c = (int *)malloc(n * sizeof(int));
+		if (u == NULL || w == NULL || k == NULL || p == NULL || c == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			bn_null(u[i]);
+			bn_null(w[i]);
+			bn_new(u[i]);
+			bn_new(w[i]);
+		}
+		for (i = 0; i <= 2 * n; i++) {
+			bn_null(k[i]);
+			ec_null(p[i]);
+			bn_new(k[i]);
+			ec_new(p[i]);
+		}
+
+		ec_curve_get_ord(ord);
+
+		/* State of each signature: 0 = invalid, 1 = valid, 2 = to check
+		 * individually, 3 = checked in the batch. */
+		for (i = 0; i < n; i++) {
+			c[i] = 2;
+			if (bn_sign(r[i]) != RLC_POS || bn_sign(s[i]) != RLC_POS ||
+					bn_is_zero(r[i]) || bn_is_zero(s[i]) ||
+					bn_cmp(r[i], ord) != RLC_LT || bn_cmp(s[i], ord) != RLC_LT) {
+				c[i] = 0;
+			}
+		}
+
+		/* Invert all s_i at once with Montgomery's trick. */
+		bn_set_dig(t, 1);
+		for (i = 0; i < n; i++) {
+			if (c[i]) {
+				bn_mul(t, t, s[i]);
+				bn_mod(t, t, ord);
+			}
+			bn_copy(w[i], t);
+		}
+		bn_gcd_ext(a, t, NULL, t, ord);
+		if (bn_sign(t) == RLC_NEG) {
+			bn_add(t, t, ord);
+		}
+		for (i = n - 1; i >= 0; i--) {
+			if (c[i]) {
+				/* w_i = (s_0 * ... * s_{i - 1}) / (s_0 * ... * s_i). */
+				if (i > 0) {
+					bn_mul(w[i], w[i - 1], t);
+					bn_mod(w[i], w[i], ord);
+				} else {
+					bn_copy(w[i], t);
+				}
+				bn_mul(t, t, s[i]);
+				bn_mod(t, t, ord);
+			}
+		}
+
+		/* Compute u_i = e_i / s_i and w_i = r_i / s_i. */
+		for (i = 0; i < n; i++) {
+			if (c[i]) {
+				ecdsa_msg(t, msg[i], len[i], hash, ord);
+				bn_mul(u[i], t, w[i]);
+				bn_mod(u[i], u[i], ord);
+				bn_mul(w[i], r[i], w[i]);
+				bn_mod(w[i], w[i], ord);
+			}
+		}
+
+#if EC_CUR == PRIME
+		if (v != NULL) {
+			/* Check sum a_i * (u_i * G + w_i * Q_i - R_i) = O at once. */
+			bn_zero(k[0]);
+			m = 1;
+			for (i = 0; i < n; i++) {
+				if (c[i] && ep_upk_x(p[m], r[i], v[i])) {
+					do {
+						bn_rand(a, RLC_POS, ECDSA_BATCH_BITS);
+						bn_mod(a, a, ord);
+					} while (bn_is_zero(a));
+					bn_mul(t, a, u[i]);
+					bn_add(k[0], k[0], t);
+					bn_mod(k[0], k[0], ord);
+					bn_sub(k[m], ord, a);
+					bn_mul(k[m + 1], a, w[i]);
+					bn_mod(k[m + 1], k[m + 1], ord);
+					ec_copy(p[m + 1], q[i]);
+					m += 2;
+					c[i] = 3;
+				}
+			}
+			if (m > 1) {
+				ec_curve_get_gen(p[0]);
+				ec_mul_sim_lot(g, (const ec_t *)p, (const bn_t *)k, m);
+				for (i = 0; i < n; i++) {
+					if (c[i] == 3) {
+						c[i] = (ec_is_infty(g) ? 1 : 2);
+					}
+				}
+			}
+		}
+#endif
+
+		/* Verify the remaining signatures one by one. */
+		for (i = 0; i < n; i++) {
+			if (c[i] == 2) {
+				ec_mul_sim_gen(g, u[i], q[i], w[i]);
+				ec_get_x(t, g);
+				bn_mod(t, t, ord);
+				c[i] = (!ec_is_infty(g) && bn_cmp(t, r[i]) == RLC_EQ);
+			}
+			if (b != NULL) {
+				b[i] = c[i];
+			}
+			result &= c[i];
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(ord);
+		bn_free(a);
+		bn_free(t);
+		ec_free(g);
+		for (i = 0; i < n; i++) {
+			if (u != NULL) {
+				bn_free(u[i]);
+			}
+			if (w != NULL) {
+				bn_free(w[i]);
+			}
+		}
+		for (i = 0; i <= 2 * n; i++) {
+			if (k != NULL) {
+				bn_free(k[i]);
+			}
+			if (p != NULL) {
+				ec_free(p[i]);
+			}
+		}
+		free(u);
+		free(w);
+		free(k);
+		free(p);
+		free(c);
+	}
+	return result;
+}
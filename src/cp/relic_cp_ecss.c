@@ -32,6 +32,44 @@
 #include "relic.h"
 #include "relic_test.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Length in bits of the random multipliers used in batch verification.
+ */
+#define ECSS_BATCH_BITS		128
+
+/**
+ * Hashes a message and the x-coordinate of the commitment to an integer
+ * modulo the curve order.
+ *
+ * @param[out] e			- the resulting integer.
+ * @param[in] msg			- the message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] r				- the x-coordinate of the commitment.
+ * @param[in] n				- the curve order.
+ */
+static void ecss_hash(bn_t e, uint8_t *msg, int len, bn_t r, bn_t n) {
+	uint8_t hash[MD_LEN];
+	uint8_t m[len + FC_BYTES];
+
+	memcpy(m, msg, len);
+	bn_write_bin(m + len, FC_BYTES, r);
+	md_map(hash, m, len + FC_BYTES);
+
+	if (8 * MD_LEN > bn_bits(n)) {
+		len = RLC_CEIL(bn_bits(n), 8);
+		bn_read_bin(e, hash, len);
+		bn_rsh(e, e, 8 * MD_LEN - bn_bits(n));
+	} else {
+		bn_read_bin(e, hash, MD_LEN);
+	}
+
+	bn_mod(e, e, n);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -61,8 +99,6 @@ int cp_ecss_gen(bn_t d, ec_t q) {
 int cp_ecss_sig(bn_t e, bn_t s, uint8_t *msg, int len, bn_t d) {
 	bn_t n, k, x, r;
 	ec_t p;
-	uint8_t hash[MD_LEN];
-	uint8_t m[len + FC_BYTES];
 	int result = RLC_OK;
 
 	bn_null(n);
@@ -86,19 +122,7 @@ int cp_ecss_sig(bn_t e, bn_t s, uint8_t *msg, int len, bn_t d) {
 			bn_mod(r, x, n);
 		} while (bn_is_zero(r));
 
-		memcpy(m, msg, len);
-		bn_write_bin(m + len, FC_BYTES, r);
-		md_map(hash, m, len + FC_BYTES);
-
-		if (8 * MD_LEN > bn_bits(n)) {
-			len = RLC_CEIL(bn_bits(n), 8);
-			bn_read_bin(e, hash, len);
-			bn_rsh(e, e, 8 * MD_LEN - bn_bits(n));
-		} else {
-			bn_read_bin(e, hash, MD_LEN);
-		}
-
-		bn_mod(e, e, n);
+		ecss_hash(e, msg, len, r, n);
 
 		bn_mul(s, d, e);
 		bn_mod(s, s, n);
@@ -122,8 +146,6 @@ int cp_ecss_sig(bn_t e, bn_t s, uint8_t *msg, int len, bn_t d) {
 int cp_ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q) {
 	bn_t n, ev, rv;
 	ec_t p;
-	uint8_t hash[MD_LEN];
-	uint8_t m[len + FC_BYTES];
 	int result = 0;
 
 	bn_null(n);
@@ -146,19 +168,7 @@ int cp_ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q) {
 
 				bn_mod(rv, rv, n);
 
-				memcpy(m, msg, len);
-				bn_write_bin(m + len, FC_BYTES, rv);
-				md_map(hash, m, len + FC_BYTES);
-
-				if (8 * MD_LEN > bn_bits(n)) {
-					len = RLC_CEIL(bn_bits(n), 8);
-					bn_read_bin(ev, hash, len);
-					bn_rsh(ev, ev, 8 * MD_LEN - bn_bits(n));
-				} else {
-					bn_read_bin(ev, hash, MD_LEN);
-				}
-
-				bn_mod(ev, ev, n);
+				ecss_hash(ev, msg, len, rv, n);
 
 				result = dv_cmp_const(ev->dp, e->dp, RLC_MIN(ev->used, e->used));
 				result = (result == RLC_NE ? 0 : 1);
@@ -181,3 +191,122 @@ int cp_ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q) {
 	return result;
 }
 
+int cp_ecss_ver_batch(int *b, bn_t *e, bn_t *s, bn_t *r, int *v, uint8_t **msg,
+		int *len, ec_t *q, int n) {
+	bn_t ord, a, t, *k = NULL;
+	ec_t g, *p = NULL;
+	int i, m = 0, result = 1, *c = NULL;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	bn_null(ord);
+	bn_null(a);
+	bn_null(t);
+	ec_null(g);
+
+	TRY {
+		bn_new(ord);
+		bn_new(a);
+		bn_new(t);
+		ec_new(g);
+		k = (bn_t *)calloc(2 * n + 1, sizeof(bn_t));
+		p = (ec_t *)calloc(2 * n + 1, sizeof(ec_t));
+		c = (int *)malloc(n * sizeof(int));
+		if (k == NULL || p == NULL || c == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i <= 2 * n; i++) {
+			bn_null(k[i]);
+			ec_null(p[i]);
+			bn_new(k[i]);
+			ec_new(p[i]);
+		}
+
+		ec_curve_get_ord(ord);
+
+		/* State of each signature: 0 = invalid, 1 = valid, 2 = to check
+		 * individually, 3 = checked in the batch. */
+		for (i = 0; i < n; i++) {
+			c[i] = 2;
+			if (bn_sign(e[i]) != RLC_POS || bn_sign(s[i]) != RLC_POS ||
+					bn_is_zero(s[i]) || bn_cmp(e[i], ord) != RLC_LT ||
+					bn_cmp(s[i], ord) != RLC_LT) {
+				c[i] = 0;
+			}
+		}
+
+#if EC_CUR == PRIME
+		if (r != NULL && v != NULL) {
+			/* Check sum a_i * (s_i * G + e_i * Q_i - R_i) = O at once. */
+			bn_zero(k[0]);
+			m = 1;
+			for (i = 0; i < n; i++) {
+				if (c[i] == 0 || bn_sign(r[i]) != RLC_POS ||
+						bn_cmp(r[i], ord) != RLC_LT) {
+					continue;
+				}
+				ecss_hash(t, msg[i], len[i], r[i], ord);
+				if (bn_cmp(t, e[i]) == RLC_EQ &&
+						ep_upk_x(p[m], r[i], v[i])) {
+					do {
+						bn_rand(a, RLC_POS, ECSS_BATCH_BITS);
+						bn_mod(a, a, ord);
+					} while (bn_is_zero(a));
+					bn_mul(t, a, s[i]);
+					bn_add(k[0], k[0], t);
+					bn_mod(k[0], k[0], ord);
+					bn_sub(k[m], ord, a);
+					bn_mul(k[m + 1], a, e[i]);
+					bn_mod(k[m + 1], k[m + 1], ord);
+					ec_copy(p[m + 1], q[i]);
+					m += 2;
+					c[i] = 3;
+				}
+			}
+			if (m > 1) {
+				ec_curve_get_gen(p[0]);
+				ec_mul_sim_lot(g, (const ec_t *)p, (const bn_t *)k, m);
+				for (i = 0; i < n; i++) {
+					if (c[i] == 3) {
+						c[i] = (ec_is_infty(g) ? 1 : 2);
+					}
+				}
+			}
+		}
+#endif
+
+		/* Verify the remaining signatures one by one. */
+		for (i = 0; i < n; i++) {
+			if (c[i] == 2) {
+				c[i] = cp_ecss_ver(e[i], s[i], msg[i], len[i], q[i]);
+			}
+			if (b != NULL) {
+				b[i] = c[i];
+			}
+			result &= c[i];
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(ord);
+		bn_free(a);
+		bn_free(t);
+		ec_free(g);
+		for (i = 0; i <= 2 * n; i++) {
+			if (k != NULL) {
+				bn_free(k[i]);
+			}
+			if (p != NULL) {
+				ec_free(p[i]);
+			}
+		}
+		free(k);
+		free(p);
+		free(c);
+	}
+	return result;
+}
@@ -39,6 +39,97 @@
 #include "relic_cp.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Multiplies two integers modulo the square of the modulus of a Paillier key,
+ * replacing the division by two Montgomery reductions if the Montgomery
+ * context matches the modulus and both operands are reduced.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first integer to multiply.
+ * @param[in] b				- the second integer to multiply.
+ * @param[in] m				- the modulus.
+ * @param[in] mon			- the Montgomery context.
+ */
+static void phpe_mul_mod(bn_t c, const bn_t a, const bn_t b, const bn_t m,
+		const bn_mon_t mon) {
+	if (bn_mon_is(mon, m) && bn_sign(a) == RLC_POS && bn_sign(b) == RLC_POS &&
+			bn_cmp(a, m) == RLC_LT && bn_cmp(b, m) == RLC_LT) {
+		bn_mul_mon(c, a, b, mon);
+		bn_mul_mon(c, c, mon->r2, mon);
+	} else {
+		bn_mul(c, a, b);
+		bn_mod(c, c, m);
+	}
+}
+
+/**
+ * Computes a randomizer r^n mod n^2 for a random r in Z_n^*.
+ *
+ * @param[out] r			- the randomizer.
+ * @param[in] pub			- the public key.
+ */
+static void phpe_rand(bn_t r, phpe_t pub) {
+	bn_t t;
+
+	bn_null(t);
+
+	TRY {
+		bn_new(t);
+
+		do {
+			bn_rand_mod(r, pub->n);
+			bn_gcd(t, r, pub->n);
+		} while (bn_cmp_dig(t, 1) != RLC_EQ);
+		bn_mxp_ctx(r, r, pub->n, pub->n2, pub->mn2);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+	}
+}
+
+/**
+ * Decrypts a ciphertext modulo one of the primes, computing
+ * L_p(c^(p-1) mod p^2) * h_p mod p.
+ *
+ * @param[out] m			- the plaintext modulo the prime.
+ * @param[in] c				- the ciphertext.
+ * @param[in] p				- the prime.
+ * @param[in] p2			- the square of the prime.
+ * @param[in] h				- the precomputed constant for the prime.
+ * @param[in] mon			- the Montgomery context for the square of the prime.
+ */
+static void phpe_dec_crt(bn_t m, const bn_t c, const bn_t p, const bn_t p2,
+		const bn_t h, const bn_mon_t mon) {
+	bn_t e;
+
+	bn_null(e);
+
+	TRY {
+		bn_new(e);
+
+		bn_sub_dig(e, p, 1);
+		bn_mod(m, c, p2);
+		bn_mxp_ctx(m, m, e, p2, mon);
+		bn_sub_dig(m, m, 1);
+		bn_div(m, m, p);
+		bn_mul(m, m, h);
+		bn_mod(m, m, p);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(e);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -78,10 +169,9 @@ int cp_phpe_gen(bn_t n, bn_t l, int bits) {
 }
 
 int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n) {
-	bn_t g, m, r, s;
+	bn_t m, r, s;
 	int size, result = RLC_OK;
 
-	bn_null(g);
 	bn_null(m);
 	bn_null(r);
 	bn_null(s);
@@ -93,7 +183,6 @@ int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n) {
 	}
 
 	TRY {
-		bn_new(g);
 		bn_new(m);
 		bn_new(r);
 		bn_new(s);
@@ -104,10 +193,11 @@ int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n) {
 		/* Generate r in Z_n^*. */
 		bn_rand_mod(r, n);
 
-		/* Compute c = (g^m)(r^n) mod n^2. */
-		bn_add_dig(g, n, 1);
+		/* Compute c = (g^m)(r^n) mod n^2, where g^m = 1 + mn for g = n + 1. */
 		bn_sqr(s, n);
-		bn_mxp(m, g, m, s);
+		bn_mul(m, m, n);
+		bn_add_dig(m, m, 1);
+		bn_mod(m, m, s);
 		bn_mxp(r, r, n, s);
 		bn_mul(m, m, r);
 		bn_mod(m, m, s);
@@ -123,7 +213,6 @@ int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n) {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(g);
 		bn_free(m);
 		bn_free(r);
 		bn_free(s);
@@ -183,3 +272,278 @@ int cp_phpe_dec(uint8_t *out, int out_len, uint8_t *in, int in_len, bn_t n,
 
 	return result;
 }
+
+int cp_phpe_gen_key(phpe_t pub, phpe_t prv, int bits) {
+	bn_t t, u;
+	int result = RLC_OK;
+
+	bn_null(t);
+	bn_null(u);
+
+	TRY {
+		bn_new(t);
+		bn_new(u);
+
+		/* Generate primes p and q of equivalent length. */
+		do {
+			bn_gen_prime(prv->p, bits / 2);
+			bn_gen_prime(prv->q, bits / 2);
+		} while (bn_cmp(prv->p, prv->q) == RLC_EQ);
+
+		/* Compute n = pq and the squares of n, p and q. */
+		bn_mul(prv->n, prv->p, prv->q);
+		bn_sqr(prv->n2, prv->n);
+		bn_sqr(prv->p2, prv->p);
+		bn_sqr(prv->q2, prv->q);
+
+		/* Compute h_p = L_p(g^(p-1) mod p^2)^(-1) mod p for g = n + 1, where
+		 * g^(p-1) = 1 + (p-1)n mod p^2 and thus L_p(.) = -q mod p. */
+		bn_mod(t, prv->q, prv->p);
+		bn_sub(t, prv->p, t);
+		bn_gcd_ext(u, prv->hp, NULL, t, prv->p);
+		if (bn_sign(prv->hp) == RLC_NEG) {
+			bn_add(prv->hp, prv->hp, prv->p);
+		}
+		bn_mod(t, prv->p, prv->q);
+		bn_sub(t, prv->q, t);
+		bn_gcd_ext(u, prv->hq, NULL, t, prv->q);
+		if (bn_sign(prv->hq) == RLC_NEG) {
+			bn_add(prv->hq, prv->hq, prv->q);
+		}
+
+		/* qInv = q^(-1) mod p. */
+		bn_gcd_ext(u, prv->qi, NULL, prv->q, prv->p);
+		if (bn_sign(prv->qi) == RLC_NEG) {
+			bn_add(prv->qi, prv->qi, prv->p);
+		}
+
+		bn_copy(pub->n, prv->n);
+		bn_copy(pub->n2, prv->n2);
+		bn_mon_set(pub->mn2, pub->n2);
+		bn_mon_set(prv->mn2, prv->n2);
+		bn_mon_set(prv->mp2, prv->p2);
+		bn_mon_set(prv->mq2, prv->q2);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(u);
+	}
+
+	return result;
+}
+
+int cp_phpe_pre(phpe_t pub, int len) {
+	int i, size, result = RLC_OK;
+	uint8_t *pool;
+	bn_t r;
+
+	TRY {
+		if (!bn_mon_is(pub->mn2, pub->n2)) {
+			bn_mon_set(pub->mn2, pub->n2);
+		}
+		if (!bn_is_zero(pub->p2) && !bn_mon_is(pub->mp2, pub->p2)) {
+			bn_mon_set(pub->mp2, pub->p2);
+			bn_mon_set(pub->mq2, pub->q2);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	if (result != RLC_OK || len <= pub->pool_len) {
+		return result;
+	}
+
+	size = bn_size_bin(pub->n2);
+	pool = (uint8_t *)realloc(pub->pool, (size_t)len * size);
+	if (pool == NULL) {
+		return RLC_ERR;
+	}
+	pub->pool = pool;
+
+	bn_null(r);
+
+	TRY {
+		bn_new(r);
+
+		for (i = pub->pool_len; i < len; i++) {
+			phpe_rand(r, pub);
+			bn_write_bin(pub->pool + (size_t)i * size, size, r);
+			pub->pool_len = i + 1;
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(r);
+	}
+
+	return result;
+}
+
+int cp_phpe_enc_key(bn_t c, const bn_t m, phpe_t pub) {
+	int size, result = RLC_OK;
+	bn_t r, t;
+
+	if (bn_sign(m) == RLC_NEG || bn_cmp(m, pub->n) != RLC_LT) {
+		return RLC_ERR;
+	}
+
+	bn_null(r);
+	bn_null(t);
+
+	TRY {
+		bn_new(r);
+		bn_new(t);
+
+		/* Take r^n mod n^2 from the pool or compute it now. */
+		if (pub->pool_len > 0) {
+			size = bn_size_bin(pub->n2);
+			pub->pool_len--;
+			bn_read_bin(r, pub->pool + (size_t)pub->pool_len * size, size);
+			memset(pub->pool + (size_t)pub->pool_len * size, 0, size);
+		} else {
+			phpe_rand(r, pub);
+		}
+
+		/* Compute c = (1 + mn)(r^n) mod n^2, since g^m = 1 + mn for g = n + 1. */
+		bn_mul(t, m, pub->n);
+		bn_add_dig(t, t, 1);
+		phpe_mul_mod(c, t, r, pub->n2, pub->mn2);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(r);
+		bn_free(t);
+	}
+
+	return result;
+}
+
+int cp_phpe_dec_key(bn_t m, const bn_t c, phpe_t prv) {
+	int result = RLC_OK;
+	bn_t mp, mq;
+
+	if (bn_sign(c) == RLC_NEG || bn_cmp(c, prv->n2) != RLC_LT) {
+		return RLC_ERR;
+	}
+
+	bn_null(mp);
+	bn_null(mq);
+
+	TRY {
+		bn_new(mp);
+		bn_new(mq);
+
+		/* Decrypt modulo p and q with exponents of half the size. */
+		phpe_dec_crt(mp, c, prv->p, prv->p2, prv->hp, prv->mp2);
+		phpe_dec_crt(mq, c, prv->q, prv->q2, prv->hq, prv->mq2);
+
+		/* m = mq + q * (qInv(mp - mq) mod p). */
+		bn_sub(mp, mp, mq);
+		while (bn_sign(mp) == RLC_NEG) {
+			bn_add(mp, mp, prv->p);
+		}
+		bn_mul(mp, mp, prv->qi);
+		bn_mod(mp, mp, prv->p);
+		bn_mul(mp, mp, prv->q);
+		bn_add(m, mp, mq);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(mp);
+		bn_free(mq);
+	}
+
+	return result;
+}
+
+int cp_phpe_add(bn_t c, const bn_t a, const bn_t b, phpe_t pub) {
+	int result = RLC_OK;
+
+	TRY {
+		phpe_mul_mod(c, a, b, pub->n2, pub->mn2);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	return result;
+}
+
+int cp_phpe_mul(bn_t c, const bn_t a, const bn_t k, phpe_t pub) {
+	int result = RLC_OK;
+
+	TRY {
+		bn_mxp_ctx(c, a, k, pub->n2, pub->mn2);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	return result;
+}
+
+int cp_phpe_add_batch(bn_t *c, bn_t *a, bn_t *b, int len, phpe_t pub) {
+	int result = RLC_OK;
+	bn_mon_st *mn2 = pub->mn2;
+	bn_mon_t mon;
+
+	bn_mon_null(mon);
+
+	TRY {
+		bn_mon_new(mon);
+		/* Build a Montgomery context once for the batch if the key has none. */
+		if (!bn_mon_is(mn2, pub->n2)) {
+			bn_mon_set(mon, pub->n2);
+			mn2 = mon;
+		}
+		for (int i = 0; i < len; i++) {
+			phpe_mul_mod(c[i], a[i], b[i], pub->n2, mn2);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_mon_free(mon);
+	}
+
+	return result;
+}
+
+int cp_phpe_mul_batch(bn_t *c, bn_t *a, bn_t *k, int len, phpe_t pub) {
+	int result = RLC_OK;
+	bn_mon_st *mn2 = pub->mn2;
+	bn_mon_t mon;
+
+	bn_mon_null(mon);
+
+	TRY {
+		bn_mon_new(mon);
+		/* Build a Montgomery context once for the batch if the key has none. */
+		if (!bn_mon_is(mn2, pub->n2)) {
+			bn_mon_set(mon, pub->n2);
+			mn2 = mon;
+		}
+		for (int i = 0; i < len; i++) {
+			bn_mxp_ctx(c[i], a[i], k[i], pub->n2, mn2);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_mon_free(mon);
+	}
+
+	return result;
+}
@@ -583,6 +583,301 @@ static int pad_pkcs2(bn_t m, int *p_len, int m_len, int k_len, int operation) {
 
 #endif
 
+/**
+ * Exponentiates many integers to the same exponent modulo one of the moduli of
+ * an RSA key, building the Montgomery context for the modulus only once.
+ *
+ * @param[out] c		- the results.
+ * @param[in] a			- the bases.
+ * @param[in] n			- the number of bases.
+ * @param[in] b			- the exponent.
+ * @param[in] m			- the modulus.
+ */
+static void rsa_mxp_batch(bn_t *c, bn_t *a, int n, const bn_t b, const bn_t m) {
+	bn_mon_t mon;
+
+	bn_mon_null(mon);
+
+	TRY {
+		bn_mon_new(mon);
+		bn_mon_set(mon, m);
+		for (int i = 0; i < n; i++) {
+			bn_mxp_ctx(c[i], a[i], b, m, mon);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_mon_free(mon);
+	}
+}
+
+/**
+ * Performs one step of Garner's recombination over the primes of an RSA
+ * private key, following the multi-prime method of PKCS#1 v2.2. Given c modulo
+ * r and m modulo a new prime p, computes c = c + r * (u * (m - c) mod p), so
+ * that c becomes the residue modulo r * p.
+ *
+ * @param[in,out] c		- the partial result.
+ * @param[in] r			- the product of the primes already combined.
+ * @param[in] m			- the residue modulo the new prime.
+ * @param[in] p			- the new prime.
+ * @param[in] u			- the inverse of r modulo the new prime.
+ */
+static void rsa_crt_add(bn_t c, bn_t r, const bn_t m, const bn_t p,
+		const bn_t u) {
+	bn_t t;
+
+	bn_null(t);
+
+	TRY {
+		bn_new(t);
+
+		bn_mod(t, c, p);
+		bn_sub(t, m, t);
+		if (bn_sign(t) == RLC_NEG) {
+			bn_add(t, t, p);
+		}
+		bn_mul(t, t, u);
+		bn_mod(t, t, p);
+		bn_mul(t, t, r);
+		bn_add(c, c, t);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+	}
+}
+
+/**
+ * Computes c = a^d mod n with the Chinese Remainder Theorem over the primes
+ * of an RSA private key.
+ *
+ * @param[out] c		- the result.
+ * @param[in] a			- the basis.
+ * @param[in] prv		- the private key.
+ */
+static void rsa_crt(bn_t c, const bn_t a, rsa_t prv) {
+	bn_t m, r, t;
+
+	bn_null(m);
+	bn_null(r);
+	bn_null(t);
+
+	TRY {
+		bn_new(m);
+		bn_new(r);
+		bn_new(t);
+
+		/* m2 = c^dQ mod q. */
+		bn_mxp(t, a, prv->dq, prv->q);
+		bn_copy(r, prv->q);
+		/* m1 = c^dP mod p, m = m2 + q * (qInv(m1 - m2) mod p). */
+		bn_mxp(m, a, prv->dp, prv->p);
+		rsa_crt_add(t, r, m, prv->p, prv->qi);
+		/* m_i = c^d_i mod r_i for the additional primes. */
+		for (int i = 0; i < RLC_RSA_PRIMES - 2 && !bn_is_zero(prv->r[i]); i++) {
+			bn_mul(r, r, i == 0 ? prv->p : prv->r[i - 1]);
+			bn_mxp(m, a, prv->dr[i], prv->r[i]);
+			rsa_crt_add(t, r, m, prv->r[i], prv->ri[i]);
+		}
+		bn_copy(c, t);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(m);
+		bn_free(r);
+		bn_free(t);
+	}
+}
+
+/**
+ * Computes c_i = a_i^d mod n for many integers with the Chinese Remainder
+ * Theorem, exponentiating all of them modulo one prime before the next.
+ *
+ * @param[out] c		- the results.
+ * @param[in] a			- the bases.
+ * @param[in] n			- the number of bases.
+ * @param[in] prv		- the private key.
+ */
+static void rsa_crt_batch(bn_t *c, bn_t *a, int n, rsa_t prv) {
+	bn_t *m = NULL, *t = NULL, r;
+	int i, j;
+
+	bn_null(r);
+
+	TRY {
+		bn_new(r);
+		m = (bn_t *)calloc(n, sizeof(bn_t));
+		t = (bn_t *)calloc(n, sizeof(bn_t));
+		if (m == NULL || t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			bn_null(m[i]);
+			bn_null(t[i]);
+			bn_new(m[i]);
+			bn_new(t[i]);
+		}
+
+		/* The results may alias the bases, so accumulate them apart. */
+		rsa_mxp_batch(t, a, n, prv->dq, prv->q);
+		bn_copy(r, prv->q);
+		rsa_mxp_batch(m, a, n, prv->dp, prv->p);
+		for (i = 0; i < n; i++) {
+			rsa_crt_add(t[i], r, m[i], prv->p, prv->qi);
+		}
+		for (j = 0; j < RLC_RSA_PRIMES - 2 && !bn_is_zero(prv->r[j]); j++) {
+			bn_mul(r, r, j == 0 ? prv->p : prv->r[j - 1]);
+			rsa_mxp_batch(m, a, n, prv->dr[j], prv->r[j]);
+			for (i = 0; i < n; i++) {
+				rsa_crt_add(t[i], r, m[i], prv->r[j], prv->ri[j]);
+			}
+		}
+		for (i = 0; i < n; i++) {
+			bn_copy(c[i], t[i]);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; m != NULL && i < n; i++) {
+			bn_free(m[i]);
+		}
+		for (i = 0; t != NULL && i < n; i++) {
+			bn_free(t[i]);
+		}
+		free(m);
+		free(t);
+		bn_free(r);
+	}
+}
+
+/**
+ * Pads a message for the CRT signature methods, hashing it first unless the
+ * flag says it is already a hash value.
+ *
+ * @param[out] eb		- the padded message.
+ * @param[in] msg		- the message to sign.
+ * @param[in] msg_len	- the number of bytes to sign.
+ * @param[in] hash		- the flag to indicate the message format.
+ * @param[in] prv		- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int rsa_sig_pad(bn_t eb, uint8_t *msg, int msg_len, int hash,
+		rsa_t prv) {
+	bn_t m;
+	int size, pad_len, result = RLC_OK;
+	uint8_t h[MD_LEN];
+
+	if (msg_len < 0) {
+		return RLC_ERR;
+	}
+
+	pad_len = (!hash ? MD_LEN : msg_len);
+
+#if CP_RSAPD == PKCS2
+	size = bn_bits(prv->n) - 1;
+	size = (size / 8) + (size % 8 > 0);
+	if (pad_len > (size - 2)) {
+		return RLC_ERR;
+	}
+#else
+	size = bn_size_bin(prv->n);
+	if (pad_len > (size - RSA_PAD_LEN)) {
+		return RLC_ERR;
+	}
+#endif
+
+	bn_null(m);
+
+	TRY {
+		bn_new(m);
+
+		bn_zero(m);
+		bn_zero(eb);
+
+		int operation = (!hash ? RSA_SIG : RSA_SIG_HASH);
+
+#if CP_RSAPD == BASIC
+		if (pad_basic(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
+#elif CP_RSAPD == PKCS1
+		if (pad_pkcs1(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
+#elif CP_RSAPD == PKCS2
+		if (pad_pkcs2(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
+#endif
+			if (!hash) {
+				md_map(h, msg, msg_len);
+				bn_read_bin(m, h, MD_LEN);
+				bn_add(eb, eb, m);
+			} else {
+				bn_read_bin(m, msg, msg_len);
+				bn_add(eb, eb, m);
+			}
+
+#if CP_RSAPD == PKCS2
+			pad_pkcs2(eb, &pad_len, bn_bits(prv->n), size, RSA_SIG_FIN);
+#endif
+		} else {
+			result = RLC_ERR;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(m);
+	}
+
+	return result;
+}
+
+/**
+ * Removes the padding of a message decrypted by the CRT decryption methods
+ * and writes it to the output buffer.
+ *
+ * @param[out] out		- the output buffer.
+ * @param[in, out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in,out] eb	- the decrypted message, unpadded on output.
+ * @param[in] prv		- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int rsa_dec_unpad(uint8_t *out, int *out_len, bn_t eb, rsa_t prv) {
+	int size, pad_len, result = RLC_OK;
+
+	size = bn_size_bin(prv->n);
+
+	if (bn_cmp(eb, prv->n) != RLC_LT) {
+		result = RLC_ERR;
+	}
+#if CP_RSAPD == BASIC
+	if (pad_basic(eb, &pad_len, size, size, RSA_DEC) == RLC_OK) {
+#elif CP_RSAPD == PKCS1
+	if (pad_pkcs1(eb, &pad_len, size, size, RSA_DEC) == RLC_OK) {
+#elif CP_RSAPD == PKCS2
+	if (pad_pkcs2(eb, &pad_len, size, size, RSA_DEC) == RLC_OK) {
+#endif
+		size = size - pad_len;
+
+		if (size <= *out_len) {
+			memset(out, 0, size);
+			bn_write_bin(out, size, eb);
+			*out_len = size;
+		} else {
+			result = RLC_ERR;
+		}
+	} else {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -713,6 +1008,11 @@ int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits) {
 				bn_add(prv->qi, prv->qi, prv->p);
 			}
 
+			/* Only two primes in this key. */
+			for (int i = 0; i < RLC_RSA_PRIMES - 2; i++) {
+				bn_zero(prv->r[i]);
+			}
+
 			result = RLC_OK;
 		}
 	}
@@ -729,6 +1029,127 @@ int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits) {
 
 #endif
 
+int cp_rsa_gen_multi(rsa_t pub, rsa_t prv, int bits, int k) {
+	bn_t t, r, u, p[RLC_RSA_PRIMES];
+	int i, j, result = RLC_OK;
+
+	if (pub == NULL || prv == NULL || k < 2 || k > RLC_RSA_PRIMES ||
+			bits / k < RLC_RSA_PRIME_MIN) {
+		return RLC_ERR;
+	}
+
+	bn_null(t);
+	bn_null(r);
+	bn_null(u);
+	for (i = 0; i < RLC_RSA_PRIMES; i++) {
+		bn_null(p[i]);
+	}
+
+	TRY {
+		bn_new(t);
+		bn_new(r);
+		bn_new(u);
+		for (i = 0; i < RLC_RSA_PRIMES; i++) {
+			bn_new(p[i]);
+		}
+
+		bn_set_2b(pub->e, 16);
+		bn_add_dig(pub->e, pub->e, 1);
+
+		/* Generate k different primes with p_i - 1 coprime to e, splitting
+		 * the key length among them. */
+		for (i = 0; i < k; i++) {
+			do {
+				bn_gen_prime(p[i], bits / k + (i < bits % k));
+				bn_sub_dig(t, p[i], 1);
+				bn_gcd(r, t, pub->e);
+				result = (bn_cmp_dig(r, 1) == RLC_EQ);
+				for (j = 0; j < i; j++) {
+					if (bn_cmp(p[i], p[j]) == RLC_EQ) {
+						result = 0;
+					}
+				}
+			} while (!result);
+		}
+		result = RLC_OK;
+
+		/* Swap p and q so that p is larger. */
+		if (bn_cmp(p[0], p[1]) == RLC_LT) {
+			bn_copy(t, p[0]);
+			bn_copy(p[0], p[1]);
+			bn_copy(p[1], t);
+		}
+
+		/* n = p * q * r_3 * ... * r_k. */
+		bn_copy(pub->n, p[0]);
+		for (i = 1; i < k; i++) {
+			bn_mul(pub->n, pub->n, p[i]);
+		}
+
+		bn_copy(prv->n, pub->n);
+		bn_copy(prv->e, pub->e);
+		bn_copy(prv->p, p[0]);
+		bn_copy(prv->q, p[1]);
+
+		/* phi(n) = (p - 1)(q - 1)(r_3 - 1)...(r_k - 1). */
+		bn_set_dig(u, 1);
+		for (i = 0; i < k; i++) {
+			bn_sub_dig(t, p[i], 1);
+			bn_mul(u, u, t);
+		}
+
+		/* d = e^(-1) mod phi(n). */
+		bn_gcd_ext(r, prv->d, NULL, pub->e, u);
+		if (bn_sign(prv->d) == RLC_NEG) {
+			bn_add(prv->d, prv->d, u);
+		}
+
+		/* dP = d mod (p - 1), dQ = d mod (q - 1), d_i = d mod (r_i - 1). */
+		bn_sub_dig(t, prv->p, 1);
+		bn_mod(prv->dp, prv->d, t);
+		bn_sub_dig(t, prv->q, 1);
+		bn_mod(prv->dq, prv->d, t);
+
+		/* qInv = q^(-1) mod p. */
+		bn_gcd_ext(r, prv->qi, NULL, prv->q, prv->p);
+		if (bn_sign(prv->qi) == RLC_NEG) {
+			bn_add(prv->qi, prv->qi, prv->p);
+		}
+
+		/* t_i = (p * q * r_3 * ... * r_(i-1))^(-1) mod r_i. */
+		bn_mul(u, prv->p, prv->q);
+		for (i = 0; i < RLC_RSA_PRIMES - 2; i++) {
+			if (i + 2 < k) {
+				bn_copy(prv->r[i], p[i + 2]);
+				bn_sub_dig(t, p[i + 2], 1);
+				bn_mod(prv->dr[i], prv->d, t);
+				bn_mod(t, u, p[i + 2]);
+				bn_gcd_ext(r, prv->ri[i], NULL, t, p[i + 2]);
+				if (bn_sign(prv->ri[i]) == RLC_NEG) {
+					bn_add(prv->ri[i], prv->ri[i], p[i + 2]);
+				}
+				bn_mul(u, u, p[i + 2]);
+			} else {
+				bn_zero(prv->r[i]);
+			}
+		}
+
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(r);
+		bn_free(u);
+		for (i = 0; i < RLC_RSA_PRIMES; i++) {
+			bn_free(p[i]);
+		}
+	}
+
+	return result;
+}
+
 int cp_rsa_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t pub) {
 	bn_t m, eb;
 	int size, pad_len, result = RLC_OK;
@@ -847,10 +1268,9 @@ int cp_rsa_dec_basic(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 #if CP_RSA == QUICK || !defined(STRIP)
 
 int cp_rsa_dec_quick(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv) {
-	bn_t m, eb;
-	int size, pad_len, result = RLC_OK;
+	bn_t eb;
+	int size, result = RLC_OK;
 
-	bn_null(m);
 	bn_null(eb);
 
 	size = bn_size_bin(prv->n);
@@ -860,60 +1280,16 @@ int cp_rsa_dec_quick(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 	}
 
 	TRY {
-		bn_new(m);
 		bn_new(eb);
 
 		bn_read_bin(eb, in, in_len);
-
-		bn_copy(m, eb);
-
-		/* m1 = c^dP mod p. */
-		bn_mxp(eb, eb, prv->dp, prv->p);
-
-		/* m2 = c^dQ mod q. */
-		bn_mxp(m, m, prv->dq, prv->q);
-
-		/* m1 = m1 - m2 mod p. */
-		bn_sub(eb, eb, m);
-		while (bn_sign(eb) == RLC_NEG) {
-			bn_add(eb, eb, prv->p);
-		}
-		bn_mod(eb, eb, prv->p);
-		/* m1 = qInv(m1 - m2) mod p. */
-		bn_mul(eb, eb, prv->qi);
-		bn_mod(eb, eb, prv->p);
-		/* m = m2 + m1 * q. */
-		bn_mul(eb, eb, prv->q);
-		bn_add(eb, eb, m);
-
-		if (bn_cmp(eb, prv->n) != RLC_LT) {
-			result = RLC_ERR;
-		}
-#if CP_RSAPD == BASIC
-		if (pad_basic(eb, &pad_len, in_len, size, RSA_DEC) == RLC_OK) {
-#elif CP_RSAPD == PKCS1
-		if (pad_pkcs1(eb, &pad_len, in_len, size, RSA_DEC) == RLC_OK) {
-#elif CP_RSAPD == PKCS2
-		if (pad_pkcs2(eb, &pad_len, in_len, size, RSA_DEC) == RLC_OK) {
-#endif
-			size = size - pad_len;
-
-			if (size <= *out_len) {
-				memset(out, 0, size);
-				bn_write_bin(out, size, eb);
-				*out_len = size;
-			} else {
-				result = RLC_ERR;
-			}
-		} else {
-			result = RLC_ERR;
-		}
+		rsa_crt(eb, eb, prv);
+		result = rsa_dec_unpad(out, out_len, eb, prv);
 	}
 	CATCH_ANY {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(m);
 		bn_free(eb);
 	}
 
@@ -1011,82 +1387,20 @@ int cp_rsa_sig_basic(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int
 #if CP_RSA == QUICK || !defined(STRIP)
 
 int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int hash, rsa_t prv) {
-	bn_t m, eb;
-	int pad_len, size, result = RLC_OK;
-	uint8_t h[MD_LEN];
+	bn_t eb;
+	int size, result = RLC_OK;
 
 	if (prv == NULL || msg_len < 0) {
 		return RLC_ERR;
 	}
 
-	pad_len = (!hash ? MD_LEN : msg_len);
-
-#if CP_RSAPD == PKCS2
-	size = bn_bits(prv->n) - 1;
-	size = (size / 8) + (size % 8 > 0);
-	if (pad_len > (size - 2)) {
-		return RLC_ERR;
-	}
-#else
-	size = bn_size_bin(prv->n);
-	if (pad_len > (size - RSA_PAD_LEN)) {
-		return RLC_ERR;
-	}
-#endif
-
-	bn_null(m);
 	bn_null(eb);
 
 	TRY {
-		bn_new(m);
 		bn_new(eb);
 
-		bn_zero(m);
-		bn_zero(eb);
-
-		int operation = (!hash ? RSA_SIG : RSA_SIG_HASH);
-
-#if CP_RSAPD == BASIC
-		if (pad_basic(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
-#elif CP_RSAPD == PKCS1
-		if (pad_pkcs1(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
-#elif CP_RSAPD == PKCS2
-		if (pad_pkcs2(eb, &pad_len, pad_len, size, operation) == RLC_OK) {
-#endif
-			if (!hash) {
-				md_map(h, msg, msg_len);
-				bn_read_bin(m, h, MD_LEN);
-				bn_add(eb, eb, m);
-			} else {
-				bn_read_bin(m, msg, msg_len);
-				bn_add(eb, eb, m);
-			}
-
-#if CP_RSAPD == PKCS2
-			pad_pkcs2(eb, &pad_len, bn_bits(prv->n), size, RSA_SIG_FIN);
-#endif
-
-			bn_copy(m, eb);
-
-			/* m1 = c^dP mod p. */
-			bn_mxp(eb, eb, prv->dp, prv->p);
-
-			/* m2 = c^dQ mod q. */
-			bn_mxp(m, m, prv->dq, prv->q);
-
-			/* m1 = m1 - m2 mod p. */
-			bn_sub(eb, eb, m);
-			while (bn_sign(eb) == RLC_NEG) {
-				bn_add(eb, eb, prv->p);
-			}
-			bn_mod(eb, eb, prv->p);
-			/* m1 = qInv(m1 - m2) mod p. */
-			bn_mul(eb, eb, prv->qi);
-			bn_mod(eb, eb, prv->p);
-			/* m = m2 + m1 * q. */
-			bn_mul(eb, eb, prv->q);
-			bn_add(eb, eb, m);
-			bn_mod(eb, eb, prv->n);
+		if (rsa_sig_pad(eb, msg, msg_len, hash, prv) == RLC_OK) {
+			rsa_crt(eb, eb, prv);
 
 			size = bn_size_bin(prv->n);
 
@@ -1105,7 +1419,6 @@ int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		bn_free(m);
 		bn_free(eb);
 	}
 
@@ -1114,6 +1427,104 @@ int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int
 
 #endif
 
+int cp_rsa_dec_batch(uint8_t **out, int *out_len, uint8_t **in, int *in_len,
+		int n, rsa_t prv) {
+	bn_t *eb = NULL;
+	int i, size, result = RLC_OK;
+
+	if (prv == NULL || n < 0) {
+		return RLC_ERR;
+	}
+
+	size = bn_size_bin(prv->n);
+	for (i = 0; i < n; i++) {
+		if (in_len[i] != size || in_len[i] < RSA_PAD_LEN) {
+			return RLC_ERR;
+		}
+	}
+
+	TRY {
+		eb = (bn_t *)calloc(n, sizeof(bn_t));
+		if (n > 0 && eb == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			bn_null(eb[i]);
+			bn_new(eb[i]);
+			bn_read_bin(eb[i], in[i], in_len[i]);
+		}
+
+		rsa_crt_batch(eb, eb, n, prv);
+
+		for (i = 0; i < n; i++) {
+			if (rsa_dec_unpad(out[i], &out_len[i], eb[i], prv) != RLC_OK) {
+				result = RLC_ERR;
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		for (i = 0; eb != NULL && i < n; i++) {
+			bn_free(eb[i]);
+		}
+		free(eb);
+	}
+
+	return result;
+}
+
+int cp_rsa_sig_batch(uint8_t **sig, int *sig_len, uint8_t **msg, int *msg_len,
+		int hash, int n, rsa_t prv) {
+	bn_t *eb = NULL;
+	int i, size, result = RLC_OK;
+
+	if (prv == NULL || n < 0) {
+		return RLC_ERR;
+	}
+
+	TRY {
+		eb = (bn_t *)calloc(n, sizeof(bn_t));
+		if (n > 0 && eb == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			bn_null(eb[i]);
+			bn_new(eb[i]);
+			if (rsa_sig_pad(eb[i], msg[i], msg_len[i], hash, prv) != RLC_OK) {
+				result = RLC_ERR;
+			}
+		}
+
+		if (result == RLC_OK) {
+			rsa_crt_batch(eb, eb, n, prv);
+
+			size = bn_size_bin(prv->n);
+			for (i = 0; i < n; i++) {
+				if (size <= sig_len[i]) {
+					memset(sig[i], 0, size);
+					bn_write_bin(sig[i], size, eb[i]);
+					sig_len[i] = size;
+				} else {
+					result = RLC_ERR;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; eb != NULL && i < n; i++) {
+			bn_free(eb[i]);
+		}
+		free(eb);
+	}
+
+	return result;
+}
+
 int cp_rsa_ver(uint8_t *sig, int sig_len, uint8_t *msg, int msg_len, int hash, rsa_t pub) {
 	bn_t m, eb;
 	int size, pad_len, result;
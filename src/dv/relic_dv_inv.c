@@ -0,0 +1,324 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the constant-time modular inversion of digit vectors.
+ *
+ * The algorithm follows Bernstein and Yang, "Fast constant-time gcd
+ * computation and modular inversion", with division steps processed in
+ * batches of (RLC_DIG - 2) steps and operands stored in signed limbs.
+ *
+ * @ingroup dv
+ */
+
+#include "relic_core.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of bits in each signed limb and of division steps in each batch.
+ */
+#define DIVST_BITS		(RLC_DIG - 2)
+
+/**
+ * Maximum number of signed limbs needed to represent an operand.
+ */
+#define DIVST_DIGS		(RLC_CEIL(RLC_BN_SIZE * RLC_DIG + 2, DIVST_BITS))
+
+/**
+ * Represents a signed double-precision integer.
+ */
+#if WSIZE == 8
+typedef int16_t dbs_t;
+#elif WSIZE == 16
+typedef int32_t dbs_t;
+#elif WSIZE == 32
+typedef int64_t dbs_t;
+#elif WSIZE == 64
+typedef __int128_t dbs_t;
+#endif
+
+/**
+ * Converts a digit vector to the signed limb representation.
+ *
+ * @param[out] r			- the signed limbs.
+ * @param[in] a				- the digit vector.
+ * @param[in] digs			- the number of digits.
+ * @param[in] n				- the number of signed limbs.
+ */
+static void divst_read(dis_t *r, const dig_t *a, int digs, int n) {
+	dbl_t acc = 0;
+	int i, j = 0, bits = 0;
+
+	for (i = 0; i < digs; i++) {
+		acc |= (dbl_t)a[i] << bits;
+		bits += RLC_DIG;
+		while (bits >= DIVST_BITS && j < n) {
+			r[j++] = (dis_t)((dig_t)acc & RLC_MASK(DIVST_BITS));
+			acc >>= DIVST_BITS;
+			bits -= DIVST_BITS;
+		}
+	}
+	while (j < n) {
+		r[j++] = (dis_t)((dig_t)acc & RLC_MASK(DIVST_BITS));
+		acc >>= DIVST_BITS;
+	}
+}
+
+/**
+ * Converts a non-negative integer in signed limb representation to a digit
+ * vector.
+ *
+ * @param[out] c			- the digit vector.
+ * @param[in] r				- the signed limbs.
+ * @param[in] digs			- the number of digits.
+ * @param[in] n				- the number of signed limbs.
+ */
+static void divst_write(dig_t *c, const dis_t *r, int digs, int n) {
+	dbl_t acc = 0;
+	int i, j = 0, bits = 0;
+
+	for (i = 0; i < digs; i++) {
+		while (bits < RLC_DIG && j < n) {
+			acc |= (dbl_t)(dig_t)r[j++] << bits;
+			bits += DIVST_BITS;
+		}
+		c[i] = (dig_t)acc;
+		acc >>= RLC_DIG;
+		bits -= RLC_DIG;
+	}
+}
+
+/**
+ * Propagates the carries of a signed limb representation, such that all limbs
+ * but the most significant one are non-negative and smaller than 2^DIVST_BITS.
+ *
+ * @param[in,out] a			- the signed limbs.
+ * @param[in] n				- the number of signed limbs.
+ */
+static void divst_carry(dis_t *a, int n) {
+	int i;
+
+	for (i = 0; i < n - 1; i++) {
+		a[i + 1] += a[i] >> DIVST_BITS;
+		a[i] = (dis_t)((dig_t)a[i] & RLC_MASK(DIVST_BITS));
+	}
+}
+
+/**
+ * Computes a batch of DIVST_BITS division steps on the least significant limbs
+ * of f and g, returning the updated delta and the scaled transition matrix.
+ *
+ * @param[out] t			- the transition matrix (u, v, q, r).
+ * @param[in] delta			- the current value of delta.
+ * @param[in] f				- the least significant limb of f.
+ * @param[in] g				- the least significant limb of g.
+ * @return the value of delta after the batch.
+ */
+static int divst_batch(dis_t t[4], int delta, dig_t f, dig_t g) {
+	dig_t u = 1, v = 0, q = 0, r = 1, c1, c2, x;
+	int i, s;
+
+	for (i = 0; i < DIVST_BITS; i++) {
+		/* Swap if delta > 0 and g is odd. */
+		c1 = -(dig_t)((unsigned int)(-delta) >> (8 * sizeof(int) - 1));
+		c2 = -(g & 1);
+		c1 &= c2;
+		/* (delta, f, g, u, v, q, r) = (-delta, g, -f, q, r, -u, -v). */
+		x = (f ^ g) & c1;
+		f ^= x;
+		g ^= x;
+		g = (g ^ c1) - c1;
+		x = (u ^ q) & c1;
+		u ^= x;
+		q ^= x;
+		q = (q ^ c1) - c1;
+		x = (v ^ r) & c1;
+		v ^= x;
+		r ^= x;
+		r = (r ^ c1) - c1;
+		s = -(int)(c1 & 1);
+		delta = (delta ^ s) - s;
+		/* If g is odd, add f to g. Then divide g by 2. */
+		g += f & c2;
+		q += u & c2;
+		r += v & c2;
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+		delta++;
+	}
+	t[0] = (dis_t)u;
+	t[1] = (dis_t)v;
+	t[2] = (dis_t)q;
+	t[3] = (dis_t)r;
+	return delta;
+}
+
+/**
+ * Applies a transition matrix to (f, g), computing
+ * (f, g) = t * (f, g) / 2^DIVST_BITS.
+ *
+ * @param[in,out] f			- the first signed limb vector.
+ * @param[in,out] g			- the second signed limb vector.
+ * @param[in] t				- the transition matrix.
+ * @param[in] n				- the number of signed limbs.
+ */
+static void divst_update_fg(dis_t *f, dis_t *g, const dis_t t[4], int n) {
+	dbs_t cf, cg;
+	int i;
+
+	cf = (dbs_t)t[0] * f[0] + (dbs_t)t[1] * g[0];
+	cg = (dbs_t)t[2] * f[0] + (dbs_t)t[3] * g[0];
+	cf >>= DIVST_BITS;
+	cg >>= DIVST_BITS;
+	for (i = 1; i < n; i++) {
+		cf += (dbs_t)t[0] * f[i] + (dbs_t)t[1] * g[i];
+		cg += (dbs_t)t[2] * f[i] + (dbs_t)t[3] * g[i];
+		f[i - 1] = (dis_t)((dig_t)cf & RLC_MASK(DIVST_BITS));
+		g[i - 1] = (dis_t)((dig_t)cg & RLC_MASK(DIVST_BITS));
+		cf >>= DIVST_BITS;
+		cg >>= DIVST_BITS;
+	}
+	f[n - 1] = (dis_t)cf;
+	g[n - 1] = (dis_t)cg;
+}
+
+/**
+ * Applies a transition matrix to (d, e) modulo m, computing
+ * (d, e) = t * (d, e) / 2^DIVST_BITS mod m. Inputs and outputs lie in the
+ * interval (-2m, m).
+ *
+ * @param[in,out] d			- the first signed limb vector.
+ * @param[in,out] e			- the second signed limb vector.
+ * @param[in] t				- the transition matrix.
+ * @param[in] m				- the modulus.
+ * @param[in] mi			- the inverse of the modulus modulo 2^DIVST_BITS.
+ * @param[in] n				- the number of signed limbs.
+ */
+static void divst_update_de(dis_t *d, dis_t *e, const dis_t t[4],
+		const dis_t *m, dig_t mi, int n) {
+	dis_t sd, se, md, me;
+	dbs_t cd, ce;
+	int i;
+
+	/* Add m to the result for each negative input, keeping it above -2m. */
+	sd = d[n - 1] >> (RLC_DIG - 1);
+	se = e[n - 1] >> (RLC_DIG - 1);
+	md = (t[0] & sd) + (t[1] & se);
+	me = (t[2] & sd) + (t[3] & se);
+	cd = (dbs_t)t[0] * d[0] + (dbs_t)t[1] * e[0];
+	ce = (dbs_t)t[2] * d[0] + (dbs_t)t[3] * e[0];
+	/* Correct md and me so that the least significant limb vanishes. */
+	md -= (dis_t)((mi * (dig_t)cd + (dig_t)md) & RLC_MASK(DIVST_BITS));
+	me -= (dis_t)((mi * (dig_t)ce + (dig_t)me) & RLC_MASK(DIVST_BITS));
+	cd += (dbs_t)m[0] * md;
+	ce += (dbs_t)m[0] * me;
+	cd >>= DIVST_BITS;
+	ce >>= DIVST_BITS;
+	for (i = 1; i < n; i++) {
+		cd += (dbs_t)t[0] * d[i] + (dbs_t)t[1] * e[i] + (dbs_t)m[i] * md;
+		ce += (dbs_t)t[2] * d[i] + (dbs_t)t[3] * e[i] + (dbs_t)m[i] * me;
+		d[i - 1] = (dis_t)((dig_t)cd & RLC_MASK(DIVST_BITS));
+		e[i - 1] = (dis_t)((dig_t)ce & RLC_MASK(DIVST_BITS));
+		cd >>= DIVST_BITS;
+		ce >>= DIVST_BITS;
+	}
+	d[n - 1] = (dis_t)cd;
+	e[n - 1] = (dis_t)ce;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int dv_inv_divst(dig_t *c, const dig_t *a, const dig_t *m, int digits) {
+	dis_t f[DIVST_DIGS], g[DIVST_DIGS], d[DIVST_DIGS], e[DIVST_DIGS];
+	dis_t p[DIVST_DIGS], t[4], s;
+	dig_t mi, z;
+	int i, n, bits, iter, delta;
+
+	bits = (digits - 1) * RLC_DIG + util_bits_dig(m[digits - 1]);
+	n = RLC_CEIL(bits + 2, DIVST_BITS);
+	if (n > DIVST_DIGS) {
+		return RLC_ERR;
+	}
+
+	/* Compute the inverse of the modulus modulo 2^RLC_DIG. */
+	mi = m[0];
+	for (i = 0; i < RLC_DIG_LOG; i++) {
+		mi *= 2 - m[0] * mi;
+	}
+
+	/* f = m, g = a, d = 0, e = 1, such that f = d * a and g = e * a. */
+	divst_read(p, m, digits, n);
+	divst_read(g, a, digits, n);
+	for (i = 0; i < n; i++) {
+		f[i] = p[i];
+		d[i] = e[i] = 0;
+	}
+	e[0] = 1;
+
+	/* Number of division steps from Theorem 11.2 of the paper. */
+	iter = (49 * bits + (bits < 46 ? 80 : 57)) / 17;
+	delta = 1;
+	for (i = 0; i < iter; i += DIVST_BITS) {
+		delta = divst_batch(t, delta, (dig_t)f[0], (dig_t)g[0]);
+		divst_update_fg(f, g, t, n);
+		divst_update_de(d, e, t, p, mi, n);
+	}
+
+	/* Now g = 0 and f = +-gcd(a, m), so bring d = +-a^(-1) to [0, m). */
+	s = d[n - 1] >> (RLC_DIG - 1);
+	for (i = 0; i < n; i++) {
+		d[i] += p[i] & s;
+	}
+	divst_carry(d, n);
+	s = f[n - 1] >> (RLC_DIG - 1);
+	for (i = 0; i < n; i++) {
+		f[i] = (f[i] ^ s) - s;
+		d[i] = (d[i] ^ s) - s;
+	}
+	divst_carry(f, n);
+	divst_carry(d, n);
+	s = d[n - 1] >> (RLC_DIG - 1);
+	for (i = 0; i < n; i++) {
+		d[i] += p[i] & s;
+	}
+	divst_carry(d, n);
+
+	z = (dig_t)f[0] ^ 1;
+	for (i = 1; i < n; i++) {
+		z |= (dig_t)f[i];
+	}
+	if (z != 0) {
+		return RLC_ERR;
+	}
+	divst_write(c, d, digits, n);
+	return RLC_OK;
+}
@@ -64,7 +64,7 @@ static void detect_opt(int *opt, fb_t a) {
 /*============================================================================*/
 
 void eb_curve_init(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 #ifdef EB_PRECO
 	for (int i = 0; i < RLC_EB_TABLE; i++) {
 		ctx->eb_ptr[i] = &(ctx->eb_pre[i]);
@@ -78,41 +78,41 @@ void eb_curve_init(void) {
 }
 
 void eb_curve_clean(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	bn_clean(&(ctx->eb_r));
 	bn_clean(&(ctx->eb_h));
 }
 
 dig_t *eb_curve_get_a(void) {
-	return core_get()->eb_a;
+	return core_get_crv()->eb_a;
 }
 
 int eb_curve_opt_a(void) {
-	return core_get()->eb_opt_a;
+	return core_get_crv()->eb_opt_a;
 }
 
 dig_t *eb_curve_get_b(void) {
-	return core_get()->eb_b;
+	return core_get_crv()->eb_b;
 }
 
 int eb_curve_opt_b(void) {
-	return core_get()->eb_opt_b;
+	return core_get_crv()->eb_opt_b;
 }
 
 int eb_curve_is_kbltz(void) {
-	return core_get()->eb_is_kbltz;
+	return core_get_crv()->eb_is_kbltz;
 }
 
 void eb_curve_get_gen(eb_t g) {
-	eb_copy(g, &(core_get()->eb_g));
+	eb_copy(g, &(core_get_crv()->eb_g));
 }
 
 void eb_curve_get_ord(bn_t n) {
-	bn_copy(n, &(core_get()->eb_r));
+	bn_copy(n, &(core_get_crv()->eb_r));
 }
 
 void eb_curve_get_cof(bn_t h) {
-	bn_copy(h, &(core_get()->eb_h));
+	bn_copy(h, &(core_get_crv()->eb_h));
 }
 
 const eb_t *eb_curve_get_tab(void) {
@@ -120,9 +120,9 @@ const eb_t *eb_curve_get_tab(void) {
 
 	/* Return a meaningful pointer. */
 #if ALLOC == AUTO
-	return (const eb_t *)*(core_get()->eb_ptr);
+	return (const eb_t *)*(core_get_crv()->eb_ptr);
 #else
-	return (const eb_t *)core_get()->eb_ptr;
+	return (const eb_t *)core_get_crv()->eb_ptr;
 #endif
 
 #else
@@ -133,7 +133,12 @@ const eb_t *eb_curve_get_tab(void) {
 
 void eb_curve_set(const fb_t a, const fb_t b, const eb_t g, const bn_t r,
 		const bn_t h) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
+
 	fb_copy(ctx->eb_a, a);
 	fb_copy(ctx->eb_b, b);
 
@@ -151,4 +156,5 @@ void eb_curve_set(const fb_t a, const fb_t b, const eb_t g, const bn_t r,
 #if defined(EB_PRECO)
 	eb_mul_pre((eb_t *)eb_curve_get_tab(), &(ctx->eb_g));
 #endif
+	core_done_crv();
 }
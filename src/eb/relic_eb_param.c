@@ -247,10 +247,11 @@
 /*============================================================================*/
 
 int eb_param_get(void) {
-	return core_get()->eb_id;
+	return core_get_crv()->eb_id;
 }
 
 void eb_param_set(int param) {
+	crv_t *ctx;
 	char str[2 * RLC_FB_BYTES + 1];
 	fb_t a, b;
 	eb_t g;
@@ -270,7 +271,11 @@ void eb_param_set(int param) {
 		bn_new(r);
 		bn_new(h);
 
-		core_get()->eb_id = 0;
+		ctx = core_own_crv();
+		if (ctx != NULL) {
+			ctx->eb_id = 0;
+			core_done_crv();
+		}
 
 		switch (param) {
 #if defined(EB_PLAIN) && FB_POLYN == 163
@@ -348,7 +353,11 @@ void eb_param_set(int param) {
 		g->norm = 1;
 
 		eb_curve_set(a, b, g, r, h);
-		core_get()->eb_id = param;
+		ctx = core_own_crv();
+		if (ctx != NULL) {
+			ctx->eb_id = param;
+			core_done_crv();
+		}
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -426,7 +435,7 @@ int eb_param_set_any_kbltz(void) {
 }
 
 void eb_param_print(void) {
-	switch (core_get()->eb_id) {
+	switch (core_get_crv()->eb_id) {
 		case NIST_B163:
 			util_banner("Curve NIST-B163:", 0);
 			break;
@@ -470,7 +479,7 @@ void eb_param_print(void) {
 }
 
 int eb_param_level(void) {
-	switch (core_get()->eb_id) {
+	switch (core_get_crv()->eb_id) {
 		case NIST_B163:
 		case NIST_K163:
 			return 80;
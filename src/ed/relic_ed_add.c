@@ -63,7 +63,7 @@ void ed_add_basic(ed_t r, const ed_t p, const ed_t q) {
 		fp_mul(t1, p->x, q->x);
 		fp_mul(t2, p->y, q->y);
 		fp_mul(t1, t1, t2);
-		fp_mul(t1, t1, core_get()->ed_d);
+		fp_mul(t1, t1, core_get_crv()->ed_d);
 		fp_add_dig(t2, t1, 1);
 		fp_inv(t2, t2);
 		fp_sub_dig(t1, t1, 1);
@@ -74,7 +74,7 @@ void ed_add_basic(ed_t r, const ed_t p, const ed_t q) {
 
 		fp_mul(r->y, p->y, q->y);
 		fp_mul(t2, p->x, q->x);
-		fp_mul(t2, t2, core_get()->ed_a);
+		fp_mul(t2, t2, core_get_crv()->ed_a);
 		fp_sub(r->y, r->y, t2);
 		fp_mul(r->y, r->y, t1);
 
@@ -153,7 +153,7 @@ void ed_add_projc(ed_t r, const ed_t p, const ed_t q) {
 		fp_mul(t3, p->y, q->y);
 
 		/* E = d * C * D */
-		fp_mul(t4, core_get()->ed_d, t2);
+		fp_mul(t4, core_get_crv()->ed_d, t2);
 		fp_mul(t4, t4, t3);
 
 		/* F = B - E */
@@ -173,7 +173,7 @@ void ed_add_projc(ed_t r, const ed_t p, const ed_t q) {
 
 		/* y3 = A * G * (D - a * C) */
 		fp_mul(r->z, t0, t6);
-		fp_mul(r->y, core_get()->ed_a, t2);
+		fp_mul(r->y, core_get_crv()->ed_a, t2);
 		fp_sub(r->y, t3, r->y);
 		fp_mul(r->y, r->z, r->y);
 
@@ -252,7 +252,7 @@ void ed_add_extnd(ed_t r, const ed_t p, const ed_t q) {
 		fp_mul(t1, p->y, q->y);
 
 		/* C = d * t1 * t2 */
-		fp_mul(r->t, core_get()->ed_d, p->t);
+		fp_mul(r->t, core_get_crv()->ed_d, p->t);
 		fp_mul(r->t, r->t, q->t);
 
 		/* D = z1 * z2 */
@@ -272,7 +272,7 @@ void ed_add_extnd(ed_t r, const ed_t p, const ed_t q) {
 		fp_add(t4, r->z, r->t);
 
 		/* H = B - aA */
-		fp_mul(r->x, core_get()->ed_a, t0);
+		fp_mul(r->x, core_get_crv()->ed_a, t0);
 		fp_sub(r->z, t1, r->x);
 
 		/* x3 = E * F, y3 = G * H, t3 = E * H, z3 = F * G */
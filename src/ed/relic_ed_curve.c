@@ -33,7 +33,7 @@
 #include "relic_core.h"
 
 void ed_curve_init(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 #ifdef ED_PRECO
 	for (int i = 0; i < RLC_ED_TABLE; i++) {
 		ctx->ed_ptr[i] = &(ctx->ed_pre[i]);
@@ -45,21 +45,21 @@ void ed_curve_init(void) {
 }
 
 void ed_curve_clean(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	bn_clean(&ctx->ed_r);
 	bn_clean(&ctx->ed_h);
 }
 
 void ed_curve_get_gen(ed_t g) {
-	ed_copy(g, &core_get()->ed_g);
+	ed_copy(g, &core_get_crv()->ed_g);
 }
 
 void ed_curve_get_ord(bn_t n) {
-	bn_copy(n, &core_get()->ed_r);
+	bn_copy(n, &core_get_crv()->ed_r);
 }
 
 void ed_curve_get_cof(bn_t h) {
-	bn_copy(h, &core_get()->ed_h);
+	bn_copy(h, &core_get_crv()->ed_h);
 }
 
 const ed_t *ed_curve_get_tab(void) {
@@ -67,9 +67,9 @@ const ed_t *ed_curve_get_tab(void) {
 
 	/* Return a meaningful pointer. */
 #if ALLOC == AUTO
-	return (const ed_t *)*core_get()->ed_ptr;
+	return (const ed_t *)*core_get_crv()->ed_ptr;
 #else
-	return (const ed_t *)core_get()->ed_ptr;
+	return (const ed_t *)core_get_crv()->ed_ptr;
 #endif
 
 #else
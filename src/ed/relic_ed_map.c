@@ -39,17 +39,15 @@
 
 void ed_map(ed_t p, const uint8_t *msg, int len) {
 	bn_t h;
-	fp_t t, u, v;
+	fp_t u, v;
 	uint8_t digest[MD_LEN];
 
 	bn_null(h);
-	fp_null(t);
 	fp_null(u);
 	fp_null(v);
 
 	TRY {
 		bn_new(h);
-		fp_new(t);
 		fp_new(u);
 		fp_new(v);
 
@@ -59,50 +57,19 @@ void ed_map(ed_t p, const uint8_t *msg, int len) {
 		fp_prime_conv(p->y, h);
 		fp_set_dig(p->z, 1);
 
-		/* Make e = p. */
-		h->used = RLC_FP_DIGS;
-		dv_copy(h->dp, fp_prime_get(), RLC_FP_DIGS);
-
-		/* Compute a^((p - 5)/8). */
-		bn_sub_dig(h, h, 5);
-		bn_rsh(h, h, 3);
-
 		/* Decode using Elligator 2. */
 		while (1) {
 			/* u = y^2 - 1, v = d * y^2 + 1. */
 			fp_sqr(u, p->y);
-			fp_mul(v, u, core_get()->ed_d);
+			fp_mul(v, u, core_get_crv()->ed_d);
 			fp_sub_dig(u, u, 1);
 			fp_add_dig(v, v, 1);
 
-			/* t = v^3, x = uv^7. */
-			fp_sqr(t, v);
-			fp_mul(t, t, v);
-			fp_sqr(p->x, t);
-			fp_mul(p->x, p->x, v);
-			fp_mul(p->x, p->x, u);
-
-			/* x = uv^3 * (uv^7)^((p - 5)/8). */
-			fp_exp(p->x, p->x, h);
-			fp_mul(p->x, p->x, t);
-			fp_mul(p->x, p->x, u);
-
-			/* Check if vx^2 == u. */
-			fp_sqr(t, p->x);
-			fp_mul(t, t, v);
-
-			if (fp_cmp(t, u) != RLC_EQ) {
-				fp_neg(u, u);
-				/* Check if vx^2 == -u. */
-				if (fp_cmp(t, u) != RLC_EQ) {
-					fp_add_dig(p->y, p->y, 1);
-				} else {
-					fp_mul(p->x, p->x, core_get()->srm1);
-					break;
-				}
-			} else {
+			/* x = sqrt(u/v), or try the next y if there is none. */
+			if (fp_srt_rat(p->x, u, v)) {
 				break;
 			}
+			fp_add_dig(p->y, p->y, 1);
 		}
 
 		/* By Elligator convention. */
@@ -126,7 +93,6 @@ void ed_map(ed_t p, const uint8_t *msg, int len) {
 	}
 	FINALLY {
 		bn_free(h);
-		fp_free(t);
 		fp_free(u);
 		fp_free(v);
 	}
@@ -55,9 +55,9 @@
 #define ASSIGN_ED(CURVE, FIELD)												\
 	fp_param_set(FIELD);													\
 	RLC_GET(str, CURVE##_A, sizeof(CURVE##_A));								\
-	fp_read_str(core_get()->ed_a, str, strlen(str), 16);					\
+	fp_read_str(core_get_crv()->ed_a, str, strlen(str), 16);					\
 	RLC_GET(str, CURVE##_D, sizeof(CURVE##_D));								\
-	fp_read_str(core_get()->ed_d, str, strlen(str), 16);					\
+	fp_read_str(core_get_crv()->ed_d, str, strlen(str), 16);					\
 	RLC_GET(str, CURVE##_X, sizeof(CURVE##_X));								\
 	fp_read_str(g->x, str, strlen(str), 16);								\
 	RLC_GET(str, CURVE##_Y, sizeof(CURVE##_Y));								\
@@ -69,13 +69,17 @@
 	bn_read_str(h, str, strlen(str), 16);
 
 void ed_param_set(int param) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
 	char str[2 * RLC_FP_BYTES + 2];
 
 	ed_t g;
 	bn_t r;
 	bn_t h;
 
+	if (ctx == NULL) {
+		return;
+	}
+
 	ed_null(g);
 	bn_null(r);
 	bn_null(h);
@@ -85,7 +89,7 @@ void ed_param_set(int param) {
 		bn_new(r);
 		bn_new(h);
 
-		core_get()->ed_id = 0;
+		ctx->ed_id = 0;
 
 		switch (param) {
 #if FP_PRIME == 255
@@ -100,7 +104,7 @@ void ed_param_set(int param) {
 		}
 		fp_set_dig(g->z, 1);
 		fp_neg(g->z, g->z);
-		fp_srt(core_get()->srm1, g->z);
+		fp_srt(core_get_crv()->srm1, g->z);
 		fp_neg(g->z, g->z);
 #if ED_ADD == EXTND
 		fp_mul(g->t, g->x, g->y);
@@ -129,6 +133,7 @@ void ed_param_set(int param) {
 		bn_free(r);
 		bn_free(h);
 		ed_free(g);
+		core_done_crv();
 	}
 }
 
@@ -143,7 +148,7 @@ int ed_param_set_any(void) {
 }
 
 int ed_param_get(void) {
-	return core_get()->ed_id;
+	return core_get_crv()->ed_id;
 }
 
 int ed_param_level(void) {
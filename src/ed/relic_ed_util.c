@@ -178,12 +178,12 @@ void ed_rhs(fp_t rhs, const ed_t p) {
 
 		// 1 = a * X^2 + Y^2 - d * X^2 * Y^2
 		fp_sqr(t0, p->x);
-		fp_mul(t0, t0, core_get()->ed_a);
+		fp_mul(t0, t0, core_get_crv()->ed_a);
 		fp_sqr(t1, p->y);
 		fp_add(t1, t1, t0);
 		fp_mul(t0, p->x, p->y);
 		fp_sqr(t0, t0);
-		fp_mul(t0, t0, core_get()->ed_d);
+		fp_mul(t0, t0, core_get_crv()->ed_d);
 		fp_sub(rhs, t1, t0);
 	} CATCH_ANY {
 		THROW(ERR_CAUGHT);
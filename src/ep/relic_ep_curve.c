@@ -82,12 +82,127 @@ static void detect_opt(int *opt, fp_t a) {
 	}
 }
 
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+/**
+ * Precomputes the constants of the Shallue-van de Woestijne map for the curve
+ * y^2 = x^3 + ax + b, choosing the smallest Z as suggested in RFC 9380.
+ *
+ * @param[out] c		- the constants Z, c1, c2, c3, c4, c5 and c6.
+ * @param[in] a			- the 'a' coefficient of the curve.
+ * @param[in] b			- the 'b' coefficient of the curve.
+ */
+static void detect_map(fp_st *c, const fp_t a, const fp_t b) {
+	fp_t z, gz, hz, t0, t1;
+	bn_t t;
+	int found = 0;
+
+	bn_null(t);
+	fp_null(z);
+	fp_null(gz);
+	fp_null(hz);
+	fp_null(t0);
+	fp_null(t1);
+
+	TRY {
+		bn_new(t);
+		fp_new(z);
+		fp_new(gz);
+		fp_new(hz);
+		fp_new(t0);
+		fp_new(t1);
+
+		for (int k = 2; k < 2 * RLC_DIG && !found; k++) {
+			/* Try Z = 1, -1, 2, -2, ... in this order. */
+			fp_set_dig(z, k >> 1);
+			if (k & 1) {
+				fp_neg(z, z);
+			}
+			/* gz = g(Z) = Z^3 + aZ + b. */
+			fp_sqr(gz, z);
+			fp_add(gz, gz, a);
+			fp_mul(gz, gz, z);
+			fp_add(gz, gz, b);
+			/* hz = 3Z^2 + 4a. */
+			fp_sqr(hz, z);
+			fp_dbl(t0, hz);
+			fp_add(hz, hz, t0);
+			fp_dbl(t0, a);
+			fp_dbl(t0, t0);
+			fp_add(hz, hz, t0);
+			if (fp_is_zero(gz) || fp_is_zero(hz)) {
+				continue;
+			}
+			/* -(3Z^2 + 4a)/(4g(Z)) is a square iff -g(Z)(3Z^2 + 4a) is. */
+			fp_mul(t0, gz, hz);
+			fp_neg(t0, t0);
+			if (!fp_srt(c[3], t0)) {
+				continue;
+			}
+			/* Either g(Z) or g(-Z/2) must be a square, and g(-Z/2) != 0. */
+			fp_hlv(c[2], z);
+			fp_neg(c[2], c[2]);
+			fp_sqr(t0, c[2]);
+			fp_add(t0, t0, a);
+			fp_mul(t0, t0, c[2]);
+			fp_add(t0, t0, b);
+			if (!fp_is_zero(t0) && (fp_srt(t1, gz) || fp_srt(t1, t0))) {
+				found = 1;
+			}
+		}
+
+		if (!found) {
+			THROW(ERR_NO_VALID);
+		} else {
+			/* c4 = -4g(Z)/(3Z^2 + 4a). */
+			fp_inv(t1, hz);
+			fp_mul(t1, t1, gz);
+			fp_dbl(t1, t1);
+			fp_dbl(t1, t1);
+			fp_neg(c[4], t1);
+			fp_copy(c[1], gz);
+			fp_copy(c[0], z);
+			/* c3 is the square root with sgn0(c3) = 0. */
+			fp_prime_back(t, c[3]);
+			if (!bn_is_even(t)) {
+				fp_neg(c[3], c[3]);
+			}
+			/* c6 = sqrt(g(Z)) if it exists, for the exceptional inputs. */
+			if (!fp_srt(c[6], gz)) {
+				fp_zero(c[6]);
+			}
+			/* c5 = sqrt(g(Z + c4))/g(-Z/2), see the map for details. */
+			fp_add(z, z, c[4]);
+			fp_sqr(gz, z);
+			fp_add(gz, gz, a);
+			fp_mul(gz, gz, z);
+			fp_add(gz, gz, b);
+			fp_srt(c[5], gz);
+			fp_inv(t0, t0);
+			fp_mul(c[5], c[5], t0);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		fp_free(z);
+		fp_free(gz);
+		fp_free(hz);
+		fp_free(t0);
+		fp_free(t1);
+	}
+}
+
+#endif /* EP_MAP == SVDWM */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void ep_curve_init(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		ctx->ep_ptr[i] = &(ctx->ep_pre[i]);
@@ -105,7 +220,7 @@ void ep_curve_init(void) {
 }
 
 void ep_curve_clean(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	bn_clean(&ctx->ep_r);
 	bn_clean(&ctx->ep_h);
 #if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == LWNAF || !defined(STRIP))
@@ -117,28 +232,36 @@ void ep_curve_clean(void) {
 }
 
 dig_t *ep_curve_get_b(void) {
-	return core_get()->ep_b;
+	return core_get_crv()->ep_b;
 }
 
 dig_t *ep_curve_get_a(void) {
-	return core_get()->ep_a;
+	return core_get_crv()->ep_a;
 }
 
 #if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP))
 
 dig_t *ep_curve_get_beta(void) {
-	return core_get()->beta;
+	return core_get_crv()->beta;
 }
 
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+dig_t *ep_curve_get_map(int i) {
+	return core_get_crv()->ep_map_c[i];
+}
+
+#endif
+
 void ep_curve_get_v1(bn_t v[]) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	for (int i = 0; i < 3; i++) {
 		bn_copy(v[i], &(ctx->ep_v1[i]));
 	}
 }
 
 void ep_curve_get_v2(bn_t v[]) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	for (int i = 0; i < 3; i++) {
 		bn_copy(v[i], &(ctx->ep_v2[i]));
 	}
@@ -147,31 +270,31 @@ void ep_curve_get_v2(bn_t v[]) {
 #endif
 
 int ep_curve_opt_a(void) {
-	return core_get()->ep_opt_a;
+	return core_get_crv()->ep_opt_a;
 }
 
 int ep_curve_opt_b(void) {
-	return core_get()->ep_opt_b;
+	return core_get_crv()->ep_opt_b;
 }
 
 int ep_curve_is_endom(void) {
-	return core_get()->ep_is_endom;
+	return core_get_crv()->ep_is_endom;
 }
 
 int ep_curve_is_super(void) {
-	return core_get()->ep_is_super;
+	return core_get_crv()->ep_is_super;
 }
 
 void ep_curve_get_gen(ep_t g) {
-	ep_copy(g, &core_get()->ep_g);
+	ep_copy(g, &core_get_crv()->ep_g);
 }
 
 void ep_curve_get_ord(bn_t n) {
-	bn_copy(n, &core_get()->ep_r);
+	bn_copy(n, &core_get_crv()->ep_r);
 }
 
 void ep_curve_get_cof(bn_t h) {
-	bn_copy(h, &core_get()->ep_h);
+	bn_copy(h, &core_get_crv()->ep_h);
 }
 
 const ep_t *ep_curve_get_tab(void) {
@@ -179,9 +302,9 @@ const ep_t *ep_curve_get_tab(void) {
 
 	/* Return a meaningful pointer. */
 #if ALLOC == AUTO
-	return (const ep_t *)*core_get()->ep_ptr;
+	return (const ep_t *)*core_get_crv()->ep_ptr;
 #else
-	return (const ep_t *)core_get()->ep_ptr;
+	return (const ep_t *)core_get_crv()->ep_ptr;
 #endif
 
 #else
@@ -194,7 +317,12 @@ const ep_t *ep_curve_get_tab(void) {
 
 void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 		const bn_t h) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
+
 	ctx->ep_is_endom = 0;
 	ctx->ep_is_super = 0;
 
@@ -203,6 +331,9 @@ void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 
 	detect_opt(&(ctx->ep_opt_a), ctx->ep_a);
 	detect_opt(&(ctx->ep_opt_b), ctx->ep_b);
+#if EP_MAP == SVDWM || !defined(STRIP)
+	detect_map(ctx->ep_map_c, ctx->ep_a, ctx->ep_b);
+#endif
 
 	ep_norm(&(ctx->ep_g), g);
 	bn_copy(&(ctx->ep_r), r);
@@ -211,6 +342,7 @@ void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 #if defined(EP_PRECO)
 	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
 #endif
+	core_done_crv();
 }
 
 #endif
@@ -219,7 +351,12 @@ void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 
 void ep_curve_set_super(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 		const bn_t h) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
+
 	ctx->ep_is_endom = 0;
 	ctx->ep_is_super = 1;
 
@@ -228,6 +365,9 @@ void ep_curve_set_super(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 
 	detect_opt(&(ctx->ep_opt_a), ctx->ep_a);
 	detect_opt(&(ctx->ep_opt_b), ctx->ep_b);
+#if EP_MAP == SVDWM || !defined(STRIP)
+	detect_map(ctx->ep_map_c, ctx->ep_a, ctx->ep_b);
+#endif
 
 	ep_norm(&(ctx->ep_g), g);
 	bn_copy(&(ctx->ep_r), r);
@@ -236,6 +376,7 @@ void ep_curve_set_super(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 #if defined(EP_PRECO)
 	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
 #endif
+	core_done_crv();
 }
 
 #endif
@@ -245,7 +386,12 @@ void ep_curve_set_super(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 void ep_curve_set_endom(const fp_t b, const ep_t g, const bn_t r, const bn_t h,
 		const fp_t beta, const bn_t l) {
 	int bits = bn_bits(r);
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
+
 	ctx->ep_is_endom = 1;
 	ctx->ep_is_super = 0;
 
@@ -254,6 +400,9 @@ void ep_curve_set_endom(const fp_t b, const ep_t g, const bn_t r, const bn_t h,
 
 	detect_opt(&(ctx->ep_opt_a), ctx->ep_a);
 	detect_opt(&(ctx->ep_opt_b), ctx->ep_b);
+#if EP_MAP == SVDWM || !defined(STRIP)
+	detect_map(ctx->ep_map_c, ctx->ep_a, ctx->ep_b);
+#endif
 
 #if EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP)
 	fp_copy(ctx->beta, beta);
@@ -297,6 +446,7 @@ void ep_curve_set_endom(const fp_t b, const ep_t g, const bn_t r, const bn_t h,
 #if defined(EP_PRECO)
 	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
 #endif
+	core_done_crv();
 }
 
 #endif
@@ -32,11 +32,265 @@
 #include "relic_core.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+/**
+ * Number of bytes hashed per field element, the length L of RFC 9380 for a
+ * security level of 128 bits.
+ */
+#define EP_MAP_BYTES	RLC_CEIL(FP_PRIME + 128, 8)
+
+/**
+ * Domain separation tag used by ep_map_svdwm().
+ */
+#define EP_MAP_DST		"RELIC_G1_XMD_SVDW_RO_"
+
+/**
+ * Returns the parity of the canonical representative of a field element, the
+ * sgn0 function of RFC 9380, without branching on the element.
+ *
+ * @param[in] a				- the field element.
+ * @return the least significant bit of the representative.
+ */
+static dig_t ep_map_sgn0(const fp_t a) {
+#if FP_RDC == MONTY
+	dv_t t;
+	fp_t r;
+	dig_t s = 0;
+
+	dv_null(t);
+	fp_null(r);
+
+	TRY {
+		dv_new(t);
+		fp_new(r);
+		dv_zero(t, 2 * RLC_FP_DIGS);
+		dv_copy(t, a, RLC_FP_DIGS);
+		fp_rdc(r, t);
+		s = r[0] & 1;
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		dv_free(t);
+		fp_free(r);
+	}
+	return s;
+#else
+	return a[0] & 1;
+#endif
+}
+
+/**
+ * Computes g(n/d) * d^6 = (n^3 + a * n * d^2 + b * d^3) * d^3 for the curve
+ * polynomial g(x), so that a single square root gives the y-coordinate of the
+ * point (n * d, y, d) in Jacobian coordinates without inverting d.
+ *
+ * @param[out] r			- the result.
+ * @param[in] n				- the numerator of the x-coordinate.
+ * @param[in] d				- the denominator of the x-coordinate.
+ */
+static void ep_map_rhs(fp_t r, const fp_t n, const fp_t d) {
+	fp_t t0, t1;
+
+	fp_null(t0);
+	fp_null(t1);
+
+	TRY {
+		fp_new(t0);
+		fp_new(t1);
+
+		fp_sqr(t0, d);
+		fp_mul(t1, t0, ep_curve_get_a());
+		fp_sqr(r, n);
+		fp_add(r, r, t1);
+		fp_mul(r, r, n);
+		fp_mul(t0, t0, d);
+		fp_mul(t1, t0, ep_curve_get_b());
+		fp_add(r, r, t1);
+		fp_mul(r, r, t0);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+	}
+}
+
+/**
+ * Maps a field element to a point using the Shallue-van de Woestijne map of
+ * RFC 9380 (Section 6.6.1) in a fixed sequence of field operations. The three
+ * candidate x-coordinates are kept as fractions n1/d, n2/d and n3/e^2, so no
+ * inversion is needed and the squareness tests return the y-coordinates too.
+ *
+ * The numerators N_i of g(x_i) satisfy N1 * N2 = c5^-2 * N3 as polynomials in
+ * u, hence when p = 3 mod 4 the power (N1 * N2)^((p + 1)/4) computed by the
+ * first two square roots already gives the square root of g(x3), and the map
+ * costs only two exponentiations. For the exceptional inputs with d * e = 0,
+ * RFC 9380 gives x1 = x2 = c2 and x3 = Z, so u is replaced by zero and the
+ * last candidate by the precomputed point (Z, c6). The point is returned in
+ * Jacobian coordinates with the sign of y still undetermined.
+ *
+ * @param[out] p			- the result.
+ * @param[in] u				- the field element to map.
+ */
+static void ep_map_svdw(ep_t p, const fp_t u) {
+	fp_t t0, t1, d, e, n1, n2, n3, y1, y2;
+	dig_t z, r1, r2;
+
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(d);
+	fp_null(e);
+	fp_null(n1);
+	fp_null(n2);
+	fp_null(n3);
+	fp_null(y1);
+	fp_null(y2);
+
+	TRY {
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(d);
+		fp_new(e);
+		fp_new(n1);
+		fp_new(n2);
+		fp_new(n3);
+		fp_new(y1);
+		fp_new(y2);
+
+		/* t0 = c1 * u^2, d = 1 + t0 and e = 1 - t0. */
+		fp_copy(y1, u);
+		fp_sqr(t0, y1);
+		fp_mul(t0, t0, ep_curve_get_map(1));
+		fp_set_dig(t1, 1);
+		fp_add(d, t1, t0);
+		fp_sub(e, t1, t0);
+		/* If d * e = 0, restart from u = 0. */
+		fp_mul(t0, d, e);
+		z = fp_is_zero(t0);
+		dv_copy_cond(d, t1, RLC_FP_DIGS, z);
+		dv_copy_cond(e, t1, RLC_FP_DIGS, z);
+		fp_zero(t1);
+		dv_copy_cond(y1, t1, RLC_FP_DIGS, z);
+
+		/* x1 = (c2 * d - c3 * u)/d and x2 = (c2 * d + c3 * u)/d. */
+		fp_mul(t0, y1, ep_curve_get_map(3));
+		fp_mul(n3, d, ep_curve_get_map(2));
+		fp_sub(n1, n3, t0);
+		fp_add(n2, n3, t0);
+
+		/* x3 = (Z * e^2 + c4 * d^2)/e^2. */
+		fp_sqr(t1, e);
+		fp_sqr(t0, d);
+		fp_mul(t0, t0, ep_curve_get_map(4));
+		fp_mul(n3, t1, ep_curve_get_map(0));
+		fp_add(n3, n3, t0);
+
+		/* Test the first two candidates. */
+		ep_map_rhs(t0, n1, d);
+		r1 = fp_srt(y1, t0);
+		ep_map_rhs(t0, n2, d);
+		r2 = fp_srt(y2, t0);
+
+		/* The last candidate is a square if the others are not. */
+		if (fp_prime_get_mod8() == 3 || fp_prime_get_mod8() == 7) {
+			/* Scale by d to get (n3 * e^2 * d^2, y1 * y2 * e^3 * c5, e^2 * d). */
+			fp_mul(p->y, y1, y2);
+			fp_sqr(t0, e);
+			fp_mul(t0, t0, e);
+			fp_mul(p->y, p->y, t0);
+			fp_mul(p->y, p->y, ep_curve_get_map(5));
+			fp_mul(p->z, t1, d);
+			fp_mul(p->x, n3, p->z);
+			fp_mul(p->x, p->x, d);
+		} else {
+			ep_map_rhs(t0, n3, t1);
+			fp_srt(p->y, t0);
+			fp_mul(p->x, n3, t1);
+			fp_copy(p->z, t1);
+		}
+		fp_set_dig(t0, 1);
+		dv_copy_cond(p->x, ep_curve_get_map(0), RLC_FP_DIGS, z);
+		dv_copy_cond(p->y, ep_curve_get_map(6), RLC_FP_DIGS, z);
+		dv_copy_cond(p->z, t0, RLC_FP_DIGS, z);
+
+		/* Choose x1 if g(x1) is a square, else x2 if g(x2) is, else x3. */
+		fp_mul(n1, n1, d);
+		fp_mul(n2, n2, d);
+		dv_copy_cond(p->x, n2, RLC_FP_DIGS, r2);
+		dv_copy_cond(p->y, y2, RLC_FP_DIGS, r2);
+		dv_copy_cond(p->x, n1, RLC_FP_DIGS, r1);
+		dv_copy_cond(p->y, y1, RLC_FP_DIGS, r1);
+		dv_copy_cond(p->z, d, RLC_FP_DIGS, r1 | r2);
+		p->norm = 0;
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(d);
+		fp_free(e);
+		fp_free(n1);
+		fp_free(n2);
+		fp_free(n3);
+		fp_free(y1);
+		fp_free(y2);
+	}
+}
+
+/**
+ * Converts a point produced by the Shallue-van de Woestijne map to affine
+ * coordinates and fixes the sign of its y-coordinate to match the input.
+ *
+ * @param[in,out] p			- the point to convert.
+ * @param[in] z				- the inverse of the z-coordinate of the point.
+ * @param[in] u				- the field element that was mapped.
+ */
+static void ep_map_sgn(ep_t p, const fp_t z, const fp_t u) {
+	fp_t t;
+
+	fp_null(t);
+
+	TRY {
+		fp_new(t);
+
+		fp_sqr(t, z);
+		fp_mul(p->x, p->x, t);
+		fp_mul(t, t, z);
+		fp_mul(p->y, p->y, t);
+		fp_set_dig(p->z, 1);
+		p->norm = 1;
+
+		fp_neg(t, p->y);
+		dv_copy_cond(p->y, t, RLC_FP_DIGS, ep_map_sgn0(u) ^ ep_map_sgn0(p->y));
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t);
+	}
+}
+
+#endif /* EP_MAP == SVDWM */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-void ep_map(ep_t p, const uint8_t *msg, int len) {
+#if EP_MAP == BASIC || !defined(STRIP)
+
+void ep_map_basic(ep_t p, const uint8_t *msg, int len) {
 	bn_t k;
 	fp_t t;
 	uint8_t digest[MD_LEN];
@@ -81,3 +335,83 @@ void ep_map(ep_t p, const uint8_t *msg, int len) {
 		fp_free(t);
 	}
 }
+
+#endif
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst,
+		int dst_len) {
+	bn_t k, n;
+	fp_t u0, u1, t0, t1;
+	ep_t q;
+	uint8_t buf[2 * EP_MAP_BYTES];
+
+	bn_null(k);
+	bn_null(n);
+	fp_null(u0);
+	fp_null(u1);
+	fp_null(t0);
+	fp_null(t1);
+	ep_null(q);
+
+	TRY {
+		bn_new(k);
+		bn_new(n);
+		fp_new(u0);
+		fp_new(u1);
+		fp_new(t0);
+		fp_new(t1);
+		ep_new(q);
+
+		/* Hash the message to two field elements. */
+		md_xmd(buf, sizeof(buf), msg, len, dst, dst_len);
+		bn_read_raw(n, fp_prime_get(), RLC_FP_DIGS);
+		bn_read_bin(k, buf, EP_MAP_BYTES);
+		bn_mod(k, k, n);
+		fp_prime_conv(u0, k);
+		bn_read_bin(k, buf + EP_MAP_BYTES, EP_MAP_BYTES);
+		bn_mod(k, k, n);
+		fp_prime_conv(u1, k);
+
+		ep_map_svdw(p, u0);
+		ep_map_svdw(q, u1);
+
+		/* Share a single inversion to bring both points to affine form. */
+		fp_mul(t0, p->z, q->z);
+		fp_inv(t0, t0);
+		fp_mul(t1, t0, q->z);
+		fp_mul(t0, t0, p->z);
+		ep_map_sgn(p, t1, u0);
+		ep_map_sgn(q, t0, u1);
+		ep_add(p, p, q);
+
+		/* Now, multiply by cofactor to get the correct group. */
+		ep_curve_get_cof(k);
+		if (bn_bits(k) < RLC_DIG) {
+			ep_mul_dig(p, p, k->dp[0]);
+		} else {
+			ep_mul(p, p, k);
+		}
+		ep_norm(p, p);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(k);
+		bn_free(n);
+		fp_free(u0);
+		fp_free(u1);
+		fp_free(t0);
+		fp_free(t1);
+		ep_free(q);
+	}
+}
+
+void ep_map_svdwm(ep_t p, const uint8_t *msg, int len) {
+	ep_map_dst(p, msg, len, (const uint8_t *)EP_MAP_DST,
+			sizeof(EP_MAP_DST) - 1);
+}
+
+#endif
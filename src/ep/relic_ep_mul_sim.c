@@ -384,6 +384,76 @@ static void ep_mul_sim_plain(ep_t r, const ep_t p, const bn_t k, const ep_t q,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Minimum number of points for which the bucket method is used.
+ */
+#define EP_LOT_MIN		8
+
+/**
+ * Chooses the window size for the bucket method of multi-scalar
+ * multiplication, minimizing the number of point additions needed to process
+ * a given number of scalars.
+ *
+ * @param[in] n				- the number of points.
+ * @param[in] bits			- the length of the scalars in bits.
+ * @return the window size.
+ */
+static int ep_mul_lot_win(int n, int bits) {
+	int c, w = 2, cost, min = 0;
+
+	for (c = 2; c <= 16; c++) {
+		/* Each window adds all points and sums 2^(c - 1) buckets. */
+		cost = (RLC_CEIL(bits, c) + 1) * (n + (1 << c));
+		if (c == 2 || cost < min) {
+			min = cost;
+			w = c;
+		}
+	}
+	return w;
+}
+
+/**
+ * Adds to r the points in q weighted by the i-th digits of their scalars
+ * recoded with bn_rec_sdw(), accumulating the points in buckets indexed by
+ * their digits.
+ *
+ * @param[in,out] r			- the accumulator.
+ * @param[in] q				- the points.
+ * @param[in] n				- the number of points.
+ * @param[in] d				- the recoded scalars, len digits per point.
+ * @param[in] len			- the number of digits per scalar.
+ * @param[in] i				- the index of the current window.
+ * @param[in] t				- the s buckets.
+ * @param[in] s				- the number of buckets.
+ * @param[in] u				- the first temporary point.
+ * @param[in] v				- the second temporary point.
+ */
+static void ep_mul_lot_add(ep_t r, ep_t *q, int n, const int *d, int len,
+		int i, ep_t *t, int s, ep_t u, ep_t v) {
+	int j, e;
+
+	for (j = 0; j < s; j++) {
+		ep_set_infty(t[j]);
+	}
+	for (j = 0; j < n; j++) {
+		e = d[j * len + i];
+		if (e > 0) {
+			ep_add(t[e - 1], t[e - 1], q[j]);
+		}
+		if (e < 0) {
+			ep_sub(t[-e - 1], t[-e - 1], q[j]);
+		}
+	}
+	/* Compute sum (j + 1) * t[j] with two running sums. */
+	ep_set_infty(u);
+	ep_set_infty(v);
+	for (j = s - 1; j >= 0; j--) {
+		ep_add(u, u, t[j]);
+		ep_add(v, v, u);
+	}
+	ep_add(r, r, v);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -666,3 +736,180 @@ void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m) {
 		ep_free(g);
 	}
 }
+
+void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int i, j, c, l, o, m = 0, s = 0, len, bits, endom = 0, *d = NULL;
+	bn_t ord, t, k0, k1, v1[3], v2[3];
+	ep_t u, v, *q = NULL, *b = NULL;
+
+	if (n <= 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+#if defined(EP_ENDOM)
+	endom = ep_curve_is_endom();
+#endif
+
+	bn_null(ord);
+	bn_null(t);
+	bn_null(k0);
+	bn_null(k1);
+	ep_null(u);
+	ep_null(v);
+
+	TRY {
+		bn_new(ord);
+		bn_new(t);
+		bn_new(k0);
+		bn_new(k1);
+		ep_new(u);
+		ep_new(v);
+		for (i = 0; i < 3; i++) {
+			bn_null(v1[i]);
+			bn_null(v2[i]);
+			bn_new(v1[i]);
+			bn_new(v2[i]);
+		}
+
+		if (n < EP_LOT_MIN) {
+			/* For a few points, interleaving in pairs is faster. */
+			ep_set_infty(r);
+			for (i = 0; i < n - 1; i += 2) {
+				ep_mul_sim(u, p[i], k[i], p[i + 1], k[i + 1]);
+				ep_add(r, r, u);
+			}
+			if (n & 1) {
+				ep_mul(u, p[n - 1], k[n - 1]);
+				ep_add(r, r, u);
+			}
+			ep_norm(r, r);
+		} else {
+			ep_curve_get_ord(ord);
+
+			/* Estimate the length of the subscalars to choose the window. */
+			bits = 0;
+			for (i = 0; i < n; i++) {
+				bits = RLC_MAX(bits, bn_bits(k[i]));
+			}
+			/* Scalars already shorter than the subscalars are not split. */
+			if (endom && bits <= bn_bits(ord) / 2 + 1) {
+				endom = 0;
+			}
+			if (endom) {
+				ep_curve_get_v1(v1);
+				ep_curve_get_v2(v2);
+				bits = bn_bits(ord);
+				l = bits / 2 + 1;
+				m = 2 * n;
+			} else {
+				l = bits;
+				m = n;
+			}
+			c = ep_mul_lot_win(m, l);
+			s = 1 << (c - 1);
+			len = RLC_CEIL(bits, c) + 1;
+
+			q = (ep_t *)calloc(m, sizeof(ep_t));
+			b = (ep_t *)calloc(s, sizeof(ep_t));
+			d = (int *)malloc(m * len * sizeof(int));
+			if (q == NULL || b == NULL || d == NULL) {
+				THROW(ERR_NO_MEMORY);
+			}
+			for (i = 0; i < m; i++) {
+				ep_null(q[i]);
+				ep_new(q[i]);
+			}
+			for (i = 0; i < s; i++) {
+				ep_null(b[i]);
+				ep_new(b[i]);
+			}
+
+			/* Skip trivial terms, since ep_norm_sim() cannot handle them. */
+			for (i = o = 0; i < n; i++) {
+				if (!ep_is_infty(p[i]) && !bn_is_zero(k[i])) {
+					ep_copy(q[o++], p[i]);
+				}
+			}
+			if (o > 0) {
+				ep_norm_sim(q, (const ep_t *)q, o);
+			}
+
+			/* Recode the scalars in signed windows and fix the point signs. */
+			for (i = j = l = 0; i < n; i++) {
+				if (ep_is_infty(p[i]) || bn_is_zero(k[i])) {
+					continue;
+				}
+#if defined(EP_ENDOM)
+				if (endom) {
+					bn_abs(t, k[i]);
+					if (bn_cmp(t, ord) != RLC_LT) {
+						bn_mod(t, t, ord);
+					}
+					bn_rec_glv(k0, k1, t, ord, (const bn_t *)v1,
+							(const bn_t *)v2);
+					ep_copy(q[o + j], q[j]);
+					fp_mul(q[o + j]->x, q[o + j]->x, ep_curve_get_beta());
+					if (bn_sign(k0) != bn_sign(k[i])) {
+						ep_neg(q[j], q[j]);
+					}
+					if (bn_sign(k1) != bn_sign(k[i])) {
+						ep_neg(q[o + j], q[o + j]);
+					}
+					l = RLC_MAX(l, RLC_MAX(bn_bits(k0), bn_bits(k1)));
+					bn_rec_sdw(d + j * len, len, k0, c);
+					bn_rec_sdw(d + (o + j) * len, len, k1, c);
+					j++;
+					continue;
+				}
+#endif
+				if (bn_sign(k[i]) == RLC_NEG) {
+					ep_neg(q[j], q[j]);
+				}
+				l = RLC_MAX(l, bn_bits(k[i]));
+				bn_rec_sdw(d + j * len, len, k[i], c);
+				j++;
+			}
+			o = (endom ? 2 * o : o);
+			l = RLC_MIN(RLC_CEIL(l, c) + 1, len);
+
+			ep_set_infty(r);
+			for (i = l - 1; i >= 0; i--) {
+				for (j = 0; j < c; j++) {
+					ep_dbl(r, r);
+				}
+				ep_mul_lot_add(r, q, o, d, len, i, b, s, u, v);
+			}
+			/* Convert r to affine coordinates. */
+			ep_norm(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(ord);
+		bn_free(t);
+		bn_free(k0);
+		bn_free(k1);
+		ep_free(u);
+		ep_free(v);
+		for (i = 0; i < 3; i++) {
+			bn_free(v1[i]);
+			bn_free(v2[i]);
+		}
+		if (q != NULL) {
+			for (i = 0; i < m; i++) {
+				ep_free(q[i]);
+			}
+		}
+		if (b != NULL) {
+			for (i = 0; i < s; i++) {
+				ep_free(b[i]);
+			}
+		}
+		free(q);
+		free(b);
+		free(d);
+	}
+}
@@ -526,11 +526,12 @@
 /*============================================================================*/
 
 int ep_param_get(void) {
-	return core_get()->ep_id;
+	return core_get_crv()->ep_id;
 }
 
 void ep_param_set(int param) {
 	int plain = 0, endom = 0, super = 0;
+	crv_t *ctx;
 	char str[2 * RLC_FP_BYTES + 2];
 	fp_t a, b, beta;
 	ep_t g;
@@ -553,7 +554,11 @@ void ep_param_set(int param) {
 		bn_new(r);
 		bn_new(h);
 
-		core_get()->ep_id = 0;
+		ctx = core_own_crv();
+		if (ctx != NULL) {
+			ctx->ep_id = 0;
+			core_done_crv();
+		}
 
 		switch (param) {
 #if defined(EP_ENDOM) && FP_PRIME == 158
@@ -748,21 +753,33 @@ void ep_param_set(int param) {
 #if defined(EP_PLAIN)
 		if (plain) {
 			ep_curve_set_plain(a, b, g, r, h);
-			core_get()->ep_id = param;
+			ctx = core_own_crv();
+			if (ctx != NULL) {
+				ctx->ep_id = param;
+				core_done_crv();
+			}
 		}
 #endif
 
 #if defined(EP_ENDOM)
 		if (endom) {
 			ep_curve_set_endom(b, g, r, h, beta, lamb);
-			core_get()->ep_id = param;
+			ctx = core_own_crv();
+			if (ctx != NULL) {
+				ctx->ep_id = param;
+				core_done_crv();
+			}
 		}
 #endif
 
 #if defined(EP_SUPER)
 		if (super) {
 			ep_curve_set_super(a, b, g, r, h);
-			core_get()->ep_id = param;
+			ctx = core_own_crv();
+			if (ctx != NULL) {
+				ctx->ep_id = param;
+				core_done_crv();
+			}
 		}
 #endif
 	}
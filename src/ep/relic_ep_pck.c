@@ -78,3 +78,12 @@ int ep_upk(ep_t r, const ep_t p) {
 	}
 	return result;
 }
+
+int ep_upk_x(ep_t r, const bn_t x, int y) {
+	fp_prime_conv(r->x, x);
+	fp_zero(r->y);
+	fp_set_bit(r->y, 0, y & 1);
+	fp_set_dig(r->z, 1);
+	r->norm = 1;
+	return ep_upk(r, r);
+}
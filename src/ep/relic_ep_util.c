@@ -289,6 +289,17 @@ void ep_read_bin(ep_t a, const uint8_t *bin, int len) {
 	}
 }
 
+void ep_read_bin_sim(ep_t *a, const uint8_t *bin, int len, int n) {
+	for (int i = 0; i < n; i++) {
+		ep_read_bin(a[i], bin + i * len, len);
+		/* Catch failed decompressions and points not on the curve. */
+		if (!ep_is_valid(a[i])) {
+			THROW(ERR_NO_VALID);
+			return;
+		}
+	}
+}
+
 void ep_write_bin(uint8_t *bin, int len, const ep_t a, int pack) {
 	ep_t t;
 
@@ -214,12 +214,129 @@
 	RLC_GET(str, CURVE##_R, sizeof(CURVE##_R));								\
 	bn_read_str(r, str, strlen(str), 16);									\
 
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+/**
+ * Precomputes the constants of the Shallue-van de Woestijne map for the curve
+ * y^2 = x^3 + ax + b, choosing the smallest integer Z as in RFC 9380.
+ *
+ * @param[out] c		- the constants Z, c1, c2, c3 and c4.
+ * @param[in] a			- the 'a' coefficient of the curve.
+ * @param[in] b			- the 'b' coefficient of the curve.
+ */
+static void detect_map(fp2_st *c, fp2_t a, fp2_t b) {
+	fp2_t z, gz, hz, t0, t1, c2, c3;
+	bn_t t;
+	int found = 0, s0, s1;
+
+	bn_null(t);
+	fp2_null(z);
+	fp2_null(gz);
+	fp2_null(hz);
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(c2);
+	fp2_null(c3);
+
+	TRY {
+		bn_new(t);
+		fp2_new(z);
+		fp2_new(gz);
+		fp2_new(hz);
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(c2);
+		fp2_new(c3);
+
+		for (int k = 2; k < 2 * RLC_DIG && !found; k++) {
+			/* Try Z = 1, -1, 2, -2, ... in this order. */
+			fp2_set_dig(z, k >> 1);
+			if (k & 1) {
+				fp2_neg(z, z);
+			}
+			/* gz = g(Z) = Z^3 + aZ + b. */
+			fp2_sqr(gz, z);
+			fp2_add(gz, gz, a);
+			fp2_mul(gz, gz, z);
+			fp2_add(gz, gz, b);
+			/* hz = 3Z^2 + 4a. */
+			fp2_sqr(hz, z);
+			fp2_dbl(t0, hz);
+			fp2_add(hz, hz, t0);
+			fp2_dbl(t0, a);
+			fp2_dbl(t0, t0);
+			fp2_add(hz, hz, t0);
+			if (fp2_is_zero(gz) || fp2_is_zero(hz)) {
+				continue;
+			}
+			/* -(3Z^2 + 4a)/(4g(Z)) is a square iff -g(Z)(3Z^2 + 4a) is. */
+			fp2_mul(t0, gz, hz);
+			fp2_neg(t0, t0);
+			if (!fp2_srt(c3, t0)) {
+				continue;
+			}
+			/* Either g(Z) or g(-Z/2) must be a square. */
+			fp_hlv(c2[0], z[0]);
+			fp_hlv(c2[1], z[1]);
+			fp2_neg(c2, c2);
+			fp2_sqr(t0, c2);
+			fp2_add(t0, t0, a);
+			fp2_mul(t0, t0, c2);
+			fp2_add(t0, t0, b);
+			if (fp2_srt(t1, gz) || fp2_srt(t1, t0)) {
+				found = 1;
+			}
+		}
+
+		if (!found) {
+			THROW(ERR_NO_VALID);
+		} else {
+			/* c4 = -4g(Z)/(3Z^2 + 4a). */
+			fp2_inv(t0, hz);
+			fp2_mul(t0, t0, gz);
+			fp2_dbl(t0, t0);
+			fp2_dbl(t0, t0);
+			fp2_neg(t0, t0);
+			/* c3 is the square root with sgn0(c3) = 0. */
+			fp_prime_back(t, c3[0]);
+			s0 = !bn_is_even(t);
+			fp_prime_back(t, c3[1]);
+			s1 = !bn_is_even(t);
+			if (s0 || (fp_is_zero(c3[0]) && s1)) {
+				fp2_neg(c3, c3);
+			}
+			for (int i = 0; i < 2; i++) {
+				fp_copy(c[0][i], z[i]);
+				fp_copy(c[1][i], gz[i]);
+				fp_copy(c[2][i], c2[i]);
+				fp_copy(c[3][i], c3[i]);
+				fp_copy(c[4][i], t0[i]);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		fp2_free(z);
+		fp2_free(gz);
+		fp2_free(hz);
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(c2);
+		fp2_free(c3);
+	}
+}
+
+#endif /* EP_MAP == SVDWM */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void ep2_curve_init(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
@@ -260,7 +377,7 @@ void ep2_curve_init(void) {
 }
 
 void ep2_curve_clean(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 #ifdef EP_PRECO
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		fp2_free(ctx->ep2_pre[i].x);
@@ -273,25 +390,35 @@ void ep2_curve_clean(void) {
 }
 
 int ep2_curve_is_twist(void) {
-	return core_get()->ep2_is_twist;
+	return core_get_crv()->ep2_is_twist;
 }
 
 void ep2_curve_get_gen(ep2_t g) {
-	ep2_copy(g, &(core_get()->ep2_g));
+	ep2_copy(g, &(core_get_crv()->ep2_g));
 }
 
 void ep2_curve_get_a(fp2_t a) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	fp_copy(a[0], ctx->ep2_a[0]);
 	fp_copy(a[1], ctx->ep2_a[1]);
 }
 
 void ep2_curve_get_b(fp2_t b) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	fp_copy(b[0], ctx->ep2_b[0]);
 	fp_copy(b[1], ctx->ep2_b[1]);
 }
 
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+void ep2_curve_get_map(fp2_t c, int i) {
+	crv_t *ctx = core_get_crv();
+	fp_copy(c[0], ctx->ep2_map_c[i][0]);
+	fp_copy(c[1], ctx->ep2_map_c[i][1]);
+}
+
+#endif
+
 void ep2_curve_get_vs(bn_t *v) {
 	bn_t x, t;
 
@@ -340,7 +467,7 @@ void ep2_curve_get_vs(bn_t *v) {
 }
 
 void ep2_curve_get_ord(bn_t n) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	if (ctx->ep2_is_twist) {
 		ep_curve_get_ord(n);
 	} else {
@@ -349,16 +476,16 @@ void ep2_curve_get_ord(bn_t n) {
 }
 
 void ep2_curve_get_cof(bn_t h) {
-	bn_copy(h, &(core_get()->ep2_h));
+	bn_copy(h, &(core_get_crv()->ep2_h));
 }
 
 #if defined(EP_PRECO)
 
 ep2_t *ep2_curve_get_tab(void) {
 #if ALLOC == AUTO
-	return (ep2_t *)*(core_get()->ep2_ptr);
+	return (ep2_t *)*(core_get_crv()->ep2_ptr);
 #else
-	return core_get()->ep2_ptr;
+	return core_get_crv()->ep2_ptr;
 #endif
 }
 
@@ -366,12 +493,16 @@ ep2_t *ep2_curve_get_tab(void) {
 
 void ep2_curve_set_twist(int type) {
 	char str[2 * RLC_FP_BYTES + 1];
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
 	ep2_t g;
 	fp2_t a;
 	fp2_t b;
 	bn_t r;
 
+	if (ctx == NULL) {
+		return;
+	}
+
 	ep2_null(g);
 	fp2_null(a);
 	fp2_null(b);
@@ -381,6 +512,7 @@ void ep2_curve_set_twist(int type) {
 	if (type == EP_MTYPE || type == EP_DTYPE) {
 		ctx->ep2_is_twist = type;
 	} else {
+		core_done_crv();
 		return;
 	}
 
@@ -448,6 +580,10 @@ void ep2_curve_set_twist(int type) {
 		/* I don't have a better place for this. */
 		fp_prime_calc();
 
+#if EP_MAP == SVDWM || !defined(STRIP)
+		detect_map(ctx->ep2_map_c, a, b);
+#endif
+
 #if defined(EP_PRECO)
 		ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
 #endif
@@ -460,11 +596,17 @@ void ep2_curve_set_twist(int type) {
 		fp2_free(a);
 		fp2_free(b);
 		bn_free(r);
+		core_done_crv();
 	}
 }
 
 void ep2_curve_set(fp2_t a, fp2_t b, ep2_t g, bn_t r, bn_t h) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
+
 	ctx->ep2_is_twist = 0;
 
 	fp2_copy(ctx->ep2_a, a);
@@ -474,7 +616,12 @@ void ep2_curve_set(fp2_t a, fp2_t b, ep2_t g, bn_t r, bn_t h) {
 	bn_copy(&(ctx->ep2_r), r);
 	bn_copy(&(ctx->ep2_h), h);
 
+#if EP_MAP == SVDWM || !defined(STRIP)
+	detect_map(ctx->ep2_map_c, a, b);
+#endif
+
 #if defined(EP_PRECO)
 	ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
 #endif
+	core_done_crv();
 }
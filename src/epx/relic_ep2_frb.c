@@ -82,3 +82,153 @@ void ep2_frb(ep2_t r, ep2_t p, int i) {
 			break;
 	}
 }
+
+void ep2_frb_rec(bn_t *ki, const bn_t k) {
+	int i, l;
+	bn_t n, u[4], v[4];
+
+	bn_null(n);
+
+	TRY {
+		bn_new(n);
+		for (i = 0; i < 4; i++) {
+			bn_null(u[i]);
+			bn_null(v[i]);
+			bn_new(u[i]);
+			bn_new(v[i]);
+		}
+
+		ep2_curve_get_ord(n);
+
+		switch (ep_param_get()) {
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P382:
+			case BN_P446:
+			case BN_P638:
+				ep2_curve_get_vs(v);
+
+				for (i = 0; i < 4; i++) {
+					bn_mul(v[i], v[i], k);
+					bn_div(v[i], v[i], n);
+					if (bn_sign(v[i]) == RLC_NEG) {
+						bn_add_dig(v[i], v[i], 1);
+					}
+					bn_zero(ki[i]);
+				}
+
+				/* u0 = x + 1, u1 = 2x + 1, u2 = 2x, u3 = x - 1. */
+				fp_param_get_var(u[0]);
+				bn_dbl(u[2], u[0]);
+				bn_add_dig(u[1], u[2], 1);
+				bn_sub_dig(u[3], u[0], 1);
+				bn_add_dig(u[0], u[0], 1);
+				bn_copy(ki[0], k);
+				for (i = 0; i < 4; i++) {
+					bn_mul(u[i], u[i], v[i]);
+					bn_mod(u[i], u[i], n);
+					bn_add(ki[0], ki[0], n);
+					bn_sub(ki[0], ki[0], u[i]);
+					bn_mod(ki[0], ki[0], n);
+				}
+
+				/* u0 = x, u1 = -x, u2 = 2x + 1, u3 = 4x + 2. */
+				fp_param_get_var(u[0]);
+				bn_neg(u[1], u[0]);
+				bn_dbl(u[2], u[0]);
+				bn_add_dig(u[2], u[2], 1);
+				bn_dbl(u[3], u[2]);
+				for (i = 0; i < 4; i++) {
+					bn_mul(u[i], u[i], v[i]);
+					bn_mod(u[i], u[i], n);
+					bn_add(ki[1], ki[1], n);
+					bn_sub(ki[1], ki[1], u[i]);
+					bn_mod(ki[1], ki[1], n);
+				}
+
+				/* u0 = x, u1 = -(x + 1), u2 = 2x + 1, u3 = -(2x - 1). */
+				fp_param_get_var(u[0]);
+				bn_add_dig(u[1], u[0], 1);
+				bn_neg(u[1], u[1]);
+				bn_dbl(u[2], u[0]);
+				bn_add_dig(u[2], u[2], 1);
+				bn_sub_dig(u[3], u[2], 2);
+				bn_neg(u[3], u[3]);
+				for (i = 0; i < 4; i++) {
+					bn_mul(u[i], u[i], v[i]);
+					bn_mod(u[i], u[i], n);
+					bn_add(ki[2], ki[2], n);
+					bn_sub(ki[2], ki[2], u[i]);
+					bn_mod(ki[2], ki[2], n);
+				}
+
+				/* u0 = -2x, u1 = -x, u2 = 2x + 1, u3 = x - 1. */
+				fp_param_get_var(u[1]);
+				bn_dbl(u[0], u[1]);
+				bn_neg(u[0], u[0]);
+				bn_dbl(u[2], u[1]);
+				bn_add_dig(u[2], u[2], 1);
+				bn_sub_dig(u[3], u[1], 1);
+				bn_neg(u[1], u[1]);
+				for (i = 0; i < 4; i++) {
+					bn_mul(u[i], u[i], v[i]);
+					bn_mod(u[i], u[i], n);
+					bn_add(ki[3], ki[3], n);
+					bn_sub(ki[3], ki[3], u[i]);
+					bn_mod(ki[3], ki[3], n);
+				}
+
+				for (i = 0; i < 4; i++) {
+					l = bn_bits(ki[i]);
+					bn_sub(ki[i], n, ki[i]);
+					if (bn_bits(ki[i]) > l) {
+						bn_sub(ki[i], ki[i], n);
+						ki[i]->sign = RLC_POS;
+					} else {
+						ki[i]->sign = RLC_NEG;
+					}
+				}
+				break;
+			case B12_P381:
+			case B12_P455:
+			case B12_P638:
+				bn_abs(v[0], k);
+				fp_param_get_var(u[0]);
+				bn_copy(u[1], u[0]);
+				if (bn_sign(u[0]) == RLC_NEG) {
+					bn_neg(u[0], u[0]);
+				}
+
+				for (i = 0; i < 4; i++) {
+					bn_mod(ki[i], v[0], u[0]);
+					bn_div(v[0], v[0], u[0]);
+					if ((bn_sign(u[1]) == RLC_NEG) && (i % 2 != 0)) {
+						bn_neg(ki[i], ki[i]);
+					}
+					if (bn_sign(k) == RLC_NEG) {
+						bn_neg(ki[i], ki[i]);
+					}
+				}
+
+				break;
+			default:
+				/* No decomposition is known, so keep the scalar as is. */
+				bn_copy(ki[0], k);
+				for (i = 1; i < 4; i++) {
+					bn_zero(ki[i]);
+				}
+				break;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		for (i = 0; i < 4; i++) {
+			bn_free(u[i]);
+			bn_free(v[i]);
+		}
+	}
+}
@@ -147,11 +147,451 @@ void ep2_mul_cof_b12(ep2_t r, ep2_t p) {
 	}
 }
 
+/**
+ * Multiplies a point by the cofactor of the currently configured curve.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ */
+static void ep2_mul_cof(ep2_t r, ep2_t p) {
+	bn_t k;
+
+	bn_null(k);
+
+	TRY {
+		bn_new(k);
+
+		switch (ep_param_get()) {
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P382:
+			case BN_P446:
+			case BN_P638:
+				ep2_mul_cof_bn(r, p);
+				break;
+			case B12_P381:
+			case B12_P455:
+			case B12_P638:
+				ep2_mul_cof_b12(r, p);
+				break;
+			default:
+				/* Now, multiply by cofactor to get the correct group. */
+				ep2_curve_get_cof(k);
+				if (bn_bits(k) < RLC_DIG) {
+					ep2_mul_dig(r, p, k->dp[0]);
+					if (bn_sign(k) == RLC_NEG) {
+						ep2_neg(r, r);
+					}
+				} else {
+					ep2_mul(r, p, k);
+				}
+				break;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(k);
+	}
+}
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+/**
+ * Number of bytes hashed per coordinate of a field element, the length L of
+ * RFC 9380 for a security level of 128 bits.
+ */
+#define EP2_MAP_BYTES	RLC_CEIL(FP_PRIME + 128, 8)
+
+/**
+ * Domain separation tag used by ep2_map_svdwm().
+ */
+#define EP2_MAP_DST		"RELIC_G2_XMD_SVDW_RO_"
+
+/**
+ * Conditionally copies a quadratic extension field element in constant time.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the element to copy.
+ * @param[in] cond			- the condition to copy.
+ */
+static void ep2_map_copy(fp2_t c, fp2_t a, dig_t cond) {
+	dv_copy_cond(c[0], a[0], RLC_FP_DIGS, cond);
+	dv_copy_cond(c[1], a[1], RLC_FP_DIGS, cond);
+}
+
+/**
+ * Returns the sign of a quadratic extension field element as defined by the
+ * sgn0 function of RFC 9380.
+ *
+ * @param[in] a				- the field element.
+ * @return the sign of the element.
+ */
+static dig_t ep2_map_sgn0(fp2_t a) {
+	dv_t t;
+	fp2_t r;
+	dig_t s0 = 0, s1, z0;
+
+	dv_null(t);
+	fp2_null(r);
+
+	TRY {
+		dv_new(t);
+		fp2_new(r);
+		/* Bring both coordinates to their canonical representatives. */
+		for (int i = 0; i < 2; i++) {
+#if FP_RDC == MONTY
+			dv_zero(t, 2 * RLC_FP_DIGS);
+			dv_copy(t, a[i], RLC_FP_DIGS);
+			fp_rdc(r[i], t);
+#else
+			fp_copy(r[i], a[i]);
+#endif
+		}
+		s0 = r[0][0] & 1;
+		s1 = r[1][0] & 1;
+		z0 = fp_is_zero(r[0]);
+		s0 = s0 | (z0 & s1);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		dv_free(t);
+		fp2_free(r);
+	}
+	return s0;
+}
+
+/**
+ * Computes a square root of a quadratic extension field element without
+ * branching on the element. The root c0 + c1 * i is returned multiplied by an
+ * element w of the base field, as c * w = (a0 +- s) + a1 * i for s the square
+ * root of the norm of a and w^2 = 2 * (a0 +- s), which avoids the inversion of
+ * fp2_srt(). Elements with a1 = 0, where a0 +- s may vanish, are handled
+ * apart, which only happens with negligible probability for hashed inputs.
+ *
+ * @param[out] c			- the square root multiplied by w.
+ * @param[out] w			- the scaling factor.
+ * @param[in] a				- the field element.
+ * @return 1 if the element is a square, 0 otherwise.
+ */
+static int ep2_map_srt(fp2_t c, fp_t w, fp2_t a) {
+	fp_t s, t0, t1, w1;
+	dig_t c0;
+	int r = 0;
+
+	fp_null(s);
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(w1);
+
+	TRY {
+		fp_new(s);
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(w1);
+
+		/* s = sqrt(a0^2 - qnr * a1^2), a is a square iff its norm is. */
+		fp_sqr(t0, a[0]);
+		fp_sqr(t1, a[1]);
+		for (int i = -1; i > fp_prime_get_qnr(); i--) {
+			fp_add(t0, t0, t1);
+		}
+		for (int i = 0; i <= fp_prime_get_qnr(); i++) {
+			fp_sub(t0, t0, t1);
+		}
+		fp_add(t0, t0, t1);
+		r = fp_srt(s, t0);
+
+		/* If a is a square, 2 * (a0 + s) or else 2 * (a0 - s) is a square. */
+		fp_sub(t1, a[0], s);
+		fp_add(c[0], a[0], s);
+		fp_dbl(t0, c[0]);
+		c0 = fp_srt(w, t0);
+		fp_dbl(t0, t1);
+		fp_srt(w1, t0);
+		dv_copy_cond(w, w1, RLC_FP_DIGS, c0 ^ 1);
+		dv_copy_cond(c[0], t1, RLC_FP_DIGS, c0 ^ 1);
+		fp_copy(c[1], a[1]);
+
+		if (fp_is_zero(a[1])) {
+			/* The root is sqrt(a0) or sqrt(a0 * qnr)/qnr * i. */
+			if (fp_prime_get_qnr() < 0) {
+				fp_set_dig(w, -fp_prime_get_qnr());
+				fp_neg(w, w);
+			} else {
+				fp_set_dig(w, fp_prime_get_qnr());
+			}
+			fp_mul(t0, a[0], w);
+			fp_srt(c[1], t0);
+			fp_zero(c[0]);
+			if (fp_srt(t0, a[0])) {
+				fp_copy(c[0], t0);
+				fp_zero(c[1]);
+				fp_set_dig(w, 1);
+			}
+			r = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(s);
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(w1);
+	}
+	return r;
+}
+
+/**
+ * Computes g(n/d) * d^6 = (n^3 + a * n * d^2 + b * d^3) * d^3 for the curve
+ * polynomial g(x), so that a single square root gives the y-coordinate of the
+ * point (n * d, y, d) in Jacobian coordinates without inverting d.
+ *
+ * @param[out] r			- the result.
+ * @param[in] n				- the numerator of the x-coordinate.
+ * @param[in] d				- the denominator of the x-coordinate.
+ * @param[in] a				- the 'a' coefficient of the curve.
+ * @param[in] b				- the 'b' coefficient of the curve.
+ */
+static void ep2_map_rhs(fp2_t r, fp2_t n, fp2_t d, fp2_t a, fp2_t b) {
+	fp2_t t0, t1;
+
+	fp2_null(t0);
+	fp2_null(t1);
+
+	TRY {
+		fp2_new(t0);
+		fp2_new(t1);
+
+		fp2_sqr(t0, d);
+		fp2_mul(t1, t0, a);
+		fp2_sqr(r, n);
+		fp2_add(r, r, t1);
+		fp2_mul(r, r, n);
+		fp2_mul(t0, t0, d);
+		fp2_mul(t1, t0, b);
+		fp2_add(r, r, t1);
+		fp2_mul(r, r, t0);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp2_free(t0);
+		fp2_free(t1);
+	}
+}
+
+/**
+ * Builds the Jacobian coordinates (n * d * w^2, y * w^3, d * w) of a candidate
+ * point with x-coordinate n/d from the output y * w of ep2_map_srt().
+ *
+ * @param[out] x			- the x-coordinate.
+ * @param[in,out] y			- the y-coordinate, multiplied by w on input.
+ * @param[out] z			- the z-coordinate.
+ * @param[in] n				- the numerator of the x-coordinate.
+ * @param[in] d				- the denominator of the x-coordinate.
+ * @param[in] w				- the scaling factor.
+ */
+static void ep2_map_scale(fp2_t x, fp2_t y, fp2_t z, fp2_t n, fp2_t d,
+		fp_t w) {
+	fp_t t;
+
+	fp_null(t);
+
+	TRY {
+		fp_new(t);
+
+		fp_sqr(t, w);
+		fp2_mul(x, n, d);
+		for (int i = 0; i < 2; i++) {
+			fp_mul(x[i], x[i], t);
+			fp_mul(y[i], y[i], t);
+			fp_mul(z[i], d[i], w);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t);
+	}
+}
+
+/**
+ * Maps a field element to a point using the Shallue-van de Woestijne map of
+ * RFC 9380 (Section 6.6.1) in a fixed sequence of field operations. The three
+ * candidate x-coordinates are kept as fractions n1/d, n2/d and n3/e^2, so no
+ * inversion is needed and the squareness tests return the y-coordinates too.
+ * The square roots come scaled by some w from ep2_map_srt(), which is absorbed
+ * in the Jacobian coordinates of each candidate. For the exceptional inputs
+ * with d * e = 0, RFC 9380 gives x1 = x2 = c2 and x3 = Z, so u is replaced by
+ * zero and the term c4 * d^2 of x3 is dropped. The point is returned in
+ * Jacobian coordinates with the sign of y still undetermined.
+ *
+ * @param[out] p			- the result.
+ * @param[in] u				- the field element to map.
+ */
+static void ep2_map_svdw(ep2_t p, fp2_t u) {
+	fp2_t a, b, c, t0, t1, d, e, n1, n2, n3, y1, y2;
+	fp_t w;
+	dig_t z, r1, r2;
+
+	fp2_null(a);
+	fp2_null(b);
+	fp2_null(c);
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(d);
+	fp2_null(e);
+	fp2_null(n1);
+	fp2_null(n2);
+	fp2_null(n3);
+	fp2_null(y1);
+	fp2_null(y2);
+	fp_null(w);
+
+	TRY {
+		fp2_new(a);
+		fp2_new(b);
+		fp2_new(c);
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(d);
+		fp2_new(e);
+		fp2_new(n1);
+		fp2_new(n2);
+		fp2_new(n3);
+		fp2_new(y1);
+		fp2_new(y2);
+		fp_new(w);
+
+		ep2_curve_get_a(a);
+		ep2_curve_get_b(b);
+
+		/* t0 = c1 * u^2, d = 1 + t0 and e = 1 - t0. */
+		fp2_copy(y1, u);
+		ep2_curve_get_map(c, 1);
+		fp2_sqr(t0, y1);
+		fp2_mul(t0, t0, c);
+		fp2_set_dig(t1, 1);
+		fp2_add(d, t1, t0);
+		fp2_sub(e, t1, t0);
+		/* If d * e = 0, restart from u = 0. */
+		fp2_mul(t0, d, e);
+		z = fp2_is_zero(t0);
+		ep2_map_copy(d, t1, z);
+		ep2_map_copy(e, t1, z);
+		fp2_zero(t1);
+		ep2_map_copy(y1, t1, z);
+
+		/* x1 = (c2 * d - c3 * u)/d and x2 = (c2 * d + c3 * u)/d. */
+		ep2_curve_get_map(c, 3);
+		fp2_mul(t0, y1, c);
+		ep2_curve_get_map(c, 2);
+		fp2_mul(n3, d, c);
+		fp2_sub(n1, n3, t0);
+		fp2_add(n2, n3, t0);
+
+		/* x3 = (Z * e^2 + c4 * d^2)/e^2. */
+		fp2_sqr(e, e);
+		fp2_sqr(t0, d);
+		ep2_curve_get_map(c, 4);
+		fp2_mul(t0, t0, c);
+		ep2_map_copy(t0, t1, z);
+		ep2_curve_get_map(c, 0);
+		fp2_mul(n3, e, c);
+		fp2_add(n3, n3, t0);
+
+		/* The last candidate is a square if the others are not. */
+		ep2_map_rhs(t0, n3, e, a, b);
+		ep2_map_srt(p->y, w, t0);
+		ep2_map_scale(p->x, p->y, p->z, n3, e, w);
+
+		/* Choose x1 if g(x1) is a square, else x2 if g(x2) is, else x3. */
+		ep2_map_rhs(t0, n2, d, a, b);
+		r2 = ep2_map_srt(y2, w, t0);
+		ep2_map_scale(n2, y2, t1, n2, d, w);
+		ep2_map_copy(p->x, n2, r2);
+		ep2_map_copy(p->y, y2, r2);
+		ep2_map_copy(p->z, t1, r2);
+		ep2_map_rhs(t0, n1, d, a, b);
+		r1 = ep2_map_srt(y1, w, t0);
+		ep2_map_scale(n1, y1, t1, n1, d, w);
+		ep2_map_copy(p->x, n1, r1);
+		ep2_map_copy(p->y, y1, r1);
+		ep2_map_copy(p->z, t1, r1);
+		p->norm = 0;
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp2_free(a);
+		fp2_free(b);
+		fp2_free(c);
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(d);
+		fp2_free(e);
+		fp2_free(n1);
+		fp2_free(n2);
+		fp2_free(n3);
+		fp2_free(y1);
+		fp2_free(y2);
+		fp_free(w);
+	}
+}
+
+/**
+ * Converts a point produced by the Shallue-van de Woestijne map to affine
+ * coordinates and fixes the sign of its y-coordinate to match the input.
+ *
+ * @param[in,out] p			- the point to convert.
+ * @param[in] z				- the inverse of the z-coordinate of the point.
+ * @param[in] u				- the field element that was mapped.
+ */
+static void ep2_map_sgn(ep2_t p, fp2_t z, fp2_t u) {
+	fp2_t t;
+
+	fp2_null(t);
+
+	TRY {
+		fp2_new(t);
+
+		fp2_sqr(t, z);
+		fp2_mul(p->x, p->x, t);
+		fp2_mul(t, t, z);
+		fp2_mul(p->y, p->y, t);
+		fp2_set_dig(p->z, 1);
+		p->norm = 1;
+
+		fp2_neg(t, p->y);
+		ep2_map_copy(p->y, t, ep2_map_sgn0(u) ^ ep2_map_sgn0(p->y));
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp2_free(t);
+	}
+}
+
+#endif /* EP_MAP == SVDWM */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-void ep2_map(ep2_t p, const uint8_t *msg, int len) {
+#if EP_MAP == BASIC || !defined(STRIP)
+
+void ep2_map_basic(ep2_t p, const uint8_t *msg, int len) {
 	bn_t x;
 	fp2_t t0;
 	uint8_t digest[MD_LEN];
@@ -182,33 +622,7 @@ void ep2_map(ep2_t p, const uint8_t *msg, int len) {
 			fp_add_dig(p->x[0], p->x[0], 1);
 		}
 
-		switch (ep_param_get()) {
-			case BN_P158:
-			case BN_P254:
-			case BN_P256:
-			case BN_P382:
-			case BN_P446:
-			case BN_P638:
-				ep2_mul_cof_bn(p, p);
-				break;
-			case B12_P381:
-			case B12_P455:
-			case B12_P638:
-				ep2_mul_cof_b12(p, p);
-				break;
-			default:
-				/* Now, multiply by cofactor to get the correct group. */
-				ep2_curve_get_cof(x);
-				if (bn_bits(x) < RLC_DIG) {
-					ep2_mul_dig(p, p, x->dp[0]);
-					if (bn_sign(x) == RLC_NEG) {
-						ep2_neg(p, p);
-					}
-				} else {
-					ep2_mul(p, p, x);
-				}
-				break;
-		}
+		ep2_mul_cof(p, p);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -218,3 +632,79 @@ void ep2_map(ep2_t p, const uint8_t *msg, int len) {
 		fp2_free(t0);
 	}
 }
+
+#endif
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+
+void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst,
+		int dst_len) {
+	bn_t k, n;
+	fp2_t u0, u1, t0, t1;
+	ep2_t q;
+	uint8_t buf[4 * EP2_MAP_BYTES];
+
+	bn_null(k);
+	bn_null(n);
+	fp2_null(u0);
+	fp2_null(u1);
+	fp2_null(t0);
+	fp2_null(t1);
+	ep2_null(q);
+
+	TRY {
+		bn_new(k);
+		bn_new(n);
+		fp2_new(u0);
+		fp2_new(u1);
+		fp2_new(t0);
+		fp2_new(t1);
+		ep2_new(q);
+
+		/* Hash the message to two field elements. */
+		md_xmd(buf, sizeof(buf), msg, len, dst, dst_len);
+		bn_read_raw(n, fp_prime_get(), RLC_FP_DIGS);
+		for (int i = 0; i < 2; i++) {
+			bn_read_bin(k, buf + i * EP2_MAP_BYTES, EP2_MAP_BYTES);
+			bn_mod(k, k, n);
+			fp_prime_conv(u0[i], k);
+			bn_read_bin(k, buf + (i + 2) * EP2_MAP_BYTES, EP2_MAP_BYTES);
+			bn_mod(k, k, n);
+			fp_prime_conv(u1[i], k);
+		}
+
+		ep2_map_svdw(p, u0);
+		ep2_map_svdw(q, u1);
+
+		/* Share a single inversion to bring both points to affine form. */
+		fp2_mul(t0, p->z, q->z);
+		fp2_inv(t0, t0);
+		fp2_mul(t1, t0, q->z);
+		fp2_mul(t0, t0, p->z);
+		ep2_map_sgn(p, t1, u0);
+		ep2_map_sgn(q, t0, u1);
+		ep2_add(p, p, q);
+
+		ep2_mul_cof(p, p);
+		ep2_norm(p, p);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(k);
+		bn_free(n);
+		fp2_free(u0);
+		fp2_free(u1);
+		fp2_free(t0);
+		fp2_free(t1);
+		ep2_free(q);
+	}
+}
+
+void ep2_map_svdwm(ep2_t p, const uint8_t *msg, int len) {
+	ep2_map_dst(p, msg, len, (const uint8_t *)EP2_MAP_DST,
+			sizeof(EP2_MAP_DST) - 1);
+}
+
+#endif
@@ -42,139 +42,18 @@
 
 static void ep2_mul_glv_imp(ep2_t r, ep2_t p, const bn_t k) {
 	int i, j, l;
-	bn_t n, _k[4], u[4], v[4];
+	bn_t _k[4];
 	ep2_t q[4];
 
-	bn_null(n);
-
 	TRY {
-		bn_new(n);
 		for (i = 0; i < 4; i++) {
-			bn_null(u[i]);
-			bn_null(v[i]);
 			bn_null(_k[i]);
 			ep2_null(q[i]);
-			bn_new(u[i]);
-			bn_new(v[i]);
 			bn_new(_k[i]);
 			ep2_new(q[i]);
 		}
 
-		ep2_curve_get_ord(n);
-
-		switch (ep_param_get()) {
-			case BN_P158:
-			case BN_P254:
-			case BN_P256:
-			case BN_P382:
-			case BN_P446:
-			case BN_P638:
-				ep2_curve_get_vs(v);
-
-				for (i = 0; i < 4; i++) {
-					bn_mul(v[i], v[i], k);
-					bn_div(v[i], v[i], n);
-					if (bn_sign(v[i]) == RLC_NEG) {
-						bn_add_dig(v[i], v[i], 1);
-					}
-					bn_zero(_k[i]);
-				}
-
-				/* u0 = x + 1, u1 = 2x + 1, u2 = 2x, u3 = x - 1. */
-				fp_param_get_var(u[0]);
-				bn_dbl(u[2], u[0]);
-				bn_add_dig(u[1], u[2], 1);
-				bn_sub_dig(u[3], u[0], 1);
-				bn_add_dig(u[0], u[0], 1);
-				bn_copy(_k[0], k);
-				for (i = 0; i < 4; i++) {
-					bn_mul(u[i], u[i], v[i]);
-					bn_mod(u[i], u[i], n);
-					bn_add(_k[0], _k[0], n);
-					bn_sub(_k[0], _k[0], u[i]);
-					bn_mod(_k[0], _k[0], n);
-				}
-
-				/* u0 = x, u1 = -x, u2 = 2x + 1, u3 = 4x + 2. */
-				fp_param_get_var(u[0]);
-				bn_neg(u[1], u[0]);
-				bn_dbl(u[2], u[0]);
-				bn_add_dig(u[2], u[2], 1);
-				bn_dbl(u[3], u[2]);
-				for (i = 0; i < 4; i++) {
-					bn_mul(u[i], u[i], v[i]);
-					bn_mod(u[i], u[i], n);
-					bn_add(_k[1], _k[1], n);
-					bn_sub(_k[1], _k[1], u[i]);
-					bn_mod(_k[1], _k[1], n);
-				}
-
-				/* u0 = x, u1 = -(x + 1), u2 = 2x + 1, u3 = -(2x - 1). */
-				fp_param_get_var(u[0]);
-				bn_add_dig(u[1], u[0], 1);
-				bn_neg(u[1], u[1]);
-				bn_dbl(u[2], u[0]);
-				bn_add_dig(u[2], u[2], 1);
-				bn_sub_dig(u[3], u[2], 2);
-				bn_neg(u[3], u[3]);
-				for (i = 0; i < 4; i++) {
-					bn_mul(u[i], u[i], v[i]);
-					bn_mod(u[i], u[i], n);
-					bn_add(_k[2], _k[2], n);
-					bn_sub(_k[2], _k[2], u[i]);
-					bn_mod(_k[2], _k[2], n);
-				}
-
-				/* u0 = -2x, u1 = -x, u2 = 2x + 1, u3 = x - 1. */
-				fp_param_get_var(u[1]);
-				bn_dbl(u[0], u[1]);
-				bn_neg(u[0], u[0]);
-				bn_dbl(u[2], u[1]);
-				bn_add_dig(u[2], u[2], 1);
-				bn_sub_dig(u[3], u[1], 1);
-				bn_neg(u[1], u[1]);
-				for (i = 0; i < 4; i++) {
-					bn_mul(u[i], u[i], v[i]);
-					bn_mod(u[i], u[i], n);
-					bn_add(_k[3], _k[3], n);
-					bn_sub(_k[3], _k[3], u[i]);
-					bn_mod(_k[3], _k[3], n);
-				}
-
-				for (i = 0; i < 4; i++) {
-					l = bn_bits(_k[i]);
-					bn_sub(_k[i], n, _k[i]);
-					if (bn_bits(_k[i]) > l) {
-						bn_sub(_k[i], _k[i], n);
-						_k[i]->sign = RLC_POS;
-					} else {
-						_k[i]->sign = RLC_NEG;
-					}
-				}
-				break;
-			case B12_P381:
-			case B12_P455:
-			case B12_P638:
-				bn_abs(v[0], k);
-				fp_param_get_var(u[0]);
-				bn_copy(u[1], u[0]);
-				if (bn_sign(u[0]) == RLC_NEG) {
-					bn_neg(u[0], u[0]);
-				}
-
-				for (i = 0; i < 4; i++) {
-					bn_mod(_k[i], v[0], u[0]);
-					bn_div(v[0], v[0], u[0]);
-					if ((bn_sign(u[1]) == RLC_NEG) && (i % 2 != 0)) {
-						bn_neg(_k[i], _k[i]);
-					}
-					if (bn_sign(k) == RLC_NEG) {
-						bn_neg(_k[i], _k[i]);
-					}
-				}
-
-				break;
-		}
+		ep2_frb_rec(_k, k);
 
 		ep2_norm(q[0], p);
 		ep2_frb(q[1], q[0], 1);
@@ -206,14 +85,10 @@ static void ep2_mul_glv_imp(ep2_t r, ep2_t p, const bn_t k) {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		bn_free(n);
 		for (i = 0; i < 4; i++) {
-			bn_free(u[i]);
-			bn_free(v[i]);
 			bn_free(_k[i]);
 			ep2_free(q[i]);
 		}
-
 	}
 }
 
@@ -135,6 +135,76 @@ static void ep2_mul_sim_plain(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t m,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Minimum number of points for which the bucket method is used.
+ */
+#define EP2_LOT_MIN		8
+
+/**
+ * Chooses the window size for the bucket method of multi-scalar
+ * multiplication, minimizing the number of point additions needed to process
+ * a given number of scalars.
+ *
+ * @param[in] n				- the number of points.
+ * @param[in] bits			- the length of the scalars in bits.
+ * @return the window size.
+ */
+static int ep2_mul_lot_win(int n, int bits) {
+	int c, w = 2, cost, min = 0;
+
+	for (c = 2; c <= 16; c++) {
+		/* Each window adds all points and sums 2^(c - 1) buckets. */
+		cost = (RLC_CEIL(bits, c) + 1) * (n + (1 << c));
+		if (c == 2 || cost < min) {
+			min = cost;
+			w = c;
+		}
+	}
+	return w;
+}
+
+/**
+ * Adds to r the points in q weighted by the i-th digits of their scalars
+ * recoded with bn_rec_sdw(), accumulating the points in buckets indexed by
+ * their digits.
+ *
+ * @param[in,out] r			- the accumulator.
+ * @param[in] q				- the points.
+ * @param[in] n				- the number of points.
+ * @param[in] d				- the recoded scalars, len digits per point.
+ * @param[in] len			- the number of digits per scalar.
+ * @param[in] i				- the index of the current window.
+ * @param[in] t				- the s buckets.
+ * @param[in] s				- the number of buckets.
+ * @param[in] u				- the first temporary point.
+ * @param[in] v				- the second temporary point.
+ */
+static void ep2_mul_lot_add(ep2_t r, ep2_t *q, int n, const int *d, int len,
+		int i, ep2_t *t, int s, ep2_t u, ep2_t v) {
+	int j, e;
+
+	for (j = 0; j < s; j++) {
+		ep2_set_infty(t[j]);
+	}
+	for (j = 0; j < n; j++) {
+		e = d[j * len + i];
+		if (e > 0) {
+			ep2_add(t[e - 1], t[e - 1], q[j]);
+		}
+		if (e < 0) {
+			ep2_sub(t[-e - 1], t[-e - 1], q[j]);
+		}
+	}
+	/* Compute sum (j + 1) * t[j] with two running sums. */
+	ep2_set_infty(u);
+	ep2_set_infty(v);
+	for (j = s - 1; j >= 0; j--) {
+		ep2_add(u, u, t[j]);
+		ep2_add(v, v, u);
+	}
+	ep2_add(r, r, v);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -396,3 +466,168 @@ void ep2_mul_sim_gen(ep2_t r, bn_t k, ep2_t q, bn_t m) {
 		ep2_free(gen);
 	}
 }
+
+void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+	int i, j, h, c, l, o, m = 0, s = 0, w = 1, len, bits, *d = NULL;
+	bn_t ord, t, _k[4];
+	ep2_t u, v, *q = NULL, *b = NULL;
+
+	if (n <= 0) {
+		ep2_set_infty(r);
+		return;
+	}
+
+#if defined(EP_ENDOM)
+	/* Split the scalars in four parts with the Frobenius map. */
+	if (ep_curve_is_endom()) {
+		w = 4;
+	}
+#endif
+
+	bn_null(ord);
+	bn_null(t);
+	ep2_null(u);
+	ep2_null(v);
+
+	TRY {
+		bn_new(ord);
+		bn_new(t);
+		ep2_new(u);
+		ep2_new(v);
+		for (i = 0; i < 4; i++) {
+			bn_null(_k[i]);
+			bn_new(_k[i]);
+		}
+
+		if (n < EP2_LOT_MIN) {
+			/* For a few points, interleaving in pairs is faster. */
+			ep2_set_infty(r);
+			for (i = 0; i < n - 1; i += 2) {
+				bn_copy(_k[0], k[i]);
+				bn_copy(_k[1], k[i + 1]);
+				ep2_mul_sim(u, p[i], _k[0], p[i + 1], _k[1]);
+				ep2_add(r, r, u);
+			}
+			if (n & 1) {
+				ep2_mul(u, p[n - 1], k[n - 1]);
+				ep2_add(r, r, u);
+			}
+			ep2_norm(r, r);
+		} else {
+			ep2_curve_get_ord(ord);
+
+			/* Estimate the length of the subscalars to choose the window. */
+			bits = 0;
+			for (i = 0; i < n; i++) {
+				bits = RLC_MAX(bits, bn_bits(k[i]));
+			}
+			/* Scalars already shorter than the subscalars are not split. */
+			if (w > 1 && bits <= bn_bits(ord) / w + 1) {
+				w = 1;
+			}
+			if (w > 1) {
+				bits = bn_bits(ord);
+				l = bits / w + 1;
+			} else {
+				l = bits;
+			}
+			m = w * n;
+			c = ep2_mul_lot_win(m, l);
+			s = 1 << (c - 1);
+			len = RLC_CEIL(bits, c) + 1;
+
+			q = (ep2_t *)calloc(m, sizeof(ep2_t));
+			b = (ep2_t *)calloc(s, sizeof(ep2_t));
+			d = (int *)malloc(m * len * sizeof(int));
+			if (q == NULL || b == NULL || d == NULL) {
+				THROW(ERR_NO_MEMORY);
+			}
+			for (i = 0; i < m; i++) {
+				ep2_null(q[i]);
+				ep2_new(q[i]);
+			}
+			for (i = 0; i < s; i++) {
+				ep2_null(b[i]);
+				ep2_new(b[i]);
+			}
+
+			/* Skip trivial terms, since ep2_norm_sim() cannot handle them. */
+			for (i = o = 0; i < n; i++) {
+				if (!ep2_is_infty(p[i]) && !bn_is_zero(k[i])) {
+					ep2_copy(q[o++], p[i]);
+				}
+			}
+			if (o > 0) {
+				ep2_norm_sim(q, q, o);
+			}
+
+			/* Recode the scalars in signed windows and fix the point signs. */
+			for (i = j = l = 0; i < n; i++) {
+				if (ep2_is_infty(p[i]) || bn_is_zero(k[i])) {
+					continue;
+				}
+				if (w > 1) {
+					bn_abs(t, k[i]);
+					if (bn_cmp(t, ord) != RLC_LT) {
+						bn_mod(t, t, ord);
+					}
+					ep2_frb_rec(_k, t);
+					for (h = 1; h < w; h++) {
+						ep2_frb(q[h * o + j], q[(h - 1) * o + j], 1);
+					}
+					for (h = 0; h < w; h++) {
+						if (bn_sign(_k[h]) != bn_sign(k[i])) {
+							ep2_neg(q[h * o + j], q[h * o + j]);
+						}
+						l = RLC_MAX(l, bn_bits(_k[h]));
+						bn_rec_sdw(d + (h * o + j) * len, len, _k[h], c);
+					}
+				} else {
+					if (bn_sign(k[i]) == RLC_NEG) {
+						ep2_neg(q[j], q[j]);
+					}
+					l = RLC_MAX(l, bn_bits(k[i]));
+					bn_rec_sdw(d + j * len, len, k[i], c);
+				}
+				j++;
+			}
+			o = w * o;
+			l = RLC_MIN(RLC_CEIL(l, c) + 1, len);
+
+			ep2_set_infty(r);
+			for (i = l - 1; i >= 0; i--) {
+				for (j = 0; j < c; j++) {
+					ep2_dbl(r, r);
+				}
+				ep2_mul_lot_add(r, q, o, d, len, i, b, s, u, v);
+			}
+			/* Convert r to affine coordinates. */
+			ep2_norm(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(ord);
+		bn_free(t);
+		ep2_free(u);
+		ep2_free(v);
+		for (i = 0; i < 4; i++) {
+			bn_free(_k[i]);
+		}
+		if (q != NULL) {
+			for (i = 0; i < m; i++) {
+				ep2_free(q[i]);
+			}
+		}
+		if (b != NULL) {
+			for (i = 0; i < s; i++) {
+				ep2_free(b[i]);
+			}
+		}
+		free(q);
+		free(b);
+		free(d);
+	}
+}
@@ -285,6 +285,17 @@ void ep2_read_bin(ep2_t a, const uint8_t *bin, int len) {
 	}
 }
 
+void ep2_read_bin_sim(ep2_t *a, const uint8_t *bin, int len, int n) {
+	for (int i = 0; i < n; i++) {
+		ep2_read_bin(a[i], bin + i * len, len);
+		/* Catch failed decompressions and points not on the curve. */
+		if (!ep2_is_valid(a[i])) {
+			THROW(ERR_NO_VALID);
+			return;
+		}
+	}
+}
+
 void ep2_write_bin(uint8_t *bin, int len, ep2_t a, int pack) {
 	ep2_t t;
 
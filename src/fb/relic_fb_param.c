@@ -44,10 +44,12 @@
 /*============================================================================*/
 
 int fb_param_get(void) {
-	return core_get()->fb_id;
+	return core_get_crv()->fb_id;
 }
 
 void fb_param_set(int param) {
+	crv_t *ctx;
+
 	switch (param) {
 		case PENTA_8:
 			fb_poly_set_penta(4, 3, 2);
@@ -138,7 +140,11 @@ void fb_param_set(int param) {
 			THROW(ERR_NO_VALID);
 			break;
 	}
-	core_get()->fb_id = param;
+	ctx = core_own_crv();
+	if (ctx != NULL) {
+		ctx->fb_id = param;
+		core_done_crv();
+	}
 }
 
 void fb_param_set_any(void) {
@@ -54,7 +54,7 @@
 static void find_trace(void) {
 	fb_t t0, t1;
 	int counter;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	fb_null(t0);
 	fb_null(t1);
@@ -116,7 +116,7 @@ static void find_trace(void) {
 static void find_solve(void) {
 	int i, j, k, l;
 	fb_t t0;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	fb_null(t0);
 
@@ -158,7 +158,7 @@ static void find_solve(void) {
  * Precomputes the square root of z.
  */
 static void find_srz(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	fb_set_dig(ctx->fb_srz, 2);
 
@@ -182,7 +182,7 @@ static void find_srz(void) {
  */
 static void find_chain(void) {
 	int i, j, k, l;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	ctx->chain_len = -1;
 	for (int i = 0; i < RLC_TERMS; i++) {
@@ -300,7 +300,7 @@ static void find_chain(void) {
  * @param[in] f				- the new irreducible polynomial.
  */
 static void fb_poly_set(const fb_t f) {
-	fb_copy(core_get()->fb_poly, f);
+	fb_copy(core_get_crv()->fb_poly, f);
 #if FB_TRC == QUICK || !defined(STRIP)
 	find_trace();
 #endif
@@ -320,7 +320,7 @@ static void fb_poly_set(const fb_t f) {
 /*============================================================================*/
 
 void fb_poly_init(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	fb_zero(ctx->fb_poly);
 	ctx->fb_pa = ctx->fb_pb = ctx->fb_pc = 0;
@@ -331,11 +331,11 @@ void fb_poly_clean(void) {
 }
 
 dig_t *fb_poly_get(void) {
-	return core_get()->fb_poly;
+	return core_get_crv()->fb_poly;
 }
 
 void fb_poly_add(fb_t c, const fb_t a) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	if (c != a) {
 		fb_copy(c, a);
@@ -363,15 +363,25 @@ void fb_poly_add(fb_t c, const fb_t a) {
 }
 
 void fb_poly_set_dense(const fb_t f) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
+
 	fb_poly_set(f);
 	ctx->fb_pa = ctx->fb_pb = ctx->fb_pc = 0;
 	ctx->fb_na = ctx->fb_nb = ctx->fb_nc = -1;
+	core_done_crv();
 }
 
 void fb_poly_set_trino(int a) {
 	fb_t f;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
 
 	fb_null(f);
 
@@ -394,12 +404,17 @@ void fb_poly_set_trino(int a) {
 	}
 	FINALLY {
 		fb_free(f);
+		core_done_crv();
 	}
 }
 
 void fb_poly_set_penta(int a, int b, int c) {
 	fb_t f;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_own_crv();
+
+	if (ctx == NULL) {
+		return;
+	}
 
 	fb_null(f);
 
@@ -427,12 +442,13 @@ void fb_poly_set_penta(int a, int b, int c) {
 	}
 	FINALLY {
 		fb_free(f);
+		core_done_crv();
 	}
 }
 
 dig_t *fb_poly_get_srz(void) {
 #if FB_SRT == QUICK || !defined(STRIP)
-	return core_get()->fb_srz;
+	return core_get_crv()->fb_srz;
 #else
 	return NULL;
 #endif
@@ -442,9 +458,9 @@ const fb_t *fb_poly_tab_sqr(int i) {
 #if FB_INV == ITOHT || !defined(STRIP)
 	/* If ITOHT inversion is used and tables are precomputed, return them. */
 #if ALLOC == AUTO
-	return (const fb_t *)*core_get()->fb_tab_ptr[i];
+	return (const fb_t *)*core_get_crv()->fb_tab_ptr[i];
 #else
-	return (const fb_t *)core_get()->fb_tab_ptr[i];
+	return (const fb_t *)core_get_crv()->fb_tab_ptr[i];
 #endif
 
 #else
@@ -456,7 +472,7 @@ const dig_t *fb_poly_tab_srz(int i) {
 #if FB_SRT == QUICK || !defined(STRIP)
 
 #ifdef FB_PRECO
-	return core_get()->fb_tab_srz[i];
+	return core_get_crv()->fb_tab_srz[i];
 #else
 	return NULL;
 #endif
@@ -468,7 +484,7 @@ const dig_t *fb_poly_tab_srz(int i) {
 
 void fb_poly_get_trc(int *a, int *b, int *c) {
 #if FB_TRC == QUICK || !defined(STRIP)
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	*a = ctx->fb_ta;
 	*b = ctx->fb_tb;
 	*c = ctx->fb_tc;
@@ -478,7 +494,7 @@ void fb_poly_get_trc(int *a, int *b, int *c) {
 }
 
 void fb_poly_get_rdc(int *a, int *b, int *c) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	*a = ctx->fb_pa;
 	*b = ctx->fb_pb;
 	*c = ctx->fb_pc;
@@ -486,7 +502,7 @@ void fb_poly_get_rdc(int *a, int *b, int *c) {
 
 const dig_t *fb_poly_get_slv(void) {
 #if FB_SLV == QUICK || !defined(STRIP)
-	return (dig_t *)&(core_get()->fb_half);
+	return (dig_t *)&(core_get_crv()->fb_half);
 #else
 	return NULL;
 #endif
@@ -494,7 +510,7 @@ const dig_t *fb_poly_get_slv(void) {
 
 const int *fb_poly_get_chain(int *len) {
 #if FB_INV == ITOHT || !defined(STRIP)
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	if (ctx->chain_len > 0 && ctx->chain_len < RLC_TERMS) {
 		if (len != NULL) {
 			*len = ctx->chain_len;
@@ -399,6 +399,21 @@ void fp_inv_exgcd(fp_t c, const fp_t a) {
 
 #endif
 
+#if FP_INV == DIVST || !defined(STRIP)
+
+void fp_inv_divst(fp_t c, const fp_t a) {
+	if (dv_inv_divst(c, a, fp_prime_get(), RLC_FP_DIGS) != RLC_OK) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+#if FP_RDC == MONTY
+	/* The inverse of aR is a^(-1)R^(-1), so multiply it by R^3. */
+	fp_mul(c, c, core_get_crv()->conv3.dp);
+#endif
+}
+
+#endif
+
 #if FP_INV == LOWER || !defined(STRIP)
 
 void fp_inv_lower(fp_t c, const fp_t a) {
@@ -57,7 +57,7 @@
 /*============================================================================*/
 
 int fp_param_get(void) {
-	return core_get()->fp_id;
+	return core_get_crv()->fp_id;
 }
 
 void fp_param_get_var(bn_t x) {
@@ -362,6 +362,7 @@ void fp_param_get_map(int *s, int *len) {
 
 void fp_param_set(int param) {
 	bn_t t0, t1, t2, p;
+	crv_t *ctx;
 	int f[10] = { 0 };
 
 	bn_null(t0);
@@ -378,7 +379,11 @@ void fp_param_set(int param) {
 		bn_new(t2);
 		bn_new(p);
 
-		core_get()->fp_id = param;
+		ctx = core_own_crv();
+		if (ctx != NULL) {
+			ctx->fp_id = param;
+			core_done_crv();
+		}
 
 		switch (param) {
 #if FP_PRIME == 158
@@ -758,7 +763,11 @@ void fp_param_set(int param) {
 #else
 			default:
 				fp_param_set_any_dense();
-				core_get()->fp_id = 0;
+				ctx = core_own_crv();
+				if (ctx != NULL) {
+					ctx->fp_id = 0;
+					core_done_crv();
+				}
 				break;
 #endif
 		}
@@ -38,6 +38,73 @@
 /* Private definitions                                                        */
 /*============================================================================*/
 
+/**
+ * Computes the constants required for extracting square roots.
+ */
+static void srt_calc(void) {
+	bn_t e;
+	fp_t t;
+	dig_t i;
+	crv_t *ctx = core_get_crv();
+
+	bn_null(e);
+	fp_null(t);
+
+	TRY {
+		bn_new(e);
+		fp_new(t);
+
+		/* leg = (p - 1)/2. */
+		bn_sub_dig(&(ctx->leg), &(ctx->prime), 1);
+		bn_rsh(&(ctx->leg), &(ctx->leg), 1);
+
+		switch (ctx->mod8) {
+			case 3:
+			case 7:
+				/* srt = (p - 3)/4 and z = -1. */
+				bn_sub_dig(&(ctx->srt), &(ctx->prime), 3);
+				bn_rsh(&(ctx->srt), &(ctx->srt), 2);
+				ctx->srt_f = 1;
+				fp_set_dig(ctx->srt_z, 1);
+				fp_neg(ctx->srt_z, ctx->srt_z);
+				break;
+			case 5:
+				/* srt = (p - 5)/8 and z = 2^((p - 1)/4) = sqrt(-1). */
+				bn_sub_dig(&(ctx->srt), &(ctx->prime), 5);
+				bn_rsh(&(ctx->srt), &(ctx->srt), 3);
+				ctx->srt_f = 2;
+				bn_rsh(e, &(ctx->leg), 1);
+				fp_set_dig(t, 2);
+				fp_exp(ctx->srt_z, t, e);
+				break;
+			case 1:
+				/* Write p - 1 as e * 2^f with odd e, so that srt = (e - 1)/2. */
+				bn_sub_dig(e, &(ctx->prime), 1);
+				ctx->srt_f = 0;
+				while (bn_is_even(e)) {
+					bn_rsh(e, e, 1);
+					ctx->srt_f++;
+				}
+				bn_rsh(&(ctx->srt), e, 1);
+				/* Find the smallest quadratic non-residue z and compute z^e. */
+				i = 1;
+				do {
+					fp_set_dig(t, ++i);
+					fp_exp(ctx->srt_z, t, &(ctx->leg));
+				} while (fp_cmp_dig(ctx->srt_z, 1) == RLC_EQ);
+				fp_exp(ctx->srt_z, t, e);
+				break;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(e);
+		fp_free(t);
+	}
+}
+
 /**
  * Assigns the prime field modulus.
  *
@@ -46,12 +113,17 @@
 static void fp_prime_set(const bn_t p) {
 	dv_t s, q;
 	bn_t t;
-	ctx_t *ctx = core_get();
+	crv_t *ctx;
 
 	if (p->used != RLC_FP_DIGS) {
 		THROW(ERR_NO_VALID);
 	}
 
+	ctx = core_own_crv();
+	if (ctx == NULL) {
+		return;
+	}
+
 	dv_null(s);
 	bn_null(t);
 	dv_null(q);
@@ -101,7 +173,13 @@ static void fp_prime_set(const bn_t p) {
 		bn_set_dig(&(ctx->one), 1);
 		bn_lsh(&(ctx->one), &(ctx->one), ctx->prime.used * RLC_DIG);
 		bn_mod(&(ctx->one), &(ctx->one), &(ctx->prime));
+		bn_mul(t, &(ctx->conv), &(ctx->one));
+		bn_mod(t, t, &(ctx->prime));
+		dv_zero(ctx->conv3.dp, RLC_FP_DIGS);
+		dv_copy(ctx->conv3.dp, t->dp, t->used);
+		ctx->conv3.used = t->used;
 #endif
+		srt_calc();
 		fp_prime_calc();
 	}
 	CATCH_ANY {
@@ -111,6 +189,7 @@ static void fp_prime_set(const bn_t p) {
 		bn_free(t);
 		dv_free(s);
 		dv_free(q);
+		core_done_crv();
 	}
 }
 
@@ -122,7 +201,7 @@ static void fp_prime_set(const bn_t p) {
 static void fp2_calc(void) {
 	bn_t e;
 	fp2_t t0, t1;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	bn_null(e);
 	fp2_null(t0);
@@ -189,7 +268,7 @@ static void fp2_calc(void) {
 static void fp3_calc(void) {
 	bn_t e;
 	fp3_t t0, t1, t2;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	bn_null(e);
 	fp3_null(t0);
@@ -293,9 +372,11 @@ static void fp3_calc(void) {
 /*============================================================================*/
 
 void fp_prime_init(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	ctx->fp_id = 0;
 	bn_init(&(ctx->prime), RLC_FP_DIGS);
+	bn_init(&(ctx->srt), RLC_FP_DIGS);
+	bn_init(&(ctx->leg), RLC_FP_DIGS);
 #if FP_RDC == QUICK || !defined(STRIP)
 	ctx->sps_len = 0;
 	memset(ctx->sps, 0, sizeof(ctx->sps));
@@ -303,34 +384,38 @@ void fp_prime_init(void) {
 #if FP_RDC == MONTY || !defined(STRIP)
 	bn_init(&(ctx->conv), RLC_FP_DIGS);
 	bn_init(&(ctx->one), RLC_FP_DIGS);
+	bn_init(&(ctx->conv3), RLC_FP_DIGS);
 #endif
 }
 
 void fp_prime_clean(void) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	ctx->fp_id = 0;
 #if FP_RDC == QUICK || !defined(STRIP)
 	ctx->sps_len = 0;
 	memset(ctx->sps, 0, sizeof(ctx->sps));
 #endif
 #if FP_RDC == MONTY || !defined(STRIP)
+	bn_clean(&(ctx->conv3));
 	bn_clean(&(ctx->one));
 	bn_clean(&(ctx->conv));
 #endif
+	bn_clean(&(ctx->leg));
+	bn_clean(&(ctx->srt));
 	bn_clean(&(ctx->prime));
 }
 
 const dig_t *fp_prime_get(void) {
-	return core_get()->prime.dp;
+	return core_get_crv()->prime.dp;
 }
 
 const dig_t *fp_prime_get_rdc(void) {
-	return &(core_get()->u);
+	return &(core_get_crv()->u);
 }
 
 const int *fp_prime_get_sps(int *len) {
 #if FP_RDC == QUICK || !defined(STRIP)
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 	if (ctx->sps_len > 0 && ctx->sps_len < RLC_TERMS) {
 		if (len != NULL) {
 			*len = ctx->sps_len;
@@ -349,22 +434,22 @@ const int *fp_prime_get_sps(int *len) {
 
 const dig_t *fp_prime_get_conv(void) {
 #if FP_RDC == MONTY || !defined(STRIP)
-	return core_get()->conv.dp;
+	return core_get_crv()->conv.dp;
 #else
 	return NULL;
 #endif
 }
 
 dig_t fp_prime_get_mod8(void) {
-	return core_get()->mod8;
+	return core_get_crv()->mod8;
 }
 
 int fp_prime_get_qnr(void) {
-	return core_get()->qnr;
+	return core_get_crv()->qnr;
 }
 
 int fp_prime_get_cnr(void) {
-	return core_get()->cnr;
+	return core_get_crv()->cnr;
 }
 
 void fp_prime_set_dense(const bn_t p) {
@@ -405,12 +490,15 @@ void fp_prime_set_pmers(const int *f, int len) {
 		}
 
 #if FP_RDC == QUICK || !defined(STRIP)
-		ctx_t *ctx = core_get();
-		for (int i = 0; i < len; i++) {
-			ctx->sps[i] = f[i];
+		crv_t *ctx = core_own_crv();
+		if (ctx != NULL) {
+			for (int i = 0; i < len; i++) {
+				ctx->sps[i] = f[i];
+			}
+			ctx->sps[len] = 0;
+			ctx->sps_len = len;
+			core_done_crv();
 		}
-		ctx->sps[len] = 0;
-		ctx->sps_len = len;
 #endif /* FP_RDC == QUICK */
 
 		fp_prime_set(p);
@@ -444,16 +532,16 @@ void fp_prime_conv(fp_t c, const bn_t a) {
 		bn_new(t);
 
 #if FP_RDC == MONTY
-		bn_mod(t, a, &(core_get()->prime));
+		bn_mod(t, a, &(core_get_crv()->prime));
 		bn_lsh(t, t, RLC_FP_DIGS * RLC_DIG);
-		bn_mod(t, t, &(core_get()->prime));
+		bn_mod(t, t, &(core_get_crv()->prime));
 		dv_copy(c, t->dp, RLC_FP_DIGS);
 #else
 		if (a->used > RLC_FP_DIGS) {
 			THROW(ERR_NO_PRECI);
 		}
 
-		bn_mod(t, a, &(core_get()->prime));
+		bn_mod(t, a, &(core_get_crv()->prime));
 
 		if (bn_is_zero(t)) {
 			fp_zero(c);
@@ -479,7 +567,7 @@ void fp_prime_conv(fp_t c, const bn_t a) {
 
 void fp_prime_conv_dig(fp_t c, dig_t a) {
 	dv_t t;
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	bn_null(t);
 
@@ -24,7 +24,7 @@
 /**
  * @file
  *
- * Implementation of the square root function.
+ * Implementation of the square root and Legendre symbol functions.
  *
  * @ingroup bn
  */
@@ -32,101 +32,384 @@
 #include "relic_core.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-int fp_srt(fp_t c, const fp_t a) {
-	bn_t e;
-	fp_t t0;
-	fp_t t1;
-	int r = 0;
+/**
+ * Maximum number of temporaries used by an addition chain.
+ */
+#define SRT_SLOTS		32
 
-	bn_null(e);
-	fp_null(t0);
-	fp_null(t1);
+/**
+ * Raises an element to a power with one of the addition chains below.
+ *
+ * @param[out] C			- the result.
+ * @param[in] A				- the element to exponentiate.
+ * @param[in] T				- the addition chain.
+ */
+#define fp_exp_chain_imp(C, A, T)											\
+	fp_exp_chain(C, A, T, sizeof(T) / sizeof(T[0]))
 
-	TRY {
-		bn_new(e);
-		fp_new(t0);
-		fp_new(t1);
+#if FP_PRIME == 254
+/**
+ * Addition chain for the square-root exponent of BN_254 (273 operations).
+ */
+static const uint8_t srt_bn_254[][4] = {
+	{1, 0, 0, 0}, {2, 0, 0, 1}, {3, 2, 0, 1}, {4, 3, 0, 1}, {5, 4, 0, 1},
+	{6, 5, 0, 1}, {7, 6, 0, 1}, {8, 5, 5, 5}, {8, 8, 7, 7}, {8, 8, 4, 5},
+	{8, 8, 3, 0}, {8, 8, 9, 5}, {8, 8, 33, 7}, {8, 8, 4, 7}, {8, 8, 7, 7},
+	{8, 8, 7, 5}, {8, 8, 4, 6}, {8, 8, 36, 0}, {8, 8, 6, 2}, {8, 8, 8, 5},
+	{8, 8, 5, 0}, {8, 8, 47, 5}, {8, 8, 4, 7}, {8, 8, 5, 4}, {8, 8, 52, 0},
+	{8, 8, 2, 8}
+};
+#endif
 
-		/* Make e = p. */
-		e->used = RLC_FP_DIGS;
-		dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
+#if FP_PRIME == 255
+/**
+ * Addition chain for the square-root exponent of PRIME_25519 (270 operations).
+ */
+static const uint8_t srt_prime_25519[][4] = {
+	{1, 0, 1, 0}, {2, 1, 1, 0}, {3, 2, 1, 0}, {4, 3, 1, 0}, {5, 4, 1, 0},
+	{6, 5, 1, 0}, {7, 6, 1, 0}, {8, 7, 1, 0}, {9, 8, 1, 0}, {10, 9, 8, 7},
+	{11, 10, 10, 9}, {12, 11, 10, 9}, {13, 12, 10, 9}, {14, 13, 48, 13},
+	{14, 14, 48, 13}, {14, 14, 48, 13}, {14, 14, 48, 13}, {14, 14, 10, 9},
+	{14, 14, 2, 0}
+};
+#endif
 
-		if (fp_prime_get_mod8() == 3 || fp_prime_get_mod8() == 7) {
-			/* Easy case, compute a^((p + 1)/4). */
-			bn_add_dig(e, e, 1);
-			bn_rsh(e, e, 2);
+#if FP_PRIME == 256
+/**
+ * Addition chain for the square-root exponent of NIST_256 (268 operations).
+ */
+static const uint8_t srt_nist_256[][4] = {
+	{1, 0, 1, 0}, {2, 1, 2, 1}, {3, 2, 2, 1}, {4, 3, 4, 2}, {5, 4, 4, 2},
+	{6, 5, 4, 2}, {7, 6, 4, 2}, {8, 7, 4, 2}, {9, 8, 4, 2}, {10, 9, 2, 1},
+	{10, 10, 32, 0}, {10, 10, 126, 9}, {10, 10, 30, 9}, {10, 10, 30, 9},
+	{10, 10, 4, 2}
+};
+#endif
 
-			fp_exp(t0, a, e);
-			fp_sqr(t1, t0);
-			r = (fp_cmp(t1, a) == RLC_EQ);
-			fp_copy(c, t0);
-		} else {
-			int f = 0, m = 0;
+#if FP_PRIME == 256
+/**
+ * Addition chain for the square-root exponent of SECG_256 (273 operations).
+ */
+static const uint8_t srt_secg_256[][4] = {
+	{1, 0, 1, 0}, {2, 1, 1, 0}, {3, 2, 2, 1}, {4, 3, 2, 1}, {5, 4, 1, 0},
+	{6, 5, 7, 4}, {7, 6, 7, 4}, {8, 7, 2, 1}, {9, 8, 24, 8}, {9, 9, 24, 8},
+	{9, 9, 24, 8}, {9, 9, 24, 8}, {9, 9, 24, 8}, {9, 9, 24, 8}, {9, 9, 24, 8},
+	{9, 9, 24, 8}, {9, 9, 7, 4}, {9, 9, 23, 7}, {9, 9, 5, 0}, {9, 9, 3, 1}
+};
+#endif
+
+#if FP_PRIME == 381
+/**
+ * Addition chain for the square-root exponent of B12_381 (456 operations).
+ */
+static const uint8_t srt_b12_381[][4] = {
+	{1, 0, 0, 0}, {2, 0, 0, 1}, {3, 2, 0, 1}, {4, 3, 0, 1}, {5, 4, 0, 1},
+	{6, 5, 0, 1}, {7, 6, 0, 1}, {8, 7, 0, 1}, {9, 8, 0, 1}, {10, 9, 0, 1},
+	{11, 10, 0, 1}, {12, 11, 0, 1}, {13, 12, 0, 1}, {14, 13, 0, 1},
+	{15, 14, 0, 1}, {16, 8, 3, 4}, {17, 16, 1, 0}, {18, 7, 13, 9},
+	{18, 18, 7, 8}, {18, 18, 4, 3}, {18, 18, 6, 4}, {18, 18, 7, 12},
+	{18, 18, 7, 16}, {18, 18, 6, 7}, {18, 18, 6, 7}, {18, 18, 6, 5},
+	{18, 18, 3, 2}, {18, 18, 8, 14}, {18, 18, 3, 3}, {18, 18, 6, 8},
+	{18, 18, 6, 14}, {18, 18, 3, 0}, {18, 18, 8, 7}, {18, 18, 7, 12},
+	{18, 18, 5, 6}, {18, 18, 6, 7}, {18, 18, 6, 15}, {18, 18, 4, 5},
+	{18, 18, 8, 15}, {18, 18, 4, 7}, {18, 18, 7, 12}, {18, 18, 9, 10},
+	{18, 18, 5, 13}, {18, 18, 2, 2}, {18, 18, 7, 3}, {18, 18, 7, 5},
+	{18, 18, 6, 12}, {18, 18, 5, 15}, {18, 18, 5, 10}, {18, 18, 5, 10},
+	{18, 18, 8, 7}, {18, 18, 7, 11}, {18, 18, 9, 8}, {18, 18, 5, 7},
+	{18, 18, 3, 2}, {18, 18, 8, 8}, {18, 18, 3, 2}, {18, 18, 7, 5},
+	{18, 18, 9, 8}, {18, 18, 6, 11}, {18, 18, 9, 17}, {18, 18, 8, 17},
+	{18, 18, 1, 0}, {18, 18, 5, 6}, {18, 18, 8, 11}, {18, 18, 10, 17},
+	{18, 18, 8, 17}, {18, 18, 3, 4}, {18, 18, 4, 4}, {18, 18, 10, 17},
+	{18, 18, 9, 17}, {18, 18, 8, 17}, {18, 18, 8, 17}, {18, 18, 8, 17},
+	{18, 18, 1, 0}, {18, 18, 6, 11}, {18, 18, 6, 11}, {18, 18, 1, 18}
+};
+#endif
 
-			/* First, check if there is a root. Compute t1 = a^((p - 1)/2). */
-			bn_rsh(e, e, 1);
-			fp_exp(t0, a, e);
+/**
+ * Raises an element to a power with an addition chain. Each step {d, s, n, m}
+ * of the chain computes t[d] = t[s]^(2^n) * t[m], skipping the multiplication
+ * if m is equal to d, and t[0] holds the element. The result is in the output
+ * of the last step. The chains are generated by tools/relic_gen_chain.py.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the element to exponentiate.
+ * @param[in] chain			- the steps of the addition chain.
+ * @param[in] len			- the number of steps.
+ */
+static void fp_exp_chain(fp_t c, const fp_t a, const uint8_t (*chain)[4],
+		int len) {
+	fp_t t[SRT_SLOTS];
+	int i, j, k = 1;
 
-			if (fp_cmp_dig(t0, 1) != RLC_EQ) {
-				/* Nope, there is no square root. */
-				r = 0;
+	for (i = 0; i < len; i++) {
+		k = RLC_MAX(k, chain[i][0] + 1);
+	}
+	for (i = 0; i < k; i++) {
+		fp_null(t[i]);
+	}
+
+	TRY {
+		for (i = 0; i < k; i++) {
+			fp_new(t[i]);
+		}
+		fp_copy(t[0], a);
+		for (i = 0; i < len; i++) {
+			const uint8_t *s = chain[i];
+			if (s[2] == 0) {
+				fp_mul(t[s[0]], t[s[1]], t[s[3]]);
 			} else {
-				r = 1;
-				/* Find a quadratic non-residue modulo p, that is a number t2
-				 * such that (t2 | p) = t2^((p - 1)/2)!= 1. */
-				do {
-					fp_rand(t1);
-					fp_exp(t0, t1, e);
-				} while (fp_cmp_dig(t0, 1) == RLC_EQ);
-
-				/* Write p - 1 as (e * 2^f), odd e. */
-				bn_lsh(e, e, 1);
-				while (bn_is_even(e)) {
-					bn_rsh(e, e, 1);
-					f++;
+				fp_sqr(t[s[0]], t[s[1]]);
+				for (j = 1; j < s[2]; j++) {
+					fp_sqr(t[s[0]], t[s[0]]);
+				}
+				if (s[3] != s[0]) {
+					fp_mul(t[s[0]], t[s[0]], t[s[3]]);
 				}
+			}
+		}
+		fp_copy(c, t[chain[len - 1][0]]);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < k; i++) {
+			fp_free(t[i]);
+		}
+	}
+}
 
-				/* Compute t2 = t2^e. */
-				fp_exp(t1, t1, e);
+/**
+ * Raises an element to the exponent cached for square roots, using an addition
+ * chain if the prime modulus has one.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the element to exponentiate.
+ */
+static void fp_exp_srt(fp_t c, const fp_t a) {
+	switch (fp_param_get()) {
+#if FP_PRIME == 254
+		case BN_254:
+			fp_exp_chain_imp(c, a, srt_bn_254);
+			break;
+#elif FP_PRIME == 255
+		case PRIME_25519:
+			fp_exp_chain_imp(c, a, srt_prime_25519);
+			break;
+#elif FP_PRIME == 256
+		case NIST_256:
+			fp_exp_chain_imp(c, a, srt_nist_256);
+			break;
+		case SECG_256:
+			fp_exp_chain_imp(c, a, srt_secg_256);
+			break;
+#elif FP_PRIME == 381
+		case B12_381:
+			fp_exp_chain_imp(c, a, srt_b12_381);
+			break;
+#endif
+		default:
+			fp_exp(c, a, &(core_get_crv()->srt));
+			break;
+	}
+}
 
-				/* Compute t1 = a^e, c = a^((e + 1)/2) = a^(e/2 + 1), odd e. */
-				bn_rsh(e, e, 1);
-				fp_exp(t0, a, e);
-				fp_mul(e->dp, t0, a);
-				fp_sqr(t0, t0);
-				fp_mul(t0, t0, a);
-				fp_copy(c, e->dp);
+/**
+ * Extracts the square root of a/b with a single exponentiation by the exponent
+ * cached when the prime modulus was configured. If b is NULL, it is assumed to
+ * be 1 and the corresponding multiplications are skipped.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the numerator.
+ * @param[in] b				- the denominator, or NULL.
+ * @return					- 1 if a/b is a square, 0 otherwise.
+ */
+static int fp_srt_imp(fp_t c, const fp_t a, const fp_t b) {
+	crv_t *ctx = core_get_crv();
+	fp_t t0, t1, t2, t3, t4;
+	int f, m, r = 0, s;
 
-				while (1) {
-					if (fp_cmp_dig(t0, 1) == RLC_EQ) {
-						break;
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(t2);
+	fp_null(t3);
+	fp_null(t4);
+
+	TRY {
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(t2);
+		fp_new(t3);
+		fp_new(t4);
+
+		switch (ctx->mod8) {
+			case 3:
+			case 7:
+				/* Compute y = a * b * (a * b^3)^((p - 3)/4). */
+				if (b == NULL) {
+					fp_copy(t2, a);
+					fp_copy(t1, a);
+				} else {
+					fp_mul(t2, a, b);
+					fp_sqr(t1, b);
+					fp_mul(t1, t1, t2);
+				}
+				fp_exp_srt(t0, t1);
+				fp_mul(t0, t0, t2);
+				/* Check that b * y^2 = a. */
+				fp_sqr(t1, t0);
+				if (b != NULL) {
+					fp_mul(t1, t1, b);
+				}
+				r = (dv_cmp_const(t1, a, RLC_FP_DIGS) == RLC_EQ);
+				break;
+			case 5:
+				/* Compute y = a * b^3 * (a * b^7)^((p - 5)/8). */
+				if (b == NULL) {
+					fp_copy(t2, a);
+					fp_copy(t1, a);
+				} else {
+					fp_sqr(t1, b);
+					fp_mul(t2, t1, b);
+					fp_mul(t2, t2, a);
+					fp_sqr(t1, t1);
+					fp_mul(t1, t1, t2);
+				}
+				fp_exp_srt(t0, t1);
+				fp_mul(t0, t0, t2);
+				/* If b * y^2 = -a, multiply y by sqrt(-1). */
+				fp_sqr(t1, t0);
+				if (b != NULL) {
+					fp_mul(t1, t1, b);
+				}
+				fp_neg(t2, a);
+				r = (dv_cmp_const(t1, a, RLC_FP_DIGS) == RLC_EQ);
+				s = (dv_cmp_const(t1, t2, RLC_FP_DIGS) == RLC_EQ);
+				fp_mul(t1, t0, ctx->srt_z);
+				dv_copy_cond(t0, t1, RLC_FP_DIGS, s);
+				r |= s;
+				break;
+			default:
+				/* Tonelli-Shanks on x = a/b with the cached root of unity. */
+				if (b == NULL) {
+					fp_copy(t3, a);
+				} else {
+					fp_inv(t3, b);
+					fp_mul(t3, t3, a);
+				}
+				/* z = x^((e + 1)/2), t = x^e and c = n^e for non-residue n. */
+				fp_exp_srt(t0, t3);
+				fp_sqr(t1, t0);
+				fp_mul(t1, t1, t3);
+				fp_mul(t0, t0, t3);
+				fp_copy(t2, ctx->srt_z);
+				f = ctx->srt_f;
+				while (fp_cmp_dig(t1, 1) != RLC_EQ) {
+					/* Find the least m such that t^(2^m) = 1. */
+					fp_copy(t4, t1);
+					for (m = 0; m < f && fp_cmp_dig(t4, 1) != RLC_EQ; m++) {
+						fp_sqr(t4, t4);
 					}
-					fp_copy(e->dp, t0);
-					for (m = 0; (m < f) && (fp_cmp_dig(t0, 1) != RLC_EQ); m++) {
-						fp_sqr(t0, t0);
+					if (m == f) {
+						/* There is no square root. */
+						break;
 					}
-					fp_copy(t0, e->dp);
 					for (int i = 0; i < f - m - 1; i++) {
-						fp_sqr(t1, t1);
+						fp_sqr(t2, t2);
 					}
-					fp_mul(c, c, t1);
-					fp_sqr(t1, t1);
-					fp_mul(t0, t0, t1);
+					fp_mul(t0, t0, t2);
+					fp_sqr(t2, t2);
+					fp_mul(t1, t1, t2);
 					f = m;
 				}
-			}
+				fp_sqr(t1, t0);
+				r = (fp_cmp(t1, t3) == RLC_EQ);
+				break;
 		}
+		fp_copy(c, t0);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		bn_free(e);
 		fp_free(t0);
 		fp_free(t1);
+		fp_free(t2);
+		fp_free(t3);
+		fp_free(t4);
+	}
+	return r;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int fp_srt(fp_t c, const fp_t a) {
+	return fp_srt_imp(c, a, NULL);
+}
+
+int fp_srt_rat(fp_t c, const fp_t a, const fp_t b) {
+	if (fp_is_zero(b)) {
+		THROW(ERR_NO_VALID);
+		return 0;
+	}
+	return fp_srt_imp(c, a, b);
+}
+
+int fp_srt_inv(fp_t c, const fp_t a) {
+	fp_t t;
+	int r = 0;
+
+	fp_null(t);
+
+	if (fp_is_zero(a)) {
+		THROW(ERR_NO_VALID);
+		return 0;
+	}
+
+	TRY {
+		fp_new(t);
+		fp_set_dig(t, 1);
+		r = fp_srt_imp(c, t, a);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t);
+	}
+	return r;
+}
+
+int fp_smb(const fp_t a) {
+	fp_t t;
+	int r = 0;
+
+	fp_null(t);
+
+	TRY {
+		fp_new(t);
+		if (core_get_crv()->mod8 % 4 == 3) {
+			/* Compute a^((p - 1)/2) = a * (a^((p - 3)/4))^2. */
+			fp_exp_srt(t, a);
+			fp_sqr(t, t);
+			fp_mul(t, t, a);
+		} else {
+			fp_exp(t, a, &(core_get_crv()->leg));
+		}
+		if (!fp_is_zero(a)) {
+			r = (fp_cmp_dig(t, 1) == RLC_EQ ? 1 : -1);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t);
 	}
 	return r;
 }
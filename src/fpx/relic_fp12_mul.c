@@ -414,3 +414,91 @@ void fp12_mul_dxs_lazyr(fp12_t c, fp12_t a, fp12_t b) {
 }
 
 #endif
+
+void fp12_mul_sxs(fp12_t c, fp12_t a, fp12_t b) {
+	fp2_t t0, t1, t2, u0, u1;
+	fp12_t t;
+
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(t2);
+	fp2_null(u0);
+	fp2_null(u1);
+	fp12_null(t);
+
+	TRY {
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(t2);
+		fp2_new(u0);
+		fp2_new(u1);
+		fp12_new(t);
+
+		fp12_zero(t);
+		if (ep2_curve_is_twist() == EP_DTYPE) {
+			/* Non-zero coefficients are a_00, a_10 and a_11. */
+			fp2_mul(t0, a[0][0], b[0][0]);
+			fp2_mul(t1, a[1][0], b[1][0]);
+			fp2_mul(t2, a[1][1], b[1][1]);
+			/* c_00 = a_00 * b_00 + E * a_11 * b_11, c_01 = a_10 * b_10. */
+			fp2_mul_nor(t[0][0], t2);
+			fp2_add(t[0][0], t[0][0], t0);
+			fp2_copy(t[0][1], t1);
+			/* c_02 = a_10 * b_11 + a_11 * b_10. */
+			fp2_add(u0, a[1][0], a[1][1]);
+			fp2_add(u1, b[1][0], b[1][1]);
+			fp2_mul(t[0][2], u0, u1);
+			fp2_sub(t[0][2], t[0][2], t1);
+			fp2_sub(t[0][2], t[0][2], t2);
+			/* c_10 = a_00 * b_10 + a_10 * b_00. */
+			fp2_add(u0, a[0][0], a[1][0]);
+			fp2_add(u1, b[0][0], b[1][0]);
+			fp2_mul(t[1][0], u0, u1);
+			fp2_sub(t[1][0], t[1][0], t0);
+			fp2_sub(t[1][0], t[1][0], t1);
+			/* c_11 = a_00 * b_11 + a_11 * b_00. */
+			fp2_add(u0, a[0][0], a[1][1]);
+			fp2_add(u1, b[0][0], b[1][1]);
+			fp2_mul(t[1][1], u0, u1);
+			fp2_sub(t[1][1], t[1][1], t0);
+			fp2_sub(t[1][1], t[1][1], t2);
+		} else {
+			/* Non-zero coefficients are a_00, a_01 and a_11. */
+			fp2_mul(t0, a[0][0], b[0][0]);
+			fp2_mul(t1, a[0][1], b[0][1]);
+			fp2_mul(t2, a[1][1], b[1][1]);
+			/* c_00 = a_00 * b_00 + E * a_11 * b_11, c_02 = a_01 * b_01. */
+			fp2_mul_nor(t[0][0], t2);
+			fp2_add(t[0][0], t[0][0], t0);
+			fp2_copy(t[0][2], t1);
+			/* c_01 = a_00 * b_01 + a_01 * b_00. */
+			fp2_add(u0, a[0][0], a[0][1]);
+			fp2_add(u1, b[0][0], b[0][1]);
+			fp2_mul(t[0][1], u0, u1);
+			fp2_sub(t[0][1], t[0][1], t0);
+			fp2_sub(t[0][1], t[0][1], t1);
+			/* c_11 = a_00 * b_11 + a_11 * b_00. */
+			fp2_add(u0, a[0][0], a[1][1]);
+			fp2_add(u1, b[0][0], b[1][1]);
+			fp2_mul(t[1][1], u0, u1);
+			fp2_sub(t[1][1], t[1][1], t0);
+			fp2_sub(t[1][1], t[1][1], t2);
+			/* c_12 = a_01 * b_11 + a_11 * b_01. */
+			fp2_add(u0, a[0][1], a[1][1]);
+			fp2_add(u1, b[0][1], b[1][1]);
+			fp2_mul(t[1][2], u0, u1);
+			fp2_sub(t[1][2], t[1][2], t1);
+			fp2_sub(t[1][2], t[1][2], t2);
+		}
+		fp12_copy(c, t);
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(t2);
+		fp2_free(u0);
+		fp2_free(u1);
+		fp12_free(t);
+	}
+}
@@ -38,7 +38,7 @@
 /*============================================================================*/
 
 void fp2_mul_frb(fp2_t c, fp2_t a, int i, int j) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	if (i == 2) {
 		fp_mul(c[0], a[0], ctx->fp2_p2[j - 1]);
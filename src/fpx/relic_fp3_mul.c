@@ -161,7 +161,7 @@ void fp3_mul_art(fp3_t c, fp3_t a) {
 }
 
 void fp3_mul_frb(fp3_t c, fp3_t a, int i, int j, int k) {
-	ctx_t *ctx = core_get();
+	crv_t *ctx = core_get_crv();
 
 	if (i == 0) {
 		switch (j % 3) {
@@ -0,0 +1,86 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Useful macros for binary field arithmetic with carry-less multiplication.
+ *
+ * @ingroup fb
+ */
+
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+
+#if defined(__VPCLMULQDQ__) && defined(__AVX2__)
+#include <immintrin.h>
+/** Flag indicating that 256-bit carry-less multiplications are available. */
+#define VPCLMUL
+#endif
+
+#if RLC_DIG != 64
+#error "The x64-clmul backend requires 64-bit digits."
+#endif
+
+#define XOR(A, B)			_mm_xor_si128(A, B)
+#define LOAD(A)				_mm_loadu_si128((__m128i *)(A))
+#define STORE(A, B)			_mm_storeu_si128((__m128i *)(A), B)
+
+/**
+ * Multiplies two digits in the carry-less sense, returning the 128-bit
+ * product in a vector register.
+ */
+#define MUL64(A, B)															\
+	_mm_clmulepi64_si128(_mm_cvtsi64_si128(A), _mm_cvtsi64_si128(B), 0x00)
+
+/**
+ * Squares a digit in the carry-less sense.
+ */
+#define SQR64(A)															\
+	_mm_clmulepi64_si128(_mm_cvtsi64_si128(A), _mm_cvtsi64_si128(A), 0x00)
+
+/**
+ * Accumulates a 128-bit product on two consecutive digits.
+ */
+#define ACC(C, T)															\
+	(C)[0] ^= (dig_t)_mm_cvtsi128_si64(T);									\
+	(C)[1] ^= (dig_t)_mm_extract_epi64(T, 1);								\
+
+/**
+ * Writes n pairs of digits with the sum of 2n 128-bit partial products, where
+ * the i-th partial product starts at the i-th digit. The pairs are written with
+ * 128-bit stores so that they can be forwarded to the 128-bit loads of the
+ * modular reduction.
+ */
+#define COMBINE(C, T, N)													\
+	do {																	\
+		__m128i _u = _mm_setzero_si128(), _v;								\
+		for (int _k = 0; _k < (N); _k++) {									\
+			_v = XOR((T)[2 * _k], _mm_srli_si128(_u, 8));					\
+			_v = XOR(_v, _mm_slli_si128((T)[2 * _k + 1], 8));				\
+			STORE((C) + 2 * _k, _v);										\
+			_u = (T)[2 * _k + 1];											\
+		}																	\
+	} while (0)
+
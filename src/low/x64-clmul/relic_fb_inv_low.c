@@ -0,0 +1,98 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level binary field inversion using carry-less
+ * multiplication instructions.
+ *
+ * @ingroup fb
+ */
+
+#include <stdlib.h>
+
+#include "relic_fb.h"
+#include "relic_fb_low.h"
+#include "relic_util.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fb_invn_low(dig_t *c, const dig_t *a) {
+	int i, j, k, x, y, len;
+	const int *chain = fb_poly_get_chain(&len);
+	rlc_align dig_t u[RLC_FB_DIGS], v[RLC_FB_DIGS];
+
+	if (chain != NULL) {
+		/* Itoh-Tsujii with the precomputed addition chain for m - 1, where
+		 * the longer runs of squarings are done with the precomputed tables. */
+		int w[len + 1];
+		rlc_align dig_t t[len + 1][RLC_FB_DIGS];
+
+		w[0] = 1;
+		w[1] = 2;
+		dv_copy(t[0], a, RLC_FB_DIGS);
+		fb_sqrm_low(t[1], t[0]);
+		fb_mulm_low(t[1], t[1], t[0]);
+		for (i = 2; i <= len; i++) {
+			x = chain[i - 1] >> 8;
+			y = chain[i - 1] - (x << 8);
+			if (x == y) {
+				w[i] = 2 * w[i - 1];
+			} else {
+				w[i] = w[x] + w[y];
+			}
+			if (w[y] <= 2) {
+				fb_sqrm_low(t[i], t[x]);
+				for (j = 1; j < w[y]; j++) {
+					fb_sqrm_low(t[i], t[i]);
+				}
+			} else {
+				fb_itrn_low(t[i], t[x], (dig_t *)fb_poly_tab_sqr(y));
+			}
+			fb_mulm_low(t[i], t[i], t[y]);
+		}
+		fb_sqrm_low(c, t[len]);
+	} else {
+		/* Itoh-Tsujii: u = a^(2^k - 1), scanning the bits of m - 1. */
+		dv_copy(u, a, RLC_FB_DIGS);
+		k = 1;
+		for (i = util_bits_dig(RLC_FB_BITS - 1) - 2; i >= 0; i--) {
+			fb_sqrm_low(v, u);
+			for (j = 1; j < k; j++) {
+				fb_sqrm_low(v, v);
+			}
+			fb_mulm_low(u, v, u);
+			k <<= 1;
+			if (((RLC_FB_BITS - 1) >> i) & 1) {
+				fb_sqrm_low(u, u);
+				fb_mulm_low(u, u, a);
+				k++;
+			}
+		}
+		/* a^(-1) = (a^(2^(m-1) - 1))^2. */
+		fb_sqrm_low(c, u);
+	}
+}
@@ -0,0 +1,183 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level binary field multiplication functions using
+ * carry-less multiplication instructions.
+ *
+ * @ingroup fb
+ */
+
+#include "relic_fb.h"
+#include "relic_fb_low.h"
+#include "relic_util.h"
+#include "macros.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size in digits from which multiplication switches to recursive Karatsuba.
+ */
+#define KARAT_DIGS		12
+
+/**
+ * Multiplies two digit vectors of the same size with the generalized Karatsuba
+ * formula of Weimerskirch and Paar, using size * (size + 1) / 2 carry-less
+ * products.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first digit vector to multiply.
+ * @param[in] b				- the second digit vector to multiply.
+ * @param[in] size			- the number of digits to multiply.
+ */
+static void fb_mulw_low(dig_t *c, const dig_t *a, const dig_t *b, int size) {
+	int i, j, k;
+	__m128i d[size + 1], t[2 * size], p;
+
+	/* Prefix sums of the diagonal products a_i * b_i. */
+	d[0] = _mm_setzero_si128();
+	i = 0;
+#ifdef VPCLMUL
+	for (; i + 4 <= size; i += 4) {
+		__m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+		__m256i y = _mm256_loadu_si256((const __m256i *)(b + i));
+		__m256i l = _mm256_clmulepi64_epi128(x, y, 0x00);
+		__m256i h = _mm256_clmulepi64_epi128(x, y, 0x11);
+		d[i + 1] = XOR(d[i], _mm256_castsi256_si128(l));
+		d[i + 2] = XOR(d[i + 1], _mm256_castsi256_si128(h));
+		d[i + 3] = XOR(d[i + 2], _mm256_extracti128_si256(l, 1));
+		d[i + 4] = XOR(d[i + 3], _mm256_extracti128_si256(h, 1));
+	}
+#endif
+	for (; i < size; i++) {
+		d[i + 1] = XOR(d[i], MUL64(a[i], b[i]));
+	}
+
+	/* Each position k receives the sum of the diagonal products inside the
+	 * window of indices that add up to k. */
+	for (k = 0; k < 2 * size - 1; k++) {
+		i = (k < size ? 0 : k - size + 1);
+		j = (k < size ? k : size - 1);
+		t[k] = XOR(d[j + 1], d[i]);
+	}
+
+	/* Add the products (a_i + a_j) * (b_i + b_j) for i < j. */
+	for (i = 0; i < size - 1; i++) {
+		j = i + 1;
+#ifdef VPCLMUL
+		__m256i u = _mm256_set1_epi64x(a[i]);
+		__m256i v = _mm256_set1_epi64x(b[i]);
+		for (; j + 4 <= size; j += 4) {
+			__m256i x = _mm256_loadu_si256((const __m256i *)(a + j));
+			__m256i y = _mm256_loadu_si256((const __m256i *)(b + j));
+			x = _mm256_xor_si256(x, u);
+			y = _mm256_xor_si256(y, v);
+			__m256i l = _mm256_clmulepi64_epi128(x, y, 0x00);
+			__m256i h = _mm256_clmulepi64_epi128(x, y, 0x11);
+			t[i + j] = XOR(t[i + j], _mm256_castsi256_si128(l));
+			t[i + j + 1] = XOR(t[i + j + 1], _mm256_castsi256_si128(h));
+			t[i + j + 2] = XOR(t[i + j + 2], _mm256_extracti128_si256(l, 1));
+			t[i + j + 3] = XOR(t[i + j + 3], _mm256_extracti128_si256(h, 1));
+		}
+#endif
+		for (; j < size; j++) {
+			p = MUL64(a[i] ^ a[j], b[i] ^ b[j]);
+			t[i + j] = XOR(t[i + j], p);
+		}
+	}
+
+	/* Overlap the 128-bit partial results, two digits at a time. */
+	t[2 * size - 1] = _mm_setzero_si128();
+	COMBINE(c, t, size);
+}
+
+/**
+ * Multiplies two digit vectors of the same size, splitting them recursively
+ * with Karatsuba while they are large enough.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first digit vector to multiply.
+ * @param[in] b				- the second digit vector to multiply.
+ * @param[in] size			- the number of digits to multiply.
+ */
+static void fb_mulk_low(dig_t *c, const dig_t *a, const dig_t *b, int size) {
+	int h, h1;
+
+	if (size < KARAT_DIGS) {
+		fb_mulw_low(c, a, b, size);
+		return;
+	}
+
+	h = size >> 1;
+	h1 = size - h;
+
+	dig_t a1[h1], b1[h1], t[2 * h1];
+
+	/* c = (a0 * b0) + (a1 * b1) * z^(2h * RLC_DIG). */
+	fb_mulk_low(c, a, b, h);
+	fb_mulk_low(c + 2 * h, a + h, b + h, h1);
+
+	/* t = (a0 + a1) * (b0 + b1) - a0 * b0 - a1 * b1. */
+	a1[h1 - 1] = a[size - 1];
+	b1[h1 - 1] = b[size - 1];
+	fb_addd_low(a1, a, a + h, h);
+	fb_addd_low(b1, b, b + h, h);
+	fb_mulk_low(t, a1, b1, h1);
+	fb_addd_low(t, t, c, 2 * h);
+	fb_addd_low(t, t, c + 2 * h, 2 * h1);
+
+	fb_addd_low(c + h, c + h, t, 2 * h1);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fb_mul1_low(dig_t *c, const dig_t *a, dig_t digit) {
+	__m128i p;
+
+	dv_zero(c, RLC_FB_DIGS + 1);
+	for (int i = 0; i < RLC_FB_DIGS; i++) {
+		p = MUL64(a[i], digit);
+		ACC(c + i, p);
+	}
+}
+
+void fb_muln_low(dig_t *c, const dig_t *a, const dig_t *b) {
+	fb_mulk_low(c, a, b, RLC_FB_DIGS);
+}
+
+void fb_muld_low(dig_t *c, const dig_t *a, const dig_t *b, int size) {
+	fb_mulk_low(c, a, b, size);
+}
+
+void fb_mulm_low(dig_t *c, const dig_t *a, const dig_t *b) {
+	rlc_align dig_t t[2 * RLC_FB_DIGS];
+
+	fb_muln_low(t, a, b);
+	fb_rdcn_low(c, t);
+}
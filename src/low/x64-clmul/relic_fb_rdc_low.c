@@ -0,0 +1,269 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level binary field modular reduction using
+ * carry-less multiplication instructions.
+ *
+ * @ingroup fb
+ */
+
+#include "relic_fb.h"
+#include "relic_fb_low.h"
+#include "relic_util.h"
+#include "macros.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Index of the digit holding the coefficient of z^m.
+ */
+#define SH		(RLC_FB_BITS >> RLC_DIG_LOG)
+
+/**
+ * Position of the coefficient of z^m inside its digit.
+ */
+#define RH		(RLC_FB_BITS & (RLC_DIG - 1))
+
+/**
+ * Number of digits in the quotient of a double-precision product by z^m.
+ */
+#define HD		(((RLC_FB_BITS - 2) >> RLC_DIG_LOG) + 1)
+
+/**
+ * Returns the i-th digit of a vector of 128-bit registers.
+ */
+#define DIG(L, I)															\
+	((I) & 1 ? (dig_t)_mm_extract_epi64((L)[(I) >> 1], 1) :					\
+	(dig_t)_mm_cvtsi128_si64((L)[(I) >> 1]))
+
+/**
+ * Adds the term z^e to a two-digit polynomial.
+ */
+#define TERM(R0, R1, E)														\
+	if ((E) < RLC_DIG) {													\
+		R0 ^= (dig_t)1 << (E);												\
+	} else {																\
+		R1 ^= (dig_t)1 << ((E) - RLC_DIG);									\
+	}																		\
+
+/**
+ * Reduces a polynomial of bounded degree modulo the trinomial or pentanomial
+ * f(z) = z^m + r(z), one digit at a time. The part above z^m is folded back by
+ * multiplying it by the sparse r(z) until the degree bound drops below m. The
+ * number of folds only depends on the degree bound and on f(z).
+ *
+ * @param[out] c			- the result.
+ * @param[in,out] a			- the polynomial to reduce.
+ * @param[in] deg			- the upper bound on the degree of the polynomial.
+ */
+static void fb_rdcd_low(dig_t *c, dig_t *a, int deg) {
+	int i, j, fa, fb, fc, sh, rh, hd, rd;
+	dig_t r[RLC_FB_DIGS] = { 0 }, h[RLC_FB_DIGS];
+	__m128i p;
+
+	fb_poly_get_rdc(&fa, &fb, &fc);
+
+	r[0] = 1;
+	r[fa >> RLC_DIG_LOG] ^= (dig_t)1 << (fa & (RLC_DIG - 1));
+	if (fb != 0) {
+		r[fb >> RLC_DIG_LOG] ^= (dig_t)1 << (fb & (RLC_DIG - 1));
+		r[fc >> RLC_DIG_LOG] ^= (dig_t)1 << (fc & (RLC_DIG - 1));
+	}
+	rd = (fa >> RLC_DIG_LOG) + 1;
+
+	RLC_RIP(rh, sh, RLC_FB_BITS);
+
+	while (deg >= RLC_FB_BITS) {
+		/* h = floor(a / z^m). */
+		hd = ((deg - RLC_FB_BITS) >> RLC_DIG_LOG) + 1;
+		for (i = 0; i < hd; i++) {
+			h[i] = a[sh + i];
+			if (rh != 0) {
+				h[i] = (h[i] >> rh) | (a[sh + i + 1] << (RLC_DIG - rh));
+			}
+		}
+
+		/* a = a mod z^m. */
+		if (rh == 0) {
+			a[sh] = 0;
+		} else {
+			a[sh] &= RLC_MASK(rh);
+		}
+		for (i = sh + 1; i <= (deg >> RLC_DIG_LOG); i++) {
+			a[i] = 0;
+		}
+
+		/* a = a + h * r(z). */
+		for (i = 0; i < hd; i++) {
+			for (j = 0; j < rd; j++) {
+				p = MUL64(h[i], r[j]);
+				ACC(a + i + j, p);
+			}
+		}
+
+		deg = deg - RLC_FB_BITS + fa;
+	}
+
+	dv_copy(c, a, RLC_FB_DIGS);
+}
+
+/**
+ * Loads the j-th aligned pair of digits of a vector with n digits, reading the
+ * digits past the end as zero. Loading whole pairs lets the results of the
+ * 128-bit stores of multiplication and squaring be forwarded.
+ *
+ * @param[in] a				- the digit vector.
+ * @param[in] j				- the index of the pair.
+ * @param[in] n				- the number of digits in the vector.
+ * @return the pair of digits.
+ */
+static inline __m128i fb_ldp_low(const dig_t *a, int j, int n) {
+	if (2 * j + 1 < n) {
+		return LOAD(a + 2 * j);
+	}
+	if (2 * j < n) {
+		return _mm_loadl_epi64((const __m128i *)(a + 2 * j));
+	}
+	return _mm_setzero_si128();
+}
+
+/**
+ * Loads the two digits starting at the w-th digit of a vector with n digits.
+ *
+ * @param[in] a				- the digit vector.
+ * @param[in] w				- the index of the first digit.
+ * @param[in] n				- the number of digits in the vector.
+ * @return the pair of digits.
+ */
+static inline __m128i fb_ldw_low(const dig_t *a, int w, int n) {
+	if (w & 1) {
+		return _mm_alignr_epi8(fb_ldp_low(a, (w + 1) >> 1, n),
+				fb_ldp_low(a, w >> 1, n), 8);
+	}
+	return fb_ldp_low(a, w >> 1, n);
+}
+
+/**
+ * Reduces a double-precision polynomial modulo f(z) = z^m + r(z) when r(z)
+ * fits in two digits and two folds are enough, keeping the intermediate
+ * results in 128-bit registers.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the polynomial to reduce.
+ * @param[in] r0			- the least significant digit of r(z).
+ * @param[in] r1			- the most significant digit of r(z).
+ */
+static void fb_rdcv_low(dig_t *c, const dig_t *a, dig_t r0, dig_t r1) {
+	int i;
+	dig_t o0, o1;
+	__m128i r, h, q, m, l[RLC_FB_DIGS / 2 + 3];
+
+	r = _mm_set_epi64x(r1, r0);
+	if (SH & 1) {
+		m = _mm_set_epi64x(RLC_MASK(RH), -1);
+	} else {
+		m = _mm_set_epi64x(0, RLC_MASK(RH));
+	}
+
+	/* l = a mod z^m. */
+	for (i = 0; i < SH / 2; i++) {
+		l[i] = LOAD(a + 2 * i);
+	}
+	l[SH / 2] = _mm_and_si128(fb_ldp_low(a, SH / 2, 2 * RLC_FB_DIGS), m);
+	for (i = SH / 2 + 1; i < RLC_FB_DIGS / 2 + 3; i++) {
+		l[i] = _mm_setzero_si128();
+	}
+
+	/* l = l + floor(a / z^m) * r(z), two digits of the quotient at a time. */
+	for (i = 0; i < HD; i += 2) {
+		h = fb_ldw_low(a, SH + i, 2 * RLC_FB_DIGS);
+		if (RH != 0) {
+			h = _mm_srli_epi64(h, RH);
+			q = fb_ldw_low(a, SH + i + 1, 2 * RLC_FB_DIGS);
+			h = _mm_or_si128(h, _mm_slli_epi64(q, RLC_DIG - RH));
+		}
+		if (i + 1 == HD) {
+			h = _mm_move_epi64(h);
+		}
+		q = XOR(_mm_clmulepi64_si128(h, r, 0x01),
+				_mm_clmulepi64_si128(h, r, 0x10));
+		l[i / 2] = XOR(l[i / 2], _mm_clmulepi64_si128(h, r, 0x00));
+		l[i / 2] = XOR(l[i / 2], _mm_slli_si128(q, 8));
+		l[i / 2 + 1] = XOR(l[i / 2 + 1], _mm_srli_si128(q, 8));
+		l[i / 2 + 1] = XOR(l[i / 2 + 1], _mm_clmulepi64_si128(h, r, 0x11));
+	}
+
+	/* Fold the at most two digits that remain above z^m. */
+	o0 = DIG(l, SH);
+	o1 = DIG(l, SH + 1);
+	if (RH != 0) {
+		o0 = (o0 >> RH) | (o1 << (RLC_DIG - RH));
+		o1 = (o1 >> RH) | (DIG(l, SH + 2) << (RLC_DIG - RH));
+	}
+	l[SH / 2] = _mm_and_si128(l[SH / 2], m);
+	h = _mm_set_epi64x(o1, o0);
+	q = XOR(_mm_clmulepi64_si128(h, r, 0x01),
+			_mm_clmulepi64_si128(h, r, 0x10));
+	l[0] = XOR(l[0], _mm_clmulepi64_si128(h, r, 0x00));
+	l[0] = XOR(l[0], _mm_slli_si128(q, 8));
+	l[1] = XOR(l[1], _mm_srli_si128(q, 8));
+	l[1] = XOR(l[1], _mm_clmulepi64_si128(h, r, 0x11));
+
+	for (i = 0; i < RLC_FB_DIGS / 2; i++) {
+		STORE(c + 2 * i, l[i]);
+	}
+	if (RLC_FB_DIGS & 1) {
+		_mm_storel_epi64((__m128i *)(c + RLC_FB_DIGS - 1), l[RLC_FB_DIGS / 2]);
+	}
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fb_rdcn_low(dig_t *c, dig_t *a) {
+	int fa, fb, fc;
+	dig_t r0 = 1, r1 = 0;
+
+	fb_poly_get_rdc(&fa, &fb, &fc);
+
+	if (fa < 2 * RLC_DIG && 2 * fa < RLC_FB_BITS + 2) {
+		TERM(r0, r1, fa);
+		if (fb != 0) {
+			TERM(r0, r1, fb);
+			TERM(r0, r1, fc);
+		}
+		fb_rdcv_low(c, a, r0, r1);
+	} else {
+		fb_rdcd_low(c, a, 2 * RLC_FB_BITS - 2);
+	}
+}
+
+void fb_rdc1_low(dig_t *c, dig_t *a) {
+	fb_rdcd_low(c, a, RLC_FB_BITS - 1 + RLC_DIG - 1);
+}
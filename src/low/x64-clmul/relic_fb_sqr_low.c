@@ -0,0 +1,70 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level binary field squaring using carry-less
+ * multiplication instructions.
+ *
+ * @ingroup fb
+ */
+
+#include "relic_fb.h"
+#include "relic_fb_low.h"
+#include "relic_util.h"
+#include "macros.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fb_sqrn_low(dig_t *c, const dig_t *a) {
+	int i = 0;
+
+#ifdef VPCLMUL
+	for (; i + 4 <= RLC_FB_DIGS; i += 4) {
+		__m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+		__m256i l = _mm256_clmulepi64_epi128(x, x, 0x00);
+		__m256i h = _mm256_clmulepi64_epi128(x, x, 0x11);
+		_mm256_storeu_si256((__m256i *)(c + 2 * i),
+				_mm256_permute2x128_si256(l, h, 0x20));
+		_mm256_storeu_si256((__m256i *)(c + 2 * i + 4),
+				_mm256_permute2x128_si256(l, h, 0x31));
+	}
+#endif
+	for (; i < RLC_FB_DIGS; i++) {
+		STORE(c + 2 * i, SQR64(a[i]));
+	}
+}
+
+void fb_sqrl_low(dig_t *c, const dig_t *a) {
+	fb_sqrn_low(c, a);
+}
+
+void fb_sqrm_low(dig_t *c, const dig_t *a) {
+	rlc_align dig_t t[2 * RLC_FB_DIGS];
+
+	fb_sqrn_low(t, a);
+	fb_rdcn_low(c, t);
+}
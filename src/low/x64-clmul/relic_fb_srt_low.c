@@ -0,0 +1,108 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level binary field square root using carry-less
+ * multiplication instructions.
+ *
+ * @ingroup fb
+ */
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+#include "relic_fb.h"
+#include "relic_fb_low.h"
+#include "relic_util.h"
+#include "macros.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of digits in the even and odd halves of a binary field element.
+ */
+#define HALF		RLC_CEIL(RLC_FB_DIGS, 2)
+
+/**
+ * Packs the even-indexed bits of a digit into its lower half.
+ *
+ * @param[in] x				- the digit.
+ * @return the packed bits.
+ */
+static inline dig_t fb_pck_low(dig_t x) {
+#ifdef __BMI2__
+	return _pext_u64(x, 0x5555555555555555);
+#else
+	x &= 0x5555555555555555;
+	x = (x | (x >> 1)) & 0x3333333333333333;
+	x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0F;
+	x = (x | (x >> 4)) & 0x00FF00FF00FF00FF;
+	x = (x | (x >> 8)) & 0x0000FFFF0000FFFF;
+	x = (x | (x >> 16)) & 0x00000000FFFFFFFF;
+	return x;
+#endif
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fb_srtn_low(dig_t *c, const dig_t *a) {
+	int i, j;
+	dig_t d, t_e[HALF], t_o[HALF];
+	const dig_t *srz = fb_poly_get_srz();
+	rlc_align dig_t t[2 * RLC_FB_DIGS];
+	__m128i p[2 * RLC_FB_DIGS];
+
+	/* Split a(z) = a_e(z^2) + z * a_o(z^2). */
+	for (i = 0; i < HALF; i++) {
+		t_e[i] = fb_pck_low(a[2 * i]);
+		t_o[i] = fb_pck_low(a[2 * i] >> 1);
+		if (2 * i + 1 < RLC_FB_DIGS) {
+			d = a[2 * i + 1];
+			t_e[i] |= fb_pck_low(d) << (RLC_DIG / 2);
+			t_o[i] |= fb_pck_low(d >> 1) << (RLC_DIG / 2);
+		}
+	}
+
+	/* Compute sqrt(a) = a_e + sqrt(z) * a_o, skipping the zero digits of
+	 * sqrt(z) when the polynomial is square-root friendly. */
+	for (i = 0; i < 2 * RLC_FB_DIGS; i++) {
+		p[i] = _mm_setzero_si128();
+	}
+	for (j = 0; j < RLC_FB_DIGS; j++) {
+		if (srz[j] != 0) {
+			for (i = 0; i < HALF; i++) {
+				p[i + j] = XOR(p[i + j], MUL64(t_o[i], srz[j]));
+			}
+		}
+	}
+	COMBINE(t, p, RLC_FB_DIGS);
+	fb_rdcn_low(c, t);
+	fb_addd_low(c, c, t_e, HALF);
+}
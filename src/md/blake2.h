@@ -20,7 +20,7 @@
 #if defined(_MSC_VER)
 #define ALIGNME(x)  __declspec(align(x))
 #else
-#define ALIGNME(x)  __attribute__((aligned(x)))
+#define ALIGNME(x)
 #endif
 
 #if defined(__cplusplus)
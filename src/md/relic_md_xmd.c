@@ -0,0 +1,84 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the expand_message_xmd function of RFC 9380.
+ *
+ * @ingroup md
+ */
+
+#include <string.h>
+
+#include "relic_conf.h"
+#include "relic_core.h"
+#include "relic_util.h"
+#include "relic_md.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void md_xmd(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
+		const uint8_t *dst, int dst_len) {
+#if MD_MAP == SHONE || MD_MAP == SH224 || MD_MAP == SH256 || MD_MAP == BLAKE2S_160 || MD_MAP == BLAKE2S_256
+	int block_size = 64;
+#elif MD_MAP == SH384 || MD_MAP == SH512
+	int block_size = 128;
+#endif
+	int i, j, ell = RLC_CEIL(buf_len, MD_LEN);
+
+	if (buf_len < 0 || buf_len > 65535 || ell > 255 || dst_len < 0 ||
+			dst_len > 255) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	uint8_t b0[MD_LEN], b[MD_LEN], t[MD_LEN + 1 + dst_len + 1];
+	uint8_t msg[block_size + in_len + 3 + dst_len + 1];
+
+	/* msg = Z_pad || in || I2OSP(buf_len, 2) || I2OSP(0, 1) || DST_prime. */
+	memset(msg, 0, block_size);
+	memcpy(msg + block_size, in, in_len);
+	msg[block_size + in_len] = (uint8_t)(buf_len >> 8);
+	msg[block_size + in_len + 1] = (uint8_t)buf_len;
+	msg[block_size + in_len + 2] = 0;
+	memcpy(msg + block_size + in_len + 3, dst, dst_len);
+	msg[block_size + in_len + 3 + dst_len] = (uint8_t)dst_len;
+	md_map(b0, msg, sizeof(msg));
+
+	/* b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime). */
+	memset(b, 0, MD_LEN);
+	memcpy(t + MD_LEN + 1, dst, dst_len);
+	t[MD_LEN + 1 + dst_len] = (uint8_t)dst_len;
+	for (i = 1; i <= ell; i++) {
+		for (j = 0; j < MD_LEN; j++) {
+			t[j] = b0[j] ^ b[j];
+		}
+		t[MD_LEN] = (uint8_t)i;
+		md_map(b, t, sizeof(t));
+		memcpy(buf + (i - 1) * MD_LEN, b,
+				RLC_MIN(MD_LEN, buf_len - (i - 1) * MD_LEN));
+	}
+}
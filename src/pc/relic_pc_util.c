@@ -56,6 +56,214 @@
 #define gt_exp_imp(C, A, B)		RLC_CAT(GT_LOWER, exp_uni)(C, A, B);
 #endif
 
+/**
+ * Security level, in bits, of the randomized batch subgroup membership test.
+ */
+#define BATCH_SEC			64
+
+/**
+ * Returns the length of the random scalars used in a round of the batch
+ * subgroup membership test. A point with a component of order q outside the
+ * subgroup survives a round with probability at most 2^-l if 2^l <= q, so the
+ * length is bounded by the smallest prime factor of the cofactor. Longer
+ * scalars make the multi-scalar multiplication more expensive than the rounds
+ * they save.
+ *
+ * @param[in] h				- the cofactor.
+ * @return the length of the scalars in bits.
+ */
+static int batch_bits(const bn_t h) {
+	dig_t q, r = 1;
+
+	/* The first divisor found is the smallest prime factor. */
+	for (q = 2; q < 256; q++) {
+		bn_mod_dig(&r, h, q);
+		if (r == 0) {
+			break;
+		}
+	}
+	return util_bits_dig(q) - 1;
+}
+
+/**
+ * Computes the cofactor of G_2 in the group of points of the sextic twist,
+ * which is not stored with the curve parameters. The worst-case value 2 is
+ * returned if the cofactor is not known.
+ *
+ * @param[out] h			- the cofactor.
+ */
+static void g2_get_cof(bn_t h) {
+	/* Coefficients of 9 * h for BLS12 curves, in the parameter x. */
+	const int c[] = { 1, -4, 5, 0, -4, 6, -4, -4, 13 };
+	bn_t t, x;
+
+	bn_null(t);
+	bn_null(x);
+
+	TRY {
+		bn_new(t);
+		bn_new(x);
+
+		switch (ep_param_get()) {
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P382:
+			case BN_P446:
+			case BN_P638:
+				/* The cofactor is p + t - 1 = 2p - n. */
+				ep_curve_get_ord(t);
+				h->used = RLC_FP_DIGS;
+				dv_copy(h->dp, fp_prime_get(), RLC_FP_DIGS);
+				h->sign = RLC_POS;
+				bn_trim(h);
+				bn_dbl(h, h);
+				bn_sub(h, h, t);
+				break;
+			case B12_P381:
+			case B12_P455:
+			case B12_P638:
+				fp_param_get_var(x);
+				bn_zero(h);
+				for (int i = 0; i < 9; i++) {
+					bn_mul(h, h, x);
+					bn_set_dig(t, c[i] < 0 ? -c[i] : c[i]);
+					if (c[i] < 0) {
+						bn_neg(t, t);
+					}
+					bn_add(h, h, t);
+				}
+				bn_div_dig(h, h, 9);
+				break;
+			default:
+				if (ep2_curve_is_twist()) {
+					bn_set_dig(h, 2);
+				} else {
+					ep2_curve_get_cof(h);
+				}
+				break;
+		}
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		bn_free(t);
+		bn_free(x);
+	}
+}
+
+#if FP_PRIME < 1536
+
+/**
+ * Exponentiates an element of the cyclotomic subgroup by the parameter x of
+ * the curve family. Compressed squarings are avoided, since their
+ * decompression fails on some elements that must still be tested.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the element of the cyclotomic subgroup.
+ */
+static void gt_exp_var(gt_t c, gt_t a) {
+	bn_t x;
+	gt_t t;
+
+	bn_null(x);
+	gt_null(t);
+
+	TRY {
+		bn_new(x);
+		gt_new(t);
+
+		fp_param_get_var(x);
+		fp12_copy(t, a);
+		for (int i = bn_bits(x) - 2; i >= 0; i--) {
+			fp12_sqr_cyc(t, t);
+			if (bn_get_bit(x, i)) {
+				fp12_mul(t, t, a);
+			}
+		}
+		if (bn_sign(x) == RLC_NEG) {
+			fp12_inv_uni(t, t);
+		}
+		fp12_copy(c, t);
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		bn_free(x);
+		gt_free(t);
+	}
+}
+
+#endif
+
+/**
+ * Defines a function that reads many points of a group from a byte vector and
+ * checks that they are all in the group, with a randomized batch test.
+ *
+ * @param[in] F				- the function name.
+ * @param[in] G				- the prefix of the group functions.
+ * @param[in] R				- the function that decodes the points.
+ * @param[in] C				- the function that returns the cofactor.
+ */
+#define READ_BIN_SIM(F, G, R, C)											\
+void F(G##_t *a, const uint8_t *bin, int len, int n) {						\
+	bn_t h, *k = NULL;														\
+	G##_t t;																\
+	int i, j, l, r = 1;														\
+																			\
+	bn_null(h);																\
+	G##_null(t);															\
+																			\
+	TRY {																	\
+		bn_new(h);															\
+		G##_new(t);															\
+																			\
+		/* Decode all points and check that they are on the curve. */		\
+		R(a, bin, len, n);													\
+		C(h);																\
+		if (bn_cmp_dig(h, 1) != RLC_EQ) {									\
+			/* Test random linear combinations of the points, repeating the	\
+			 * test when the cofactor has small factors. Each round costs a	\
+			 * membership test and a fraction of one per point, so only		\
+			 * batch if there are enough points. */							\
+			l = batch_bits(h);												\
+			r = (n > 2 * RLC_CEIL(BATCH_SEC, l));							\
+			if (r) {														\
+				k = (bn_t *)calloc(n, sizeof(bn_t));						\
+				if (k == NULL) {											\
+					THROW(ERR_NO_MEMORY);									\
+				}															\
+				for (i = 0; i < n; i++) {									\
+					bn_null(k[i]);											\
+					bn_new(k[i]);											\
+				}															\
+			}																\
+			for (j = 0; r && j < RLC_CEIL(BATCH_SEC, l); j++) {				\
+				for (i = 0; i < n; i++) {									\
+					bn_rand(k[i], RLC_POS, l);								\
+				}															\
+				G##_mul_sim_lot(t, a, (const bn_t *)k, n);					\
+				r = G##_is_valid(t);										\
+			}																\
+			/* Otherwise, or if the batch test failed, test each point. */	\
+			for (i = 0; !r && i < n; i++) {									\
+				if (!G##_is_valid(a[i])) {									\
+					THROW(ERR_NO_VALID);									\
+				}															\
+			}																\
+		}																	\
+	} CATCH_ANY {															\
+		THROW(ERR_CAUGHT);													\
+	} FINALLY {																\
+		bn_free(h);															\
+		G##_free(t);														\
+		if (k != NULL) {													\
+			for (i = 0; i < n; i++) {										\
+				bn_free(k[i]);												\
+			}																\
+		}																	\
+		free(k);															\
+	}																		\
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -112,36 +320,57 @@ void gt_exp(gt_t c, gt_t a, bn_t b) {
 
 int g1_is_valid(g1_t a) {
 	bn_t n;
-	g1_t u;
-	int r;
+	g1_t u, v;
+	int r = 0;
 
 	bn_null(n);
 	g1_null(u);
+	g1_null(v);
 
 	TRY {
 		bn_new(n);
 		g1_new(u);
+		g1_new(v);
 
 		ep_curve_get_cof(n);
 		if (bn_cmp_dig(n, 1) == RLC_EQ) {
 			/* If curve has prime order, simpler to check if point on curve. */
-			return ep_is_valid(a);
+			r = ep_is_valid(a);
 		} else {
-			/* Otherwise, check order explicitly. */
-			g1_get_ord(n);
-			/* Multiply by (n-1)/2 to prevent weird interactions with recoding. */
-			bn_sub_dig(n, n, 1);
-			bn_hlv(n, n);
-			g1_mul(u, a, n);
-			g1_dbl(u, u);
-			g1_neg(u, u);
-			r = (g1_cmp(u, a) == RLC_EQ);
+			switch (ep_param_get()) {
+				case B12_P381:
+				case B12_P455:
+				case B12_P638:
+					/* Check if phi(a) = [-x^2]a, as -x^2 is the eigenvalue of
+					 * the endomorphism phi(x, y) = (beta * x, y) on G_1. */
+					fp_param_get_var(n);
+					ep_mul_basic(u, a, n);
+					ep_mul_basic(u, u, n);
+					g1_neg(u, u);
+					ep_copy(v, a);
+					fp_mul(v->x, v->x, ep_curve_get_beta());
+					r = ep_is_valid(a) && (g1_cmp(u, v) == RLC_EQ);
+					break;
+				default:
+					/* Otherwise, check order explicitly. */
+					g1_get_ord(n);
+					/* Multiply by (n-1)/2 to prevent weird interactions with
+					 * recoding. */
+					bn_sub_dig(n, n, 1);
+					bn_hlv(n, n);
+					g1_mul(u, a, n);
+					g1_dbl(u, u);
+					g1_neg(u, u);
+					r = (g1_cmp(u, a) == RLC_EQ);
+					break;
+			}
 		}
 	} CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	} FINALLY {
 		bn_free(n);
 		g1_free(u);
+		g1_free(v);
 	}
 
 	return r;
@@ -149,36 +378,74 @@ int g1_is_valid(g1_t a) {
 
 int g2_is_valid(g2_t a) {
 	bn_t p, n;
-	g2_t u, v;
-	int r;
+	g2_t u, v, w;
+	int r = 0;
 
 	bn_null(n);
 	bn_null(p);
 	g2_null(u);
 	g2_null(v);
+	g2_null(w);
 
 	TRY {
 		bn_new(n);
 		bn_new(p);
 		g2_new(u);
 		g2_new(v);
+		g2_new(w);
 
-		g2_get_ord(n);
-		ep_curve_get_cof(p);
-		bn_mul(n, n, p);
-		dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
-		p->used = RLC_FP_DIGS;
-		p->sign = RLC_POS;
-		/* Compute trace t = p - n + 1. */
-		bn_sub(n, p, n);
-		bn_add_dig(n, n, 1);
-		/* Compute u = a^t. */
-		g2_mul(u, a, n);
-		/* Compute v = a^(p + 1). */
-		ep2_frb(v, a, 1);
-		g2_add(v, v, a);
-		/* Check if a^(p + 1) = a^t. */
-		r = (g2_cmp(u, v) == RLC_EQ);
+		switch (ep_param_get()) {
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P382:
+			case BN_P446:
+			case BN_P638:
+				/* Check if [x + 1]a + psi([x]a) + psi^2([x]a) = psi^3([2x]a),
+				 * which holds exactly on G_2 for BN curves. */
+				fp_param_get_var(n);
+				ep2_mul_basic(u, a, n);
+				ep2_frb(v, u, 1);
+				ep2_frb(w, u, 2);
+				g2_add(v, v, w);
+				g2_add(v, v, u);
+				g2_add(v, v, a);
+				/* The third power of psi expects a point in affine form. */
+				g2_dbl(u, u);
+				g2_norm(u, u);
+				ep2_frb(w, u, 3);
+				r = g2_is_infty(a) || g2_cmp(v, w) == RLC_EQ;
+				r = r && ep2_is_valid(a);
+				break;
+			case B12_P381:
+			case B12_P455:
+			case B12_P638:
+				/* Check if psi(a) = [x]a, as x is the eigenvalue of psi. */
+				fp_param_get_var(n);
+				ep2_mul_basic(u, a, n);
+				ep2_frb(v, a, 1);
+				r = g2_is_infty(a) || g2_cmp(u, v) == RLC_EQ;
+				r = r && ep2_is_valid(a);
+				break;
+			default:
+				g2_get_ord(n);
+				ep_curve_get_cof(p);
+				bn_mul(n, n, p);
+				dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
+				p->used = RLC_FP_DIGS;
+				p->sign = RLC_POS;
+				/* Compute trace t = p - n + 1. */
+				bn_sub(n, p, n);
+				bn_add_dig(n, n, 1);
+				/* Compute u = a^t. */
+				g2_mul(u, a, n);
+				/* Compute v = a^(p + 1). */
+				ep2_frb(v, a, 1);
+				g2_add(v, v, a);
+				/* Check if a^(p + 1) = a^t. */
+				r = (g2_cmp(u, v) == RLC_EQ);
+				break;
+		}
 	} CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	} FINALLY {
@@ -186,6 +453,7 @@ int g2_is_valid(g2_t a) {
 		bn_free(n);
 		g2_free(u);
 		g2_free(v);
+		g2_free(w);
 	}
 
 	return r;
@@ -193,34 +461,89 @@ int g2_is_valid(g2_t a) {
 
 int gt_is_valid(gt_t a) {
 	bn_t p, n;
-	gt_t u, v;
-	int r;
+	gt_t u, v, w;
+	int k = 1, r = 0;
 
 	bn_null(n);
 	bn_null(p);
 	gt_null(u);
 	gt_null(v);
+	gt_null(w);
 
 	TRY {
 		bn_new(n);
 		bn_new(p);
 		gt_new(u);
 		gt_new(v);
+		gt_new(w);
 
-		gt_get_ord(n);
-		dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
-		p->used = RLC_FP_DIGS;
-		p->sign = RLC_POS;
-		/* Compute trace t = p - n + 1. */
-		bn_sub(n, p, n);
-		bn_add_dig(n, n, 1);
-		/* Compute u = a^t. */
-		gt_exp(u, a, n);
-		/* Compute v = a^(p + 1). */
-		fp12_frb(v, a, 1);
-		gt_mul(v, v, a);
-		/* Check if a^(p + 1) = a^t. */
-		r = (gt_cmp(u, v) == RLC_EQ);
+		switch (ep_param_get()) {
+#if FP_PRIME < 1536
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P382:
+			case BN_P446:
+			case BN_P638:
+				/* Frobenius acts as 6x^2 on BN curves, so test differently. */
+				k = 2;
+				/* Fall through. */
+			case B12_P381:
+			case B12_P455:
+			case B12_P638:
+				/* Check that a^(p^6 + 1) = 1 and a^(p^4 - p^2 + 1) = 1, so
+				 * that a is in the cyclotomic subgroup. Results are compared
+				 * after a multiplication, as Frobenius maps and conjugates
+				 * may leave zero coefficients unreduced. */
+				fp12_inv_uni(u, a);
+				fp12_mul(u, u, a);
+				r = (fp12_cmp_dig(u, 1) == RLC_EQ);
+				fp12_frb(u, a, 2);
+				fp12_frb(v, u, 2);
+				fp12_mul(v, v, a);
+				fp12_inv_uni(u, u);
+				fp12_mul(v, v, u);
+				r &= (fp12_cmp_dig(v, 1) == RLC_EQ);
+				if (r == 0) {
+					break;
+				}
+				/* Now compare powers of a by x, using that a^-1 = conj(a). */
+				gt_exp_var(u, a);
+				if (k == 2) {
+					/* Check a^(x + 1) * (a^x)^(p + p^2) = (a^2x)^(p^3). */
+					fp12_frb(v, u, 1);
+					fp12_mul(v, v, u);
+					fp12_mul(v, v, a);
+					fp12_frb(w, u, 2);
+					fp12_mul(v, v, w);
+					fp12_sqr_cyc(u, u);
+					fp12_frb(u, u, 3);
+				} else {
+					/* Check if a^p = a^x, as Frobenius acts as x on G_T. */
+					fp12_frb(v, a, 1);
+				}
+				fp12_inv_uni(v, v);
+				fp12_mul(v, v, u);
+				r = (fp12_cmp_dig(v, 1) == RLC_EQ);
+				break;
+#endif
+			default:
+				gt_get_ord(n);
+				dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
+				p->used = RLC_FP_DIGS;
+				p->sign = RLC_POS;
+				/* Compute trace t = p - n + 1. */
+				bn_sub(n, p, n);
+				bn_add_dig(n, n, 1);
+				/* Compute u = a^t. */
+				gt_exp(u, a, n);
+				/* Compute v = a^(p + 1). */
+				fp12_frb(v, a, 1);
+				gt_mul(v, v, a);
+				/* Check if a^(p + 1) = a^t. */
+				r = (gt_cmp(u, v) == RLC_EQ);
+				break;
+		}
 	} CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	} FINALLY {
@@ -228,7 +551,12 @@ int gt_is_valid(gt_t a) {
 		bn_free(n);
 		gt_free(u);
 		gt_free(v);
+		gt_free(w);
 	}
 
 	return r;
 }
+
+READ_BIN_SIM(g1_read_bin_sim, g1, ep_read_bin_sim, ep_curve_get_cof)
+
+READ_BIN_SIM(g2_read_bin_sim, g2, ep2_read_bin_sim, g2_get_cof)
@@ -403,6 +403,316 @@ static void pp_fin_k12_oatep(fp12_t r, ep2_t t, ep2_t q, ep_t p) {
 }
 
 
+/**
+ * Compute the Miller loop for many pairings of type G_2 x G_1 over the bits of
+ * a given parameter represented in sparse form. Line functions for consecutive
+ * pairings are multiplied together before accumulation, since the product of
+ * two sparse elements is cheaper than two dense-by-sparse multiplications.
+ *
+ * @param[out] r			- the result.
+ * @param[out] t			- the resulting points.
+ * @param[in] q				- the vector of first arguments in affine coordinates.
+ * @param[in] p				- the vector of second arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] s				- the loop parameter in sparse form.
+ * @param[in] len			- the length of the loop parameter.
+ */
+static void pp_mil_lot_k12(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, int m,
+		int *s, int len) {
+	fp12_t l, u, v;
+	ep_t *_p = NULL;
+	ep2_t *_q = NULL;
+	int i, j;
+
+	fp12_null(l);
+	fp12_null(u);
+	fp12_null(v);
+
+	TRY {
+		fp12_new(l);
+		fp12_new(u);
+		fp12_new(v);
+		_p = (ep_t *)calloc(m, sizeof(ep_t));
+		_q = (ep2_t *)calloc(m, sizeof(ep2_t));
+		if (_p == NULL || _q == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+
+		for (j = 0; j < m; j++) {
+			ep_null(_p[j]);
+			ep2_null(_q[j]);
+			ep_new(_p[j]);
+			ep2_new(_q[j]);
+			ep2_copy(t[j], q[j]);
+			ep2_neg(_q[j], q[j]);
+#if EP_ADD == BASIC
+			ep_neg(_p[j], p[j]);
+#else
+			fp_add(_p[j]->x, p[j]->x, p[j]->x);
+			fp_add(_p[j]->x, _p[j]->x, p[j]->x);
+			fp_neg(_p[j]->y, p[j]->y);
+#endif
+		}
+
+		/* Line functions only write their non-zero coefficients. */
+		fp12_zero(l);
+		fp12_zero(u);
+		fp12_set_dig(r, 1);
+		for (i = len - 2; i >= 0; i--) {
+			if (i < len - 2) {
+				fp12_sqr(r, r);
+			}
+			for (j = 0; j < m - 1; j += 2) {
+				pp_dbl_k12(l, t[j], t[j], _p[j]);
+				pp_dbl_k12(u, t[j + 1], t[j + 1], _p[j + 1]);
+				fp12_mul_sxs(v, l, u);
+				fp12_mul(r, r, v);
+			}
+			if (m & 1) {
+				pp_dbl_k12(l, t[m - 1], t[m - 1], _p[m - 1]);
+				fp12_mul_dxs(r, r, l);
+			}
+			if (s[i] != 0) {
+				for (j = 0; j < m - 1; j += 2) {
+					pp_add_k12(l, t[j], (s[i] > 0 ? q[j] : _q[j]), p[j]);
+					pp_add_k12(u, t[j + 1], (s[i] > 0 ? q[j + 1] : _q[j + 1]),
+							p[j + 1]);
+					fp12_mul_sxs(v, l, u);
+					fp12_mul(r, r, v);
+				}
+				if (m & 1) {
+					pp_add_k12(l, t[m - 1], (s[i] > 0 ? q[m - 1] : _q[m - 1]),
+							p[m - 1]);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(l);
+		fp12_free(u);
+		fp12_free(v);
+		for (j = 0; j < m; j++) {
+			if (_p != NULL) {
+				ep_free(_p[j]);
+			}
+			if (_q != NULL) {
+				ep2_free(_q[j]);
+			}
+		}
+		free(_p);
+		free(_q);
+	}
+}
+
+/**
+ * Compute the final lines for many optimal ate pairings, multiplying the two
+ * line functions of each pairing together before accumulation.
+ *
+ * @param[out] r			- the result.
+ * @param[out] t			- the resulting points.
+ * @param[in] q				- the first points of the pairings, in G_2.
+ * @param[in] p				- the second points of the pairings, in G_1.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_fin_lot_k12(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, int m) {
+	ep2_t q1, q2;
+	fp12_t l, u, v;
+
+	ep2_null(q1);
+	ep2_null(q2);
+	fp12_null(l);
+	fp12_null(u);
+	fp12_null(v);
+
+	TRY {
+		ep2_new(q1);
+		ep2_new(q2);
+		fp12_new(l);
+		fp12_new(u);
+		fp12_new(v);
+		fp12_zero(l);
+		fp12_zero(u);
+
+		fp2_set_dig(q1->z, 1);
+		fp2_set_dig(q2->z, 1);
+
+		for (int j = 0; j < m; j++) {
+			ep2_frb(q1, q[j], 1);
+			ep2_frb(q2, q[j], 2);
+			ep2_neg(q2, q2);
+
+			pp_add_k12(l, t[j], q1, p[j]);
+			pp_add_k12(u, t[j], q2, p[j]);
+			fp12_mul_sxs(v, l, u);
+			fp12_mul(r, r, v);
+		}
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		ep2_free(q1);
+		ep2_free(q2);
+		fp12_free(l);
+		fp12_free(u);
+		fp12_free(v);
+	}
+}
+
+/**
+ * Evaluates a precomputed line function at a point.
+ *
+ * @param[out] l			- the result of the evaluation.
+ * @param[in] t				- the coefficients of the line function.
+ * @param[in] p				- the affine point to evaluate the line function.
+ */
+static void pp_fix_lin_k12(fp12_t l, fp6_t t, ep_t p) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp_mul(l[zero][zero][0], t[0][0], p->y);
+	fp_mul(l[zero][zero][1], t[0][1], p->y);
+	fp_mul(l[one][zero][0], t[1][0], p->x);
+	fp_mul(l[one][zero][1], t[1][1], p->x);
+	fp2_copy(l[one][one], t[2]);
+}
+
+/**
+ * Stores the coefficients of a line function evaluated at P = (1, 1).
+ *
+ * @param[out] t			- the coefficients of the line function.
+ * @param[in] l				- the line function.
+ */
+static void pp_fix_set_k12(fp6_t t, fp12_t l) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp2_copy(t[0], l[zero][zero]);
+	fp2_copy(t[1], l[one][zero]);
+	fp2_copy(t[2], l[one][one]);
+}
+
+/**
+ * Evaluates the k-th precomputed line function of many pairings and
+ * accumulates the product.
+ *
+ * @param[in,out] r			- the accumulator.
+ * @param[out] l			- the first temporary line function.
+ * @param[out] u			- the second temporary line function.
+ * @param[out] v			- the temporary product of two line functions.
+ * @param[in] t				- the precomputation tables.
+ * @param[in] k				- the index of the line functions.
+ * @param[in] p				- the affine points to evaluate the line functions.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_fix_acc_k12(fp12_t r, fp12_t l, fp12_t u, fp12_t v, fp6_t **t,
+		int k, ep_t *p, int m) {
+	int j;
+
+	for (j = 0; j < m - 1; j += 2) {
+		pp_fix_lin_k12(l, t[j][k], p[j]);
+		pp_fix_lin_k12(u, t[j + 1][k], p[j + 1]);
+		fp12_mul_sxs(v, l, u);
+		fp12_mul(r, r, v);
+	}
+	if (m & 1) {
+		pp_fix_lin_k12(l, t[m - 1][k], p[m - 1]);
+		fp12_mul_dxs(r, r, l);
+	}
+}
+
+/**
+ * Compute the Miller loop and final lines of many optimal ate pairings with
+ * precomputed line functions.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first arguments in affine coordinates.
+ * @param[in] t				- the precomputation tables of the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ * @param[in] s				- the loop parameter in sparse form.
+ * @param[in] len			- the length of the loop parameter.
+ * @param[in] neg			- the flag indicating a negative loop parameter.
+ * @param[in] fin			- the flag indicating the final lines are present.
+ */
+static void pp_mil_fix_k12(fp12_t r, ep_t *p, fp6_t **t, int m, int *s,
+		int len, int neg, int fin) {
+	fp12_t l, u, v;
+	ep_t *_p = NULL;
+	int i, j, k = 0;
+
+	fp12_null(l);
+	fp12_null(u);
+	fp12_null(v);
+
+	TRY {
+		fp12_new(l);
+		fp12_new(u);
+		fp12_new(v);
+		_p = (ep_t *)calloc(m, sizeof(ep_t));
+		if (_p == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+
+		/* Doubling lines are evaluated at the point used by pp_dbl_k12(). */
+		for (j = 0; j < m; j++) {
+			ep_null(_p[j]);
+			ep_new(_p[j]);
+#if EP_ADD == BASIC
+			ep_neg(_p[j], p[j]);
+#else
+			fp_add(_p[j]->x, p[j]->x, p[j]->x);
+			fp_add(_p[j]->x, _p[j]->x, p[j]->x);
+			fp_neg(_p[j]->y, p[j]->y);
+#endif
+		}
+
+		fp12_zero(l);
+		fp12_zero(u);
+		fp12_set_dig(r, 1);
+		for (i = len - 2; i >= 0; i--) {
+			if (i < len - 2) {
+				fp12_sqr(r, r);
+			}
+			pp_fix_acc_k12(r, l, u, v, t, k++, _p, m);
+			if (s[i] != 0) {
+				pp_fix_acc_k12(r, l, u, v, t, k++, p, m);
+			}
+		}
+		if (neg) {
+			/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+			fp12_inv_uni(r, r);
+		}
+		if (fin) {
+			pp_fix_acc_k12(r, l, u, v, t, k++, p, m);
+			pp_fix_acc_k12(r, l, u, v, t, k++, p, m);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(l);
+		fp12_free(u);
+		fp12_free(v);
+		if (_p != NULL) {
+			for (j = 0; j < m; j++) {
+				ep_free(_p[j]);
+			}
+		}
+		free(_p);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -983,4 +1293,307 @@ void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
 	}
 }
 
+void pp_map_sim_lot_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	ep_t *_p = NULL;
+	ep2_t *t = NULL, *_q = NULL;
+	bn_t a;
+	int i, j, len = RLC_FP_BITS, s[RLC_FP_BITS];
+
+	fp12_set_dig(r, 1);
+	if (m <= 0) {
+		return;
+	}
+
+	bn_null(a);
+
+	TRY {
+		bn_new(a);
+		_p = (ep_t *)calloc(m, sizeof(ep_t));
+		_q = (ep2_t *)calloc(m, sizeof(ep2_t));
+		t = (ep2_t *)calloc(m, sizeof(ep2_t));
+		if (_p == NULL || _q == NULL || t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep2_null(_q[i]);
+			ep2_null(t[i]);
+			ep_new(_p[i]);
+			ep2_new(_q[i]);
+			ep2_new(t[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep2_is_infty(q[i])) {
+				ep_copy(_p[j], p[i]);
+				ep2_copy(_q[j++], q[i]);
+			}
+		}
+
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+
+		if (j > 0) {
+			/* Share a single inversion among all normalizations. */
+			ep_norm_sim(_p, (const ep_t *)_p, j);
+			ep2_norm_sim(_q, _q, j);
+
+			switch (ep_param_get()) {
+				case BN_P158:
+				case BN_P254:
+				case BN_P256:
+				case BN_P382:
+				case BN_P446:
+				case BN_P638:
+					/* r = \prod f_{|a|,Q_i}(P_i). */
+					pp_mil_lot_k12(r, t, _q, _p, j, s, len);
+					if (bn_sign(a) == RLC_NEG) {
+						/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+						fp12_inv_uni(r, r);
+						for (i = 0; i < j; i++) {
+							ep2_neg(t[i], t[i]);
+						}
+					}
+					pp_fin_lot_k12(r, t, _q, _p, j);
+					pp_exp_k12(r, r);
+					break;
+				case B12_P381:
+				case B12_P455:
+				case B12_P638:
+					/* r = \prod f_{|a|,Q_i}(P_i). */
+					pp_mil_lot_k12(r, t, _q, _p, j, s, len);
+					if (bn_sign(a) == RLC_NEG) {
+						fp12_inv_uni(r, r);
+					}
+					pp_exp_k12(r, r);
+					break;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			if (_p != NULL) {
+				ep_free(_p[i]);
+			}
+			if (_q != NULL) {
+				ep2_free(_q[i]);
+			}
+			if (t != NULL) {
+				ep2_free(t[i]);
+			}
+		}
+		free(_p);
+		free(_q);
+		free(t);
+	}
+}
+
+void pp_map_pre_k12(fp6_t *t, ep2_t q) {
+	ep_t p;
+	ep2_t r, _q, n, q1, q2;
+	fp12_t l;
+	bn_t a;
+	int i, k, fin = 0, len = RLC_FP_BITS, s[RLC_FP_BITS];
+
+	if (ep2_is_infty(q)) {
+		/* An all-zero first line marks the table of the point at infinity. */
+		for (i = 0; i < RLC_PP_TABLE; i++) {
+			fp6_zero(t[i]);
+		}
+		return;
+	}
+
+	ep_null(p);
+	ep2_null(r);
+	ep2_null(_q);
+	ep2_null(n);
+	ep2_null(q1);
+	ep2_null(q2);
+	fp12_null(l);
+	bn_null(a);
+
+	TRY {
+		ep_new(p);
+		ep2_new(r);
+		ep2_new(_q);
+		ep2_new(n);
+		ep2_new(q1);
+		ep2_new(q2);
+		fp12_new(l);
+		bn_new(a);
+
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+
+		switch (ep_param_get()) {
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P382:
+			case BN_P446:
+			case BN_P638:
+				fin = 1;
+				break;
+		}
+		/* Count the line functions to make sure they fit in the table. */
+		k = len - 1 + 2 * fin;
+		for (i = len - 2; i >= 0; i--) {
+			k += (s[i] != 0);
+		}
+		if (k > RLC_PP_TABLE) {
+			THROW(ERR_NO_BUFFER);
+		} else {
+			k = 0;
+
+			/* Line functions are linear in the coordinates of P = (1, 1). */
+			fp_set_dig(p->x, 1);
+			fp_set_dig(p->y, 1);
+			fp_set_dig(p->z, 1);
+			p->norm = 1;
+
+			ep2_norm(_q, q);
+			ep2_neg(n, _q);
+			ep2_copy(r, _q);
+
+			for (i = len - 2; i >= 0; i--) {
+				fp12_zero(l);
+				pp_dbl_k12(l, r, r, p);
+				pp_fix_set_k12(t[k++], l);
+				if (s[i] != 0) {
+					fp12_zero(l);
+					pp_add_k12(l, r, (s[i] > 0 ? _q : n), p);
+					pp_fix_set_k12(t[k++], l);
+				}
+			}
+			if (fin) {
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(r, r);
+				}
+				fp2_set_dig(q1->z, 1);
+				fp2_set_dig(q2->z, 1);
+				ep2_frb(q1, _q, 1);
+				ep2_frb(q2, _q, 2);
+				ep2_neg(q2, q2);
+				fp12_zero(l);
+				pp_add_k12(l, r, q1, p);
+				pp_fix_set_k12(t[k++], l);
+				fp12_zero(l);
+				pp_add_k12(l, r, q2, p);
+				pp_fix_set_k12(t[k++], l);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(p);
+		ep2_free(r);
+		ep2_free(_q);
+		ep2_free(n);
+		ep2_free(q1);
+		ep2_free(q2);
+		fp12_free(l);
+		bn_free(a);
+	}
+}
+
+void pp_map_fix_oatep_k12(fp12_t r, ep_t p, fp6_t *t) {
+	ep_t _p[1];
+	fp6_t *_t[1] = { t };
+
+	ep_null(_p[0]);
+
+	TRY {
+		ep_new(_p[0]);
+		ep_copy(_p[0], p);
+		pp_map_sim_fix_oatep_k12(r, _p, _t, 1);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(_p[0]);
+	}
+}
+
+void pp_map_sim_fix_oatep_k12(fp12_t r, ep_t *p, fp6_t *t[], int m) {
+	ep_t *_p = NULL;
+	fp6_t **_t = NULL;
+	bn_t a;
+	int i, j, fin = 0, len = RLC_FP_BITS, s[RLC_FP_BITS];
+
+	fp12_set_dig(r, 1);
+	if (m <= 0) {
+		return;
+	}
+
+	bn_null(a);
+
+	TRY {
+		bn_new(a);
+		_p = (ep_t *)calloc(m, sizeof(ep_t));
+		_t = (fp6_t **)calloc(m, sizeof(fp6_t *));
+		if (_p == NULL || _t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_new(_p[i]);
+		}
+
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !fp6_is_zero(t[i][0])) {
+				ep_copy(_p[j], p[i]);
+				_t[j++] = t[i];
+			}
+		}
+
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+
+		if (j > 0) {
+			ep_norm_sim(_p, (const ep_t *)_p, j);
+
+			switch (ep_param_get()) {
+				case BN_P158:
+				case BN_P254:
+				case BN_P256:
+				case BN_P382:
+				case BN_P446:
+				case BN_P638:
+					fin = 1;
+					break;
+			}
+			pp_mil_fix_k12(r, _p, _t, j, s, len, bn_sign(a) == RLC_NEG, fin);
+			pp_exp_k12(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(a);
+		if (_p != NULL) {
+			for (i = 0; i < m; i++) {
+				ep_free(_p[i]);
+			}
+		}
+		free(_p);
+		free(_t);
+	}
+}
+
 #endif
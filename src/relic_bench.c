@@ -29,12 +29,22 @@
  * @ingroup relic
  */
 
+/* Needed for pinning benchmarks to a processor. */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "relic_core.h"
 #include "relic_conf.h"
 
+#if OPSYS == LINUX
+#include <sched.h>
+#endif
+
 #if OPSYS == DUINO && TIMER == HREAL
 /*
  * Prototype for Arduino timing function.
@@ -107,6 +117,295 @@ typedef unsigned long long bench_t;
 
 #endif
 
+/**
+ * Inserts quotation marks in the macro argument.
+ */
+/** @{ */
+#define QUOTE(A)			BENCH_QUOTE(A)
+#define BENCH_QUOTE(A)		#A
+/** @} */
+
+/**
+ * Unit of the timings, as printed after each benchmark.
+ */
+#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
+#define UNIT			"microsec"
+#define SCALE			1000000.0
+#elif TIMER == CYCLE
+#define UNIT			"cycles"
+#define SCALE			0.0
+#else
+#define UNIT			"nanosec"
+#define SCALE			1000000000.0
+#endif
+
+/**
+ * Library configuration stored in each benchmark record.
+ */
+#define CONFIG			"ARITH=" CONF_ARITH CONF_FP CONF_BN CONF_FPX CONF_EP \
+	CONF_PP CONF_FB
+
+#if ARITH == EASY
+#define CONF_ARITH		"easy"
+#elif ARITH == GMP
+#define CONF_ARITH		"gmp"
+#else
+#define CONF_ARITH		QUOTE(ARITH)
+#endif
+#ifdef WITH_FP
+#define CONF_FP			";FP_PRIME=" QUOTE(FP_PRIME) ";FP_METHD=" FP_METHD
+#else
+#define CONF_FP			""
+#endif
+#ifdef WITH_BN
+#define CONF_BN			";BN_METHD=" BN_METHD
+#else
+#define CONF_BN			""
+#endif
+#ifdef WITH_FPX
+#define CONF_FPX		";FPX_METHD=" FPX_METHD
+#else
+#define CONF_FPX		""
+#endif
+#ifdef WITH_EP
+#define CONF_EP			";EP_METHD=" EP_METHD
+#else
+#define CONF_EP			""
+#endif
+#ifdef WITH_PP
+#define CONF_PP			";PP_METHD=" PP_METHD
+#else
+#define CONF_PP			""
+#endif
+#ifdef WITH_FB
+#define CONF_FB			";FB_POLYN=" QUOTE(FB_POLYN) ";FB_METHD=" FB_METHD
+#else
+#define CONF_FB			""
+#endif
+
+/**
+ * If multi-threading is enabled, assigns each thread a local copy of the data.
+ */
+#if MULTI == PTHREAD
+#define thread 	__thread
+#else
+#define thread /* */
+#endif
+
+#if BENCH > 0
+
+/**
+ * Samples of the current benchmark, kept apart for each thread.
+ */
+static thread struct {
+	/** Stores the timings of the samples of the current benchmark. */
+	long long samples[BENCH];
+	/** Number of samples stored for the current benchmark. */
+	int count;
+	/** Number of samples measured for the current benchmark. */
+	int runs;
+	/** Label of the current benchmark. */
+	char label[RLC_BENCH_LABEL];
+} state;
+
+#if MULTI == OPENMP
+#pragma omp threadprivate(state)
+#endif
+
+#endif /* BENCH > 0 */
+
+#if BENCH > 0 && OPSYS != DUINO
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the options shared by all threads.
+ */
+static pthread_mutex_t bench_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Options read from the environment by the first benchmark.
+ */
+static struct {
+	/** Flag to indicate if the options were read. */
+	int init;
+	/** File to which records are appended, or NULL. */
+	const char *out;
+	/** Flag to indicate if records are written as JSON Lines. */
+	int json;
+	/** Number of leading samples discarded as warm-up runs. */
+	int warm;
+	/** Number of baseline records. */
+	int base;
+	/** Labels of the baseline records. */
+	char label[RLC_BENCH_BASE][RLC_BENCH_LABEL];
+	/** Medians of the baseline records. */
+	double median[RLC_BENCH_BASE];
+	/** Flags to indicate which baseline records were already compared. */
+	char used[RLC_BENCH_BASE];
+} opts;
+
+/**
+ * Copies a label from a record, stopping at the closing quotation mark.
+ *
+ * @param[out] label		- the label.
+ * @param[in] str			- the record, after the opening quotation mark.
+ * @return a pointer past the closing quotation mark, or NULL if not found.
+ */
+static const char *bench_scan(char *label, const char *str) {
+	int i;
+
+	for (i = 0; str[i] != '"' && str[i] != '\0'; i++) {
+		if (i < RLC_BENCH_LABEL - 1) {
+			label[i] = str[i];
+		}
+	}
+	label[RLC_MIN(i, RLC_BENCH_LABEL - 1)] = '\0';
+	return (str[i] == '"' ? str + i + 1 : NULL);
+}
+
+/**
+ * Loads the medians of a file of records written by a previous run, in either
+ * of the two formats.
+ *
+ * @param[in] path			- the path of the file.
+ */
+static void bench_load(const char *path) {
+	char line[1024];
+	const char *ptr;
+	FILE *fp;
+	int i;
+
+	if ((fp = fopen(path, "r")) == NULL) {
+		util_print("BENCH: cannot read baseline %s\n", path);
+		return;
+	}
+	while (opts.base < RLC_BENCH_BASE && fgets(line, sizeof(line), fp)) {
+		ptr = NULL;
+		if (strncmp(line, "{\"label\":\"", 10) == 0) {
+			ptr = bench_scan(opts.label[opts.base], line + 10);
+			if (ptr != NULL && (ptr = strstr(ptr, "\"median\":")) != NULL) {
+				ptr += 9;
+			}
+		} else if (line[0] == '"') {
+			/* The median is the seventh column of the CSV records. */
+			ptr = bench_scan(opts.label[opts.base], line + 1);
+			for (i = 0; ptr != NULL && i < 6; i++) {
+				ptr = strchr(ptr, ',');
+				ptr = (ptr != NULL ? ptr + 1 : NULL);
+			}
+		}
+		if (ptr != NULL) {
+			opts.median[opts.base++] = atof(ptr);
+		}
+	}
+	fclose(fp);
+}
+
+/**
+ * Reads the benchmarking options from the environment.
+ */
+static void bench_init(void) {
+	const char *str;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&bench_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (bench)
+#endif
+	if (!opts.init) {
+		opts.init = 1;
+		opts.out = getenv("RELIC_BENCH_OUT");
+		str = getenv("RELIC_BENCH_FMT");
+		opts.json = (str != NULL && strcmp(str, "json") == 0);
+		str = getenv("RELIC_BENCH_WARM");
+		opts.warm = (str != NULL ? RLC_MAX(atoi(str), 0) : 0);
+		str = getenv("RELIC_BENCH_BASE");
+		if (str != NULL) {
+			bench_load(str);
+		}
+#if OPSYS == LINUX
+		str = getenv("RELIC_BENCH_CPU");
+		if (str != NULL) {
+			cpu_set_t set;
+
+			CPU_ZERO(&set);
+			CPU_SET(atoi(str), &set);
+			if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+				util_print("BENCH: cannot pin to processor %s\n", str);
+			}
+		}
+#endif
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&bench_lock);
+#endif
+}
+
+/**
+ * Compares two timings, for sorting.
+ *
+ * @param[in] a				- the first timing.
+ * @param[in] b				- the second timing.
+ * @return -1, 0 or 1 if the first timing is smaller, equal or larger.
+ */
+static int bench_cmp(const void *a, const void *b) {
+	long long x = *(const long long *)a, y = *(const long long *)b;
+	return (x > y) - (x < y);
+}
+
+/**
+ * Computes the square root of a non-negative number with Newton's method, to
+ * avoid linking the math library.
+ *
+ * @param[in] a				- the number.
+ * @return the square root.
+ */
+static double bench_sqrt(double a) {
+	double x = (a > 1 ? a : 1);
+
+	for (int i = 0; i < 64 && x * x > a * (1 + 1e-12); i++) {
+		x = (x + a / x) / 2;
+	}
+	return (a > 0 ? x : 0);
+}
+
+/**
+ * Appends the record of the last benchmark to the output file.
+ *
+ * @param[in] ctx			- the library context.
+ * @param[in] dev			- the standard deviation of the samples.
+ */
+static void bench_write(ctx_t *ctx, double dev) {
+	long long *s = state.samples;
+	int n = state.count;
+	double ops = (SCALE > 0 && ctx->total > 0 ? SCALE / ctx->total : 0);
+	FILE *fp;
+
+	if ((fp = fopen(opts.out, "a")) == NULL) {
+		return;
+	}
+	if (opts.json) {
+		fprintf(fp, "{\"label\":\"%s\",\"config\":\"%s\",\"unit\":\"%s\","
+				"\"samples\":%d,\"mean\":%lld,\"min\":%lld,\"median\":%lld,"
+				"\"p99\":%lld,\"stddev\":%.1f,\"ops_sec\":%.1f}\n",
+				state.label, CONFIG, UNIT, n, ctx->total, s[0], s[n / 2],
+				s[(99 * n - 1) / 100], dev, ops);
+	} else {
+		fseek(fp, 0, SEEK_END);
+		if (ftell(fp) == 0) {
+			fprintf(fp, "label,config,unit,samples,mean,min,median,p99,stddev,"
+					"ops_sec\n");
+		}
+		fprintf(fp, "\"%s\",\"%s\",%s,%d,%lld,%lld,%lld,%lld,%.1f,%.1f\n",
+				state.label, CONFIG, UNIT, n, ctx->total, s[0], s[n / 2],
+				s[(99 * n - 1) / 100], dev, ops);
+	}
+	fclose(fp);
+}
+
+#endif /* BENCH > 0 && OPSYS != DUINO */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -162,11 +461,31 @@ void bench_overhead(void) {
 #endif /* OVER && TIMER && BENCH > 1 */
 
 void bench_reset(void) {
-#ifdef TIMER
-	core_get()->total = 0;
+#if BENCH > 0
+	ctx_t *ctx = core_get();
+
+#if OPSYS != DUINO
+	bench_init();
+#endif
+	ctx->total = 0;
+	state.count = state.runs = 0;
+	state.label[0] = '\0';
 #endif
 }
 
+void bench_label(const char *label, int width) {
+	int len = strlen(label);
+#if BENCH > 0
+	/* Labels are quoted in the records, so replace quotation marks. */
+	for (int i = 0; i < RLC_BENCH_LABEL - 1 && label[i] != '\0'; i++) {
+		state.label[i] = (label[i] == '"' || label[i] == '\\' ?
+				'\'' : label[i]);
+		state.label[i + 1] = '\0';
+	}
+#endif
+	util_print("BENCH: %s%*c = ", label, RLC_MAX(width - len, 1), ' ');
+}
+
 void bench_before(void) {
 #if OPSYS == DUINO && TIMER == HREAL
 	core_get()->before = micros();
@@ -206,6 +525,12 @@ void bench_after(void) {
 
 #ifdef TIMER
 	ctx->total += result;
+#if BENCH > 0
+	if (state.count < BENCH) {
+		state.samples[state.count++] = result;
+	}
+	state.runs++;
+#endif
 #else
 	(void)result;
 	(void)ctx;
@@ -215,7 +540,30 @@ void bench_after(void) {
 void bench_compute(int benches) {
 	ctx_t *ctx = core_get();
 #ifdef TIMER
+#if BENCH > 0 && OPSYS != DUINO
+	int i, w = 0;
+	/* Each sample measures the same number of executions. */
+	double ops = (double)benches / RLC_MAX(state.runs, 1);
+
+	/* Discard the warm-up samples if all of them were stored. */
+	if (state.runs == state.count && opts.warm < state.count) {
+		w = opts.warm;
+	}
+	for (i = 0; i < w; i++) {
+		ctx->total -= state.samples[i];
+	}
+	state.count -= w;
+	for (i = 0; i < state.count; i++) {
+		state.samples[i] = state.samples[i + w] / ops;
+#ifdef OVERH
+		state.samples[i] -= ctx->over;
+#endif
+	}
+	qsort(state.samples, state.count, sizeof(long long), bench_cmp);
+	ctx->total = ctx->total / (benches - w * ops);
+#else
 	ctx->total = ctx->total / benches;
+#endif
 #ifdef OVERH
 	ctx->total = ctx->total - ctx->over;
 #endif /* OVERH */
@@ -236,10 +584,51 @@ void bench_print(void) {
 	util_print("%lld nanosec", ctx->total);
 #endif
 	if (ctx->total < 0) {
-		util_print(" (overflow or bad overhead estimation)\n");
-	} else {
-		util_print("\n");
+		util_print(" (overflow or bad overhead estimation)");
+	}
+
+#if BENCH > 0 && OPSYS != DUINO && defined(TIMER)
+	if (state.label[0] != '\0' && state.count > 0) {
+		double dev = 0, mean = 0;
+		int i;
+
+		for (i = 0; i < state.count; i++) {
+			mean += state.samples[i];
+		}
+		mean /= state.count;
+		for (i = 0; i < state.count; i++) {
+			dev += (state.samples[i] - mean) * (state.samples[i] - mean);
+		}
+		dev = bench_sqrt(dev / state.count);
+
+		/* Repeated labels are matched in the order they were recorded. */
+#if MULTI == PTHREAD
+		pthread_mutex_lock(&bench_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (bench)
+#endif
+		{
+			for (i = 0; i < opts.base; i++) {
+				if (!opts.used[i] && strcmp(opts.label[i], state.label) == 0) {
+					opts.used[i] = 1;
+					if (opts.median[i] > 0) {
+						util_print(" (%+.1f%% median vs baseline)",
+								100.0 * state.samples[state.count / 2] /
+								opts.median[i] - 100.0);
+					}
+					break;
+				}
+			}
+			if (opts.out != NULL) {
+				bench_write(ctx, dev);
+			}
+		}
+#if MULTI == PTHREAD
+		pthread_mutex_unlock(&bench_lock);
+#endif
 	}
+#endif
+	util_print("\n");
 }
 
 ull_t bench_total(void) {
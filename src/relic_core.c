@@ -95,7 +95,32 @@ thread ctx_t *core_ctx = NULL;
 #pragma omp threadprivate(first_ctx, core_ctx)
 #endif
 
+/**
+ * Default curve context, shared by all library contexts.
+ */
+static crv_t first_crv;
+
+/**
+ * Number of library contexts initialized with the default curve context.
+ */
+static int first_ref = 0;
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the initialization of the default curve context.
+ */
+static pthread_mutex_t first_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Number of writes in progress to the default curve context by the only
+ * library context using it.
+ */
+static int first_busy = 0;
+
 int core_init(void) {
+	int done;
+
 	if (core_ctx == NULL) {
 		core_ctx = &(first_ctx);
 	}
@@ -118,41 +143,105 @@ int core_init(void) {
 #endif
 
 	core_ctx->code = RLC_OK;
+	core_ctx->own = NULL;
 
 	TRY {
 		arch_init();
 		rand_init();
+		/* Only the first context configures the default curve context. */
+		for (done = 0; !done;) {
+#if MULTI == PTHREAD
+			pthread_mutex_lock(&first_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (first_crv)
+#endif
+			{
+				/* Other contexts wait until a write to it finishes. */
+				if (first_ref == 0) {
+					first_ref++;
+					core_init_crv(&first_crv);
+					done = 1;
+				} else if (first_busy == 0) {
+					first_ref++;
+					core_ctx->crv = &first_crv;
+					done = 1;
+				}
+			}
+#if MULTI == PTHREAD
+			pthread_mutex_unlock(&first_lock);
+#endif
+		}
+	}
+	CATCH_ANY {
+		return RLC_ERR;
+	}
+
+	return RLC_OK;
+}
+
+int core_clean(void) {
+	rand_clean();
+	/* The last context finalizes the default curve context. */
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&first_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (first_crv)
+#endif
+	{
+		if (first_ref > 0 && --first_ref == 0) {
+			core_clean_crv(&first_crv);
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&first_lock);
+#endif
+	if (core_ctx->own != NULL) {
+		core_clean_crv(core_ctx->own);
+		free(core_ctx->own);
+		core_ctx->own = NULL;
+	}
+	arch_clean();
+	core_ctx = NULL;
+	return RLC_OK;
+}
+
+ctx_t *core_get(void) {
+	return core_ctx;
+}
+
+void core_set(ctx_t *ctx) {
+	core_ctx = ctx;
+}
+
+void core_init_crv(crv_t *crv) {
+	core_ctx->crv = crv;
 #ifdef WITH_FP
-		fp_prime_init();
+	fp_prime_init();
 #endif
 #ifdef WITH_FB
-		fb_poly_init();
+	fb_poly_init();
 #endif
 #ifdef WITH_FT
-		ft_poly_init();
+	ft_poly_init();
 #endif
 #ifdef WITH_EP
-		ep_curve_init();
+	ep_curve_init();
 #endif
 #ifdef WITH_EB
-		eb_curve_init();
+	eb_curve_init();
 #endif
 #ifdef WITH_ED
-		ed_curve_init();
+	ed_curve_init();
 #endif
 #ifdef WITH_PP
-		pp_map_init();
+	pp_map_init();
 #endif
-	}
-	CATCH_ANY {
-		return RLC_ERR;
-	}
-
-	return RLC_OK;
 }
 
-int core_clean(void) {
-	rand_clean();
+void core_clean_crv(crv_t *crv) {
+	crv_t *old = core_ctx->crv;
+
+	core_ctx->crv = crv;
 #ifdef WITH_FP
 	fp_prime_clean();
 #endif
@@ -174,15 +263,207 @@ int core_clean(void) {
 #ifdef WITH_PP
 	pp_map_clean();
 #endif
-	arch_clean();
-	core_ctx = NULL;
-	return RLC_OK;
+	core_ctx->crv = (old == crv ? &first_crv : old);
 }
 
-ctx_t *core_get(void) {
-	return core_ctx;
+crv_t *core_get_crv(void) {
+	return core_ctx->crv;
 }
 
-void core_set(ctx_t *ctx) {
-	core_ctx = ctx;
+void core_set_crv(crv_t *crv) {
+	if (crv == NULL) {
+		crv = &first_crv;
+	}
+	core_ctx->crv = crv;
+}
+
+
+crv_t *core_own_crv(void) {
+	int shared = 0, ep = 0, eb = 0;
+	crv_t *src = &first_crv;
+
+	if (core_ctx->crv != &first_crv) {
+		return core_ctx->crv;
+	}
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&first_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (first_crv)
+#endif
+	{
+		/* The only user of the default writes to it in place, and other
+		 * contexts cannot attach to it until core_done_crv() is called. */
+		shared = (first_ref > 1);
+		if (!shared) {
+			first_busy++;
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&first_lock);
+#endif
+
+	if (!shared) {
+		return core_ctx->crv;
+	}
+
+	if (core_ctx->own == NULL) {
+		core_ctx->own = (crv_t *)malloc(sizeof(crv_t));
+		if (core_ctx->own == NULL) {
+			THROW(ERR_NO_MEMORY);
+			return NULL;
+		}
+	} else {
+		core_clean_crv(core_ctx->own);
+	}
+
+	/* Configure the private copy with the fields and curves of the default,
+	 * which is not written while it is shared. Custom fields and curves
+	 * with no identifier are copied from their parameters. */
+	core_init_crv(core_ctx->own);
+#ifdef WITH_EP
+	ep = src->ep_id;
+#endif
+#ifdef WITH_EB
+	eb = src->eb_id;
+#endif
+#ifdef WITH_FP
+	if (ep == 0) {
+		if (src->fp_id != 0) {
+			fp_param_set(src->fp_id);
+		} else if (!bn_is_zero(&(src->prime))) {
+#if FP_RDC == QUICK
+			fp_prime_set_pmers(src->sps, src->sps_len);
+#else
+			fp_prime_set_dense(&(src->prime));
+#endif
+		}
+	}
+#endif
+#ifdef WITH_EP
+	if (ep != 0) {
+		ep_param_set(ep);
+	} else if (!bn_is_zero(&(src->ep_r))) {
+#if defined(EP_ENDOM)
+		if (src->ep_is_endom) {
+#if EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP)
+			bn_t l;
+
+			bn_null(l);
+
+			TRY {
+				/* Recover the eigenvalue l = -v1[1]/v1[2] mod r. */
+				bn_new(l);
+				bn_mod_inv(l, &(src->ep_v1[2]), &(src->ep_r));
+				bn_mul(l, l, &(src->ep_v1[1]));
+				bn_neg(l, l);
+				bn_mod(l, l, &(src->ep_r));
+				ep_curve_set_endom(src->ep_b, &(src->ep_g), &(src->ep_r),
+						&(src->ep_h), src->beta, l);
+			}
+			CATCH_ANY {
+				THROW(ERR_CAUGHT);
+			}
+			FINALLY {
+				bn_free(l);
+			}
+#else
+			ep_curve_set_endom(src->ep_b, &(src->ep_g), &(src->ep_r),
+					&(src->ep_h), src->ep_b, &(src->ep_r));
+#endif
+		}
+#endif
+#if defined(EP_SUPER)
+		if (src->ep_is_super) {
+			ep_curve_set_super(src->ep_a, src->ep_b, &(src->ep_g),
+					&(src->ep_r), &(src->ep_h));
+		}
+#endif
+#if defined(EP_PLAIN)
+		if (!src->ep_is_endom && !src->ep_is_super) {
+			ep_curve_set_plain(src->ep_a, src->ep_b, &(src->ep_g),
+					&(src->ep_r), &(src->ep_h));
+		}
+#endif
+	}
+#endif
+#ifdef WITH_EPX
+	if (src->ep2_is_twist != 0) {
+		ep2_curve_set_twist(src->ep2_is_twist);
+	} else if (!bn_is_zero(&(src->ep2_r))) {
+		fp2_t a, b;
+
+		fp2_null(a);
+		fp2_null(b);
+
+		TRY {
+			fp2_new(a);
+			fp2_new(b);
+			fp_copy(a[0], src->ep2_a[0]);
+			fp_copy(a[1], src->ep2_a[1]);
+			fp_copy(b[0], src->ep2_b[0]);
+			fp_copy(b[1], src->ep2_b[1]);
+			ep2_curve_set(a, b, &(src->ep2_g), &(src->ep2_r), &(src->ep2_h));
+		}
+		CATCH_ANY {
+			THROW(ERR_CAUGHT);
+		}
+		FINALLY {
+			fp2_free(a);
+			fp2_free(b);
+		}
+	}
+#endif
+#ifdef WITH_FB
+	if (eb == 0) {
+		if (src->fb_id != 0) {
+			fb_param_set(src->fb_id);
+		} else if (src->fb_pb != 0) {
+			fb_poly_set_penta(src->fb_pa, src->fb_pb, src->fb_pc);
+		} else if (src->fb_pa != 0) {
+			fb_poly_set_trino(src->fb_pa);
+		} else if (!fb_is_zero(src->fb_poly)) {
+			fb_poly_set_dense(src->fb_poly);
+		}
+	}
+#endif
+#ifdef WITH_EB
+	if (eb != 0) {
+		eb_param_set(eb);
+	} else if (!bn_is_zero(&(src->eb_r))) {
+		eb_curve_set(src->eb_a, src->eb_b, &(src->eb_g), &(src->eb_r),
+				&(src->eb_h));
+	}
+#endif
+#ifdef WITH_ED
+	/* Edwards curves can only be configured from their identifiers. */
+	if (src->ed_id != 0) {
+		ed_param_set(src->ed_id);
+	}
+#endif
+	(void)src;
+	(void)ep;
+	(void)eb;
+
+	return core_ctx->crv;
+}
+
+void core_done_crv(void) {
+	if (core_ctx->crv != &first_crv) {
+		return;
+	}
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&first_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (first_crv)
+#endif
+	{
+		if (first_busy > 0) {
+			first_busy--;
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&first_lock);
+#endif
 }
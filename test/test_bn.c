@@ -549,6 +549,52 @@ static int multiplication(void) {
 		TEST_END;
 #endif
 
+		TEST_BEGIN("toom-3 multiplication is correct") {
+			bn_rand(a, RLC_NEG, RLC_BN_BITS / 2);
+			bn_rand(b, RLC_POS, RLC_BN_BITS / 2);
+			bn_mul(c, a, b);
+			bn_mul_toom3(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+			bn_rand(b, RLC_NEG, RLC_BN_BITS / 5);
+			bn_mul(c, a, b);
+			bn_mul_toom3(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("ntt multiplication is correct") {
+			bn_rand(a, RLC_NEG, RLC_BN_BITS / 2);
+			bn_rand(b, RLC_POS, RLC_BN_BITS / 2);
+			bn_mul(c, a, b);
+			bn_mul_ntt(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+			bn_mul(c, a, a);
+			bn_mul_ntt(d, a, a);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("multiplication with dynamic dispatch is correct") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS / 2);
+			bn_rand(b, RLC_NEG, RLC_BN_BITS / 3);
+			bn_mul(c, a, b);
+			bn_mul_dyn(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+			bn_mul_dyn(d, b, a);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+#if ALLOC == DYNAMIC
+			/* Go beyond the precision to reach the asymptotic algorithms. */
+			bn_rand(a, RLC_POS, 65536);
+			bn_rand(b, RLC_NEG, 40000);
+			bn_mul_comba(c, a, b);
+			bn_mul_dyn(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+			bn_mul_ntt(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+#endif
+		}
+		TEST_END;
+
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -878,12 +924,14 @@ static int division(void) {
 static int reduction(void) {
 	int code = RLC_ERR;
 	bn_t a, b, c, d, e;
+	bn_mon_t m;
 
 	bn_null(a);
 	bn_null(b);
 	bn_null(c);
 	bn_null(d);
 	bn_null(e);
+	bn_mon_null(m);
 
 	TRY {
 		bn_new(a);
@@ -891,6 +939,7 @@ static int reduction(void) {
 		bn_new(c);
 		bn_new(d);
 		bn_new(e);
+		bn_mon_new(m);
 
 #if BN_MOD == BASIC || !defined(STRIP)
 		TEST_BEGIN("basic reduction is correct") {
@@ -970,6 +1019,39 @@ static int reduction(void) {
 		TEST_END;
 #endif
 
+		TEST_BEGIN("montgomery context arithmetic is correct") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS - RLC_DIG / 2);
+			bn_rand(b, RLC_POS, RLC_BN_BITS / 2);
+			if (bn_is_even(b)) {
+				bn_add_dig(b, b, 1);
+			}
+			bn_mon_set(m, b);
+			TEST_ASSERT(bn_mon_is(m, b) == 1, end);
+			bn_mon_conv(c, a, m);
+			bn_mon_back(d, c, m);
+			bn_mod(a, a, b);
+			TEST_ASSERT(bn_cmp(a, d) == RLC_EQ, end);
+			bn_rand(e, RLC_POS, RLC_BN_BITS / 2);
+			bn_mod(e, e, b);
+			bn_mon_conv(d, e, m);
+			bn_mul_mon(c, c, d, m);
+			bn_mon_back(c, c, m);
+			bn_mul(d, a, e);
+			bn_mod(d, d, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+			bn_mon_conv(c, a, m);
+			bn_sqr_mon(c, c, m);
+			bn_mon_back(c, c, m);
+			bn_sqr(d, a);
+			bn_mod(d, d, b);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+			bn_mon_back(c, m->one, m);
+			TEST_ASSERT(bn_cmp_dig(c, 1) == RLC_EQ, end);
+			bn_add_dig(b, b, 2);
+			TEST_ASSERT(bn_mon_is(m, b) == 0, end);
+		}
+		TEST_END;
+
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -981,23 +1063,41 @@ static int reduction(void) {
 	bn_free(c);
 	bn_free(d);
 	bn_free(e);
+	bn_mon_free(m);
 	return code;
 }
 
 static int exponentiation(void) {
 	int code = RLC_ERR;
-	bn_t a, b, c, p;
+	bn_t a, b, c, p, t[RLC_BN_TABLE], x[5], y[5];
+	bn_mon_t m;
 
 	bn_null(a);
 	bn_null(b);
 	bn_null(c);
 	bn_null(p);
+	bn_mon_null(m);
+	for (int j = 0; j < RLC_BN_TABLE; j++) {
+		bn_null(t[j]);
+	}
+	for (int j = 0; j < 5; j++) {
+		bn_null(x[j]);
+		bn_null(y[j]);
+	}
 
 	TRY {
 		bn_new(a);
 		bn_new(b);
 		bn_new(c);
 		bn_new(p);
+		bn_mon_new(m);
+		for (int j = 0; j < RLC_BN_TABLE; j++) {
+			bn_new(t[j]);
+		}
+		for (int j = 0; j < 5; j++) {
+			bn_new(x[j]);
+			bn_new(y[j]);
+		}
 
 #if BN_MOD != PMERS
 		bn_gen_prime(p, RLC_BN_BITS);
@@ -1069,6 +1169,94 @@ static int exponentiation(void) {
 		}
 		TEST_END;
 #endif
+
+		TEST_BEGIN("fixed base modular exponentiation is correct") {
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mod(a, a, p);
+			bn_mxp_pre(t, a, p);
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			bn_mod(b, b, p);
+			bn_mxp(c, a, b, p);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+			bn_mxp_fix(b, (const bn_t *)t, p, p);
+			TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
+			bn_zero(b);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp_dig(b, 1) == RLC_EQ, end);
+			/* Check the fallback for long and negative exponents. */
+			bn_rand(b, RLC_POS, RLC_BN_BITS + BN_DEPTH);
+			bn_mxp(c, a, b, p);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+			bn_rand(b, RLC_NEG, RLC_BN_BITS / 2);
+			bn_mxp(c, a, b, p);
+			bn_mxp_fix(b, (const bn_t *)t, b, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("simultaneous modular exponentiation is correct") {
+			bn_set_dig(c, 1);
+			for (int j = 0; j < 5; j++) {
+				bn_rand(x[j], RLC_POS, RLC_BN_BITS);
+				bn_mod(x[j], x[j], p);
+				bn_rand(y[j], (j == 3 ? RLC_NEG : RLC_POS), RLC_BN_BITS / (j + 1));
+				bn_mxp(a, x[j], y[j], p);
+				bn_mul(c, c, a);
+				bn_mod(c, c, p);
+			}
+			bn_mxp_sim(a, (const bn_t *)x, (const bn_t *)y, 5, p);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			bn_mxp(c, x[0], y[0], p);
+			bn_mxp_sim(a, (const bn_t *)x, (const bn_t *)y, 1, p);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			bn_zero(y[0]);
+			bn_zero(y[1]);
+			bn_mxp_sim(a, (const bn_t *)x, (const bn_t *)y, 2, p);
+			TEST_ASSERT(bn_cmp_dig(a, 1) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("modular exponentiation with a montgomery context is correct") {
+			bn_mon_set(m, p);
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mod(a, a, p);
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			bn_mxp(c, a, b, p);
+			bn_mon_conv(a, a, m);
+			bn_mxp_mon(a, a, b, m);
+			bn_mon_back(a, a, m);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			bn_neg(b, b);
+			bn_mxp(c, a, b, p);
+			bn_mon_conv(a, a, m);
+			bn_mxp_mon(a, a, b, m);
+			bn_mon_back(a, a, m);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			bn_zero(b);
+			bn_mxp_mon(a, a, b, m);
+			bn_mon_back(a, a, m);
+			TEST_ASSERT(bn_cmp_dig(a, 1) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("modular exponentiation with an optional context is correct") {
+			bn_mon_set(m, p);
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			bn_mxp(c, a, b, p);
+			bn_mxp_ctx(a, a, b, p, m);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			/* A context for another modulus must be ignored. */
+			bn_add_dig(c, p, 2);
+			bn_mon_set(m, c);
+			bn_rand(a, RLC_POS, RLC_BN_BITS);
+			bn_mxp(c, a, b, p);
+			bn_mxp_ctx(b, a, b, p, m);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1079,6 +1267,14 @@ static int exponentiation(void) {
 	bn_free(b);
 	bn_free(c);
 	bn_free(p);
+	bn_mon_free(m);
+	for (int j = 0; j < RLC_BN_TABLE; j++) {
+		bn_free(t[j]);
+	}
+	for (int j = 0; j < 5; j++) {
+		bn_free(x[j]);
+		bn_free(y[j]);
+	}
 	return code;
 }
 
@@ -1238,6 +1434,35 @@ static int gcd(void) {
 			bn_add(c, c, e);
 			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ || bn_cmp(a, c) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("constant-time modular inversion is correct") {
+			bn_rand(b, RLC_POS, RLC_BN_BITS);
+			if (bn_is_even(b)) {
+				bn_add_dig(b, b, 1);
+			}
+			do {
+				bn_rand(a, RLC_POS, RLC_BN_BITS);
+				bn_gcd(c, a, b);
+			} while (bn_cmp_dig(c, 1) != RLC_EQ);
+			bn_mod_inv(c, a, b);
+			bn_gcd_ext(d, e, NULL, a, b);
+			if (bn_sign(e) == RLC_NEG) {
+				bn_add(e, e, b);
+			}
+			TEST_ASSERT(bn_cmp(c, e) == RLC_EQ, end);
+			bn_rand(b, RLC_POS, RLC_DIG);
+			if (bn_is_even(b)) {
+				bn_add_dig(b, b, 1);
+			}
+			bn_rand_mod(a, b);
+			bn_gcd(d, a, b);
+			if (bn_cmp_dig(d, 1) == RLC_EQ) {
+				bn_mod_inv(c, a, b);
+				bn_mul(c, c, a);
+				bn_mod(c, c, b);
+				TEST_ASSERT(bn_cmp_dig(c, 1) == RLC_EQ, end);
+			}
+		} TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1635,6 +1860,21 @@ static int prime(void) {
 		} TEST_END;
 #endif
 
+		TEST_ONCE("parallel prime generation is consistent") {
+			bn_gen_prime_par(p, RLC_BN_BITS, 0, 4);
+			TEST_ASSERT(bn_is_prime(p) == 1, end);
+			TEST_ASSERT(bn_bits(p) == RLC_BN_BITS, end);
+			bn_gen_prime_par(p, RLC_BN_BITS / 2, 1, 4);
+			TEST_ASSERT(bn_is_prime(p) == 1, end);
+			TEST_ASSERT(bn_bits(p) == RLC_BN_BITS / 2, end);
+			bn_sub_dig(p, p, 1);
+			bn_hlv(p, p);
+			TEST_ASSERT(bn_is_prime(p) == 1, end);
+			bn_gen_prime_par(p, 18, 1, 2);
+			TEST_ASSERT(bn_is_prime(p) == 1, end);
+			TEST_ASSERT(bn_bits(p) == 18, end);
+		} TEST_END;
+
 		bn_gen_prime(p, RLC_BN_BITS);
 
 		TEST_ONCE("basic prime testing is correct") {
@@ -63,6 +63,81 @@ void *tester(void *ptr) {
 
 #endif
 
+#if (MULTI == PTHREAD || MULTI == OPENMP) && defined(WITH_EP)
+
+void *sharer(void *ptr) {
+	int *code = (int *)ptr;
+	ep_t p;
+	bn_t n;
+
+	core_init();
+	ep_null(p);
+	bn_null(n);
+	ep_new(p);
+	bn_new(n);
+	/* The curve configured by the main thread must be usable here. */
+	*code = RLC_OK;
+	if (ep_param_get() == 0) {
+		*code = RLC_ERR;
+	}
+	ep_curve_get_ord(n);
+	ep_rand(p);
+	if (!ep_is_valid(p)) {
+		*code = RLC_ERR;
+	}
+	ep_mul_gen(p, n);
+	if (!ep_is_infty(p)) {
+		*code = RLC_ERR;
+	}
+	ep_free(p);
+	bn_free(n);
+	core_clean();
+	return NULL;
+}
+
+void *switcher(void *ptr) {
+	int *code = (int *)ptr, id, r;
+	ep_t p;
+	bn_t n;
+
+	core_init();
+	ep_null(p);
+	bn_null(n);
+	ep_new(p);
+	bn_new(n);
+	/* Configure a curve that depends on the thread, copying the default. */
+	if (*code & 1) {
+		r = ep_param_set_any_endom();
+	} else {
+		r = ep_param_set_any_plain();
+	}
+	if (r != RLC_OK) {
+		r = ep_param_set_any();
+	}
+	id = ep_param_get();
+	*code = r;
+	for (int j = 0; j < 4; j++) {
+		if (ep_param_get() != id) {
+			*code = RLC_ERR;
+		}
+		ep_curve_get_ord(n);
+		ep_rand(p);
+		if (!ep_is_valid(p)) {
+			*code = RLC_ERR;
+		}
+		ep_mul_gen(p, n);
+		if (!ep_is_infty(p)) {
+			*code = RLC_ERR;
+		}
+	}
+	ep_free(p);
+	bn_free(n);
+	core_clean();
+	return NULL;
+}
+
+#endif
+
 int main(void) {
 	int code = RLC_ERR;
 
@@ -98,6 +173,143 @@ int main(void) {
 		core_set(old_ctx);
 	} TEST_END;
 
+#ifdef WITH_EP
+	TEST_ONCE("switching the curve context is correct") {
+		crv_t *crv, *old_crv;
+		int id[2], result = RLC_ERR;
+		ep_t p;
+		bn_t n;
+
+		/* Backup the old curve context. */
+		old_crv = core_get_crv();
+		crv = (crv_t *)calloc(2, sizeof(crv_t));
+		TEST_ASSERT(crv != NULL, end);
+
+		ep_null(p);
+		bn_null(n);
+		ep_new(p);
+		bn_new(n);
+
+		/* Configure one curve in each new curve context, falling back to any
+		 * available curve when a kind is not supported at this precision. */
+		core_init_crv(&crv[0]);
+		if (ep_param_set_any_plain() != RLC_OK) {
+			ep_param_set_any();
+		}
+		id[0] = ep_param_get();
+		core_init_crv(&crv[1]);
+		if (ep_param_set_any_endom() != RLC_OK) {
+			ep_param_set_any();
+		}
+		id[1] = ep_param_get();
+		/* Switch back and forth and check that curves are consistent. */
+		if (id[0] != 0 && id[1] != 0) {
+			for (int j = 0; j < 4; j++) {
+				core_set_crv(&crv[j & 1]);
+				TEST_ASSERT(ep_param_get() == id[j & 1], end_crv);
+				ep_curve_get_ord(n);
+				ep_rand(p);
+				TEST_ASSERT(ep_is_valid(p), end_crv);
+				ep_mul_gen(p, n);
+				TEST_ASSERT(ep_is_infty(p), end_crv);
+			}
+		}
+		result = RLC_OK;
+	  end_crv:
+		/* Restore the original curve context before releasing the others. */
+		core_set_crv(old_crv);
+		core_clean_crv(&crv[0]);
+		core_clean_crv(&crv[1]);
+		free(crv);
+		ep_free(p);
+		bn_free(n);
+		if (result != RLC_OK) {
+			goto end;
+		}
+		TEST_ASSERT(core_get_crv() == old_crv, end);
+	} TEST_END;
+
+#if defined(EP_PLAIN) && FP_RDC != QUICK
+	TEST_ONCE("custom curves are copied on write") {
+		ctx_t new_ctx, *old_ctx;
+		crv_t *crv, *old_crv;
+		int result = RLC_ERR;
+		fp_t a, b;
+		ep_t g, p;
+		bn_t r, h, q;
+
+		old_crv = core_get_crv();
+		crv = (crv_t *)calloc(1, sizeof(crv_t));
+		TEST_ASSERT(crv != NULL, end);
+
+		fp_null(a);
+		fp_null(b);
+		ep_null(g);
+		ep_null(p);
+		bn_null(r);
+		bn_null(h);
+		bn_null(q);
+
+		fp_new(a);
+		fp_new(b);
+		ep_new(g);
+		ep_new(p);
+		bn_new(r);
+		bn_new(h);
+		bn_new(q);
+
+		/* Read the parameters of a curve configured somewhere else. */
+		core_init_crv(crv);
+		ep_param_set_any();
+		bn_copy(q, &(crv->prime));
+		fp_copy(a, crv->ep_a);
+		fp_copy(b, crv->ep_b);
+		ep_copy(g, &(crv->ep_g));
+		bn_copy(r, &(crv->ep_r));
+		bn_copy(h, &(crv->ep_h));
+		core_set_crv(old_crv);
+		/* Configure them in the default curve context with no identifiers. */
+		fp_prime_set_dense(q);
+		ep_curve_set_plain(a, b, g, r, h);
+		/* Share the default with another library context and write to it. */
+		old_ctx = core_get();
+		core_set(&new_ctx);
+		core_init();
+		core_set(old_ctx);
+		TEST_ASSERT(core_own_crv() != old_crv, end_own);
+		core_done_crv();
+		TEST_ASSERT(fp_param_get() == 0 && ep_param_get() == 0, end_own);
+		TEST_ASSERT(bn_cmp(&(core_get_crv()->prime), q) == RLC_EQ, end_own);
+		ep_curve_get_ord(q);
+		TEST_ASSERT(bn_cmp(q, r) == RLC_EQ, end_own);
+		ep_rand(p);
+		TEST_ASSERT(ep_is_valid(p), end_own);
+		ep_mul_gen(p, q);
+		TEST_ASSERT(ep_is_infty(p), end_own);
+		result = RLC_OK;
+	  end_own:
+		/* The other library context still uses the default. */
+		core_set(&new_ctx);
+		if (core_get_crv() != old_crv) {
+			result = RLC_ERR;
+		}
+		core_clean();
+		core_set(old_ctx);
+		core_set_crv(old_crv);
+		core_clean_crv(crv);
+		free(crv);
+		fp_free(a);
+		fp_free(b);
+		ep_free(g);
+		ep_free(p);
+		bn_free(r);
+		bn_free(h);
+		bn_free(q);
+		TEST_ASSERT(result == RLC_OK, end);
+	} TEST_END;
+#endif
+#endif
+
 	code = RLC_OK;
 
 #if MULTI == OPENMP
@@ -122,6 +334,47 @@ int main(void) {
 	} TEST_END;
 #endif
 
+#if MULTI == OPENMP && defined(WITH_EP)
+	TEST_ONCE("curve context is shared between threads") {
+		int id;
+		ep_param_set_any();
+		id = ep_param_get();
+		omp_set_num_threads(CORES);
+#pragma omp parallel shared(code)
+		{
+			int result;
+			if (omp_get_thread_num() != 0) {
+				sharer(&result);
+				if (result != RLC_OK) {
+					code = RLC_ERR;
+				}
+			}
+		}
+		TEST_ASSERT(ep_param_get() == id, end);
+		TEST_ASSERT(code == RLC_OK, end);
+	} TEST_END;
+
+	TEST_ONCE("threads can configure their own curves") {
+		int id;
+		ep_param_set_any();
+		id = ep_param_get();
+		omp_set_num_threads(CORES);
+#pragma omp parallel shared(code)
+		{
+			int result = omp_get_thread_num();
+			if (result != 0) {
+				switcher(&result);
+				if (result != RLC_OK) {
+#pragma omp critical
+					code = RLC_ERR;
+				}
+			}
+		}
+		TEST_ASSERT(ep_param_get() == id, end);
+		TEST_ASSERT(code == RLC_OK, end);
+	} TEST_END;
+#endif
+
 #if MULTI == PTHREAD
 	TEST_ONCE("library context is thread-safe") {
 		pthread_t thread[CORES];
@@ -150,6 +403,80 @@ int main(void) {
 	} TEST_END;
 #endif
 
+#if MULTI == PTHREAD && defined(WITH_EP)
+	TEST_ONCE("curve context is shared between threads") {
+		pthread_t thread[CORES];
+		int result[CORES] = { RLC_OK }, id;
+		ep_param_set_any();
+		id = ep_param_get();
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_create(&(thread[i]), NULL, sharer, &(result[i]))) {
+				code = RLC_ERR;
+			}
+		}
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_join(thread[i], NULL)) {
+				code = RLC_ERR;
+			}
+			if (result[i] != RLC_OK) {
+				code = RLC_ERR;
+			}
+		}
+		TEST_ASSERT(ep_param_get() == id, end);
+		TEST_ASSERT(code == RLC_OK, end);
+	} TEST_END;
+
+	TEST_ONCE("curve context can be written while threads start") {
+		pthread_t thread[CORES];
+		int result[CORES] = { RLC_OK }, id;
+		ep_param_set_any();
+		id = fp_param_get();
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_create(&(thread[i]), NULL, sharer, &(result[i]))) {
+				code = RLC_ERR;
+			}
+		}
+		/* Rewrite the field while the threads attach to the default. */
+		for (int j = 0; j < 4; j++) {
+			fp_param_set(id);
+		}
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_join(thread[i], NULL)) {
+				code = RLC_ERR;
+			}
+			if (result[i] != RLC_OK) {
+				code = RLC_ERR;
+			}
+		}
+		TEST_ASSERT(fp_param_get() == id, end);
+		TEST_ASSERT(code == RLC_OK, end);
+		core_set_crv(NULL);
+	} TEST_END;
+
+	TEST_ONCE("threads can configure their own curves") {
+		pthread_t thread[CORES];
+		int result[CORES], id;
+		ep_param_set_any();
+		id = ep_param_get();
+		for (int i = 0; i < CORES; i++) {
+			result[i] = i;
+			if (pthread_create(&(thread[i]), NULL, switcher, &(result[i]))) {
+				code = RLC_ERR;
+			}
+		}
+		for (int i = 0; i < CORES; i++) {
+			if (pthread_join(thread[i], NULL)) {
+				code = RLC_ERR;
+			}
+			if (result[i] != RLC_OK) {
+				code = RLC_ERR;
+			}
+		}
+		TEST_ASSERT(ep_param_get() == id, end);
+		TEST_ASSERT(code == RLC_OK, end);
+	} TEST_END;
+#endif
+
 	util_banner("All tests have passed.\n", 0);
 	  end:
 	core_clean();
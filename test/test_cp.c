@@ -139,6 +139,69 @@ static int rsa(void) {
 					end);
 			TEST_ASSERT(cp_rsa_ver(out, ol, h, MD_LEN, 1, pub) == 1, end);
 		} TEST_END;
+
+		for (int k = 3; k <= RLC_RSA_PRIMES; k++) {
+			result = cp_rsa_gen_multi(pub, prv, RLC_BN_BITS, k);
+
+			TEST_BEGIN("multi-prime rsa encryption/decryption is correct") {
+				TEST_ASSERT(result == RLC_OK, end);
+				il = 10;
+				ol = RLC_BN_BITS / 8 + 1;
+				rand_bytes(in, il);
+				TEST_ASSERT(cp_rsa_enc(out, &ol, in, il, pub) == RLC_OK, end);
+				TEST_ASSERT(cp_rsa_dec_quick(out, &ol, out, ol, prv) == RLC_OK,
+						end);
+				TEST_ASSERT(memcmp(in, out, ol) == 0, end);
+			} TEST_END;
+
+			TEST_BEGIN("multi-prime rsa signature/verification is correct") {
+				TEST_ASSERT(result == RLC_OK, end);
+				il = 10;
+				ol = RLC_BN_BITS / 8 + 1;
+				rand_bytes(in, il);
+				TEST_ASSERT(cp_rsa_sig_quick(out, &ol, in, il, 0, prv) == RLC_OK,
+						end);
+				TEST_ASSERT(cp_rsa_ver(out, ol, in, il, 0, pub) == 1, end);
+			} TEST_END;
+		}
+
+		TEST_BEGIN("multi-prime rsa rejects primes that are too small") {
+			TEST_ASSERT(cp_rsa_gen_multi(pub, prv, 2 * RLC_RSA_PRIME_MIN - 2,
+					2) == RLC_ERR, end);
+			TEST_ASSERT(cp_rsa_gen_multi(pub, prv, RLC_BN_BITS,
+					RLC_RSA_PRIMES + 1) == RLC_ERR, end);
+		} TEST_END;
+
+		TEST_BEGIN("batch rsa decryption and signature are correct") {
+			uint8_t bin[4][10], bout[4][RLC_BN_BITS / 8 + 1], *pi[4], *po[4];
+			int bil[4], bol[4];
+			for (int k = 2; k <= RLC_RSA_PRIMES; k += 2) {
+				TEST_ASSERT(cp_rsa_gen_multi(pub, prv, RLC_BN_BITS, k) == RLC_OK,
+						end);
+				for (int j = 0; j < 4; j++) {
+					pi[j] = bin[j];
+					po[j] = bout[j];
+					bil[j] = 10;
+					bol[j] = RLC_BN_BITS / 8 + 1;
+					rand_bytes(bin[j], bil[j]);
+					TEST_ASSERT(cp_rsa_enc(bout[j], &bol[j], bin[j], bil[j],
+							pub) == RLC_OK, end);
+				}
+				TEST_ASSERT(cp_rsa_dec_batch(po, bol, po, bol, 4, prv) == RLC_OK,
+						end);
+				for (int j = 0; j < 4; j++) {
+					TEST_ASSERT(bol[j] == bil[j], end);
+					TEST_ASSERT(memcmp(bin[j], bout[j], bol[j]) == 0, end);
+					bol[j] = RLC_BN_BITS / 8 + 1;
+				}
+				TEST_ASSERT(cp_rsa_sig_batch(po, bol, pi, bil, 0, 4, prv) ==
+						RLC_OK, end);
+				for (int j = 0; j < 4; j++) {
+					TEST_ASSERT(cp_rsa_ver(bout[j], bol[j], bin[j], bil[j], 0,
+							pub) == 1, end);
+				}
+			}
+		} TEST_END;
 #endif
 	} CATCH_ANY {
 		ERROR(end);
@@ -241,6 +304,21 @@ static int benaloh(void) {
 			TEST_ASSERT(cp_bdpe_dec(&out, buf, len, prv) == RLC_OK, end);
 			TEST_ASSERT(in == out, end);
 		} TEST_END;
+
+		TEST_BEGIN("benaloh decryption with composite block is correct") {
+			/* Use block = 3^3 * 5 * 7 to exercise prime powers. */
+			TEST_ASSERT(cp_bdpe_gen(pub, prv, 945, RLC_BN_BITS) == RLC_OK, end);
+			len = RLC_BN_BITS / 8 + 1;
+			rand_bytes(buf, 2);
+			in = (buf[0] | (buf[1] << 8)) % 945;
+			TEST_ASSERT(cp_bdpe_enc(buf, &len, in, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bdpe_dec(&out, buf, len, prv) == RLC_OK, end);
+			TEST_ASSERT(in == out, end);
+			TEST_ASSERT(cp_bdpe_enc(buf, &len, 944, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bdpe_dec(&out, buf, len, prv) == RLC_OK, end);
+			TEST_ASSERT(out == 944, end);
+			TEST_ASSERT(cp_bdpe_gen(pub, prv, 946, RLC_BN_BITS) == RLC_ERR, end);
+		} TEST_END;
 	} CATCH_ANY {
 		ERROR(end);
 	}
@@ -256,7 +334,8 @@ static int benaloh(void) {
 
 static int paillier(void) {
 	int code = RLC_ERR;
-	bn_t a, b, c, d, n, l, s;
+	bn_t a, b, c, d, n, l, s, e[2], f[2], g[2];
+	phpe_t pub, prv;
 	uint8_t in[RLC_BN_BITS / 8 + 1], out[RLC_BN_BITS / 8 + 1];
 	int in_len, out_len;
 	int result;
@@ -268,6 +347,8 @@ static int paillier(void) {
 	bn_null(n);
 	bn_null(l);
 	bn_null(s);
+	phpe_null(pub);
+	phpe_null(prv);
 
 	TRY {
 		bn_new(a);
@@ -277,6 +358,16 @@ static int paillier(void) {
 		bn_new(n);
 		bn_new(l);
 		bn_new(s);
+		phpe_new(pub);
+		phpe_new(prv);
+		for (int j = 0; j < 2; j++) {
+			bn_null(e[j]);
+			bn_null(f[j]);
+			bn_null(g[j]);
+			bn_new(e[j]);
+			bn_new(f[j]);
+			bn_new(g[j]);
+		}
 
 		result = cp_phpe_gen(n, l, RLC_BN_BITS / 2);
 
@@ -323,6 +414,83 @@ static int paillier(void) {
 			TEST_ASSERT(memcmp(in, out, in_len) == 0, end);
 		}
 		TEST_END;
+
+		result = cp_phpe_gen_key(pub, prv, RLC_BN_BITS / 2);
+
+		TEST_BEGIN("paillier decryption with the crt is correct") {
+			TEST_ASSERT(result == RLC_OK, end);
+			bn_rand_mod(a, pub->n);
+			TEST_ASSERT(cp_phpe_enc_key(c, a, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_dec_key(b, c, prv) == RLC_OK, end);
+			TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
+			TEST_ASSERT(cp_phpe_enc_key(c, pub->n, pub) == RLC_ERR, end);
+			/* Check that ciphertexts are compatible with the old interface. */
+			bn_sub_dig(b, prv->p, 1);
+			bn_sub_dig(d, prv->q, 1);
+			bn_mul(l, b, d);
+			in_len = bn_size_bin(pub->n);
+			out_len = 2 * in_len;
+			bn_write_bin(out, out_len, c);
+			TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, pub->n, l) ==
+					RLC_OK, end);
+			bn_read_bin(b, out, in_len);
+			TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("paillier encryption with precomputed randomizers is correct") {
+			TEST_ASSERT(cp_phpe_pre(pub, 2) == RLC_OK, end);
+			TEST_ASSERT(pub->pool_len == 2, end);
+			bn_rand_mod(a, pub->n);
+			TEST_ASSERT(cp_phpe_enc_key(c, a, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_enc_key(d, a, pub) == RLC_OK, end);
+			TEST_ASSERT(pub->pool_len == 0, end);
+			TEST_ASSERT(bn_cmp(c, d) != RLC_EQ, end);
+			TEST_ASSERT(cp_phpe_dec_key(b, c, prv) == RLC_OK, end);
+			TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
+			TEST_ASSERT(cp_phpe_dec_key(b, d, prv) == RLC_OK, end);
+			TEST_ASSERT(bn_cmp(a, b) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("paillier batch homomorphic operations are correct") {
+			for (int j = 0; j < 2; j++) {
+				bn_rand_mod(a, pub->n);
+				bn_rand_mod(b, pub->n);
+				TEST_ASSERT(cp_phpe_enc_key(e[j], a, pub) == RLC_OK, end);
+				TEST_ASSERT(cp_phpe_enc_key(f[j], b, pub) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_phpe_add_batch(g, e, f, 2, pub) == RLC_OK, end);
+			for (int j = 0; j < 2; j++) {
+				TEST_ASSERT(cp_phpe_add(d, e[j], f[j], pub) == RLC_OK, end);
+				TEST_ASSERT(bn_cmp(d, g[j]) == RLC_EQ, end);
+				TEST_ASSERT(cp_phpe_dec_key(a, e[j], prv) == RLC_OK, end);
+				TEST_ASSERT(cp_phpe_dec_key(b, f[j], prv) == RLC_OK, end);
+				TEST_ASSERT(cp_phpe_dec_key(c, g[j], prv) == RLC_OK, end);
+				bn_add(a, a, b);
+				bn_mod(a, a, pub->n);
+				TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+				bn_rand_mod(f[j], pub->n);
+			}
+			TEST_ASSERT(cp_phpe_mul_batch(g, e, f, 2, pub) == RLC_OK, end);
+			for (int j = 0; j < 2; j++) {
+				TEST_ASSERT(cp_phpe_mul(d, e[j], f[j], pub) == RLC_OK, end);
+				TEST_ASSERT(bn_cmp(d, g[j]) == RLC_EQ, end);
+				TEST_ASSERT(cp_phpe_dec_key(a, e[j], prv) == RLC_OK, end);
+				TEST_ASSERT(cp_phpe_dec_key(c, g[j], prv) == RLC_OK, end);
+				bn_mul(a, a, f[j]);
+				bn_mod(a, a, pub->n);
+				TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+			}
+			TEST_ASSERT(cp_phpe_add(d, e[0], e[1], pub) == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_dec_key(a, e[0], prv) == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_dec_key(b, e[1], prv) == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_dec_key(c, d, prv) == RLC_OK, end);
+			bn_add(a, a, b);
+			bn_mod(a, a, pub->n);
+			TEST_ASSERT(bn_cmp(a, c) == RLC_EQ, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -337,6 +505,13 @@ static int paillier(void) {
 	bn_free(n);
 	bn_free(l);
 	bn_free(s);
+	phpe_free(pub);
+	phpe_free(prv);
+	for (int j = 0; j < 2; j++) {
+		bn_free(e[j]);
+		bn_free(f[j]);
+		bn_free(g[j]);
+	}
 	return code;
 }
 
@@ -661,11 +836,68 @@ static int ecies(void) {
 	return code;
 }
 
+#if EC_CUR == PRIME
+
+/**
+ * Recovers the parity of the y-coordinate of the commitment in an ECDSA
+ * signature, as a signer with access to the nonce would do.
+ */
+static int ecdsa_bit(bn_t r, bn_t s, uint8_t *msg, int len, ec_t q) {
+	bn_t n, e, k, u;
+	ec_t p;
+	uint8_t h[MD_LEN];
+	int bit;
+
+	bn_null(n);
+	bn_null(e);
+	bn_null(k);
+	bn_null(u);
+	ec_null(p);
+
+	bn_new(n);
+	bn_new(e);
+	bn_new(k);
+	bn_new(u);
+	ec_new(p);
+
+	ec_curve_get_ord(n);
+	bn_gcd_ext(e, k, NULL, s, n);
+	if (bn_sign(k) == RLC_NEG) {
+		bn_add(k, k, n);
+	}
+	md_map(h, msg, len);
+	len = MD_LEN;
+	if (8 * len > bn_bits(n)) {
+		len = RLC_CEIL(bn_bits(n), 8);
+		bn_read_bin(e, h, len);
+		bn_rsh(e, e, 8 * len - bn_bits(n));
+	} else {
+		bn_read_bin(e, h, len);
+	}
+	bn_mul(e, e, k);
+	bn_mod(e, e, n);
+	bn_mul(u, r, k);
+	bn_mod(u, u, n);
+	ec_mul_sim_gen(p, e, q, u);
+	ec_norm(p, p);
+	bit = fp_get_bit(p->y, 0);
+
+	bn_free(n);
+	bn_free(e);
+	bn_free(k);
+	bn_free(u);
+	ec_free(p);
+	return bit;
+}
+
+#endif
+
 static int ecdsa(void) {
-	int code = RLC_ERR;
-	bn_t d, r, s;
-	ec_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 }, h[MD_LEN];
+	int j, code = RLC_ERR;
+	bn_t d, r, s, t[4], u[4];
+	ec_t q, p[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, h[MD_LEN], n[4][5], *_n[4];
+	int l[4], b[4], v[4] = { 0 };
 
 	bn_null(d);
 	bn_null(r);
@@ -677,6 +909,14 @@ static int ecdsa(void) {
 		bn_new(r);
 		bn_new(s);
 		ec_new(q);
+		for (j = 0; j < 4; j++) {
+			bn_null(t[j]);
+			bn_null(u[j]);
+			ec_null(p[j]);
+			bn_new(t[j]);
+			bn_new(u[j]);
+			ec_new(p[j]);
+		}
 
 		TEST_BEGIN("ecdsa signature is correct") {
 			TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
@@ -687,6 +927,36 @@ static int ecdsa(void) {
 			TEST_ASSERT(cp_ecdsa_ver(r, s, h, MD_LEN, 1, q) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("ecdsa batch verification is correct") {
+			for (j = 0; j < 4; j++) {
+				memcpy(n[j], m, sizeof(m));
+				n[j][0] = j;
+				_n[j] = n[j];
+				l[j] = sizeof(m);
+				TEST_ASSERT(cp_ecdsa_gen(d, p[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_ecdsa_sig(t[j], u[j], n[j], l[j], 0,
+						d) == RLC_OK, end);
+#if EC_CUR == PRIME
+				v[j] = ecdsa_bit(t[j], u[j], n[j], l[j], p[j]);
+#endif
+			}
+			TEST_ASSERT(cp_ecdsa_ver_batch(b, t, u, v, _n, l, 0, p, 4) == 1,
+					end);
+			TEST_ASSERT(b[0] && b[1] && b[2] && b[3], end);
+			TEST_ASSERT(cp_ecdsa_ver_batch(b, t, u, NULL, _n, l, 0, p, 4) == 1,
+					end);
+			TEST_ASSERT(b[0] && b[1] && b[2] && b[3], end);
+			v[1] ^= 1;
+			TEST_ASSERT(cp_ecdsa_ver_batch(b, t, u, v, _n, l, 0, p, 4) == 1,
+					end);
+			TEST_ASSERT(b[0] && b[1] && b[2] && b[3], end);
+			bn_copy(u[2], u[1]);
+			TEST_ASSERT(cp_ecdsa_ver_batch(b, t, u, v, _n, l, 0, p, 4) == 0,
+					end);
+			TEST_ASSERT(b[0] && b[1] && !b[2] && b[3], end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -698,14 +968,20 @@ static int ecdsa(void) {
 	bn_free(r);
 	bn_free(s);
 	ec_free(q);
+	for (j = 0; j < 4; j++) {
+		bn_free(t[j]);
+		bn_free(u[j]);
+		ec_free(p[j]);
+	}
 	return code;
 }
 
 static int ecss(void) {
-	int code = RLC_ERR;
-	bn_t d, r;
-	ec_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 };
+	int j, code = RLC_ERR;
+	bn_t d, r, t[4], u[4], w[4];
+	ec_t q, p[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, n[4][5], *_n[4];
+	int l[4], b[4], v[4] = { 0 };
 
 	bn_null(d);
 	bn_null(r);
@@ -715,6 +991,16 @@ static int ecss(void) {
 		bn_new(d);
 		bn_new(r);
 		ec_new(q);
+		for (j = 0; j < 4; j++) {
+			bn_null(t[j]);
+			bn_null(u[j]);
+			bn_null(w[j]);
+			ec_null(p[j]);
+			bn_new(t[j]);
+			bn_new(u[j]);
+			bn_new(w[j]);
+			ec_new(p[j]);
+		}
 
 		TEST_BEGIN("ecss signature is correct") {
 			TEST_ASSERT(cp_ecss_gen(d, q) == RLC_OK, end);
@@ -722,6 +1008,41 @@ static int ecss(void) {
 			TEST_ASSERT(cp_ecss_ver(r, d, m, sizeof(m), q) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("ecss batch verification is correct") {
+			ec_curve_get_ord(r);
+			for (j = 0; j < 4; j++) {
+				memcpy(n[j], m, sizeof(m));
+				n[j][0] = j;
+				_n[j] = n[j];
+				l[j] = sizeof(m);
+				TEST_ASSERT(cp_ecss_gen(d, p[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_ecss_sig(t[j], u[j], n[j], l[j], d) == RLC_OK,
+						end);
+				ec_mul_sim_gen(q, u[j], p[j], t[j]);
+				ec_norm(q, q);
+				ec_get_x(w[j], q);
+				bn_mod(w[j], w[j], r);
+#if EC_CUR == PRIME
+				v[j] = fp_get_bit(q->y, 0);
+#endif
+			}
+			TEST_ASSERT(cp_ecss_ver_batch(b, t, u, w, v, _n, l, p, 4) == 1,
+					end);
+			TEST_ASSERT(b[0] && b[1] && b[2] && b[3], end);
+			TEST_ASSERT(cp_ecss_ver_batch(b, t, u, NULL, NULL, _n, l, p,
+					4) == 1, end);
+			TEST_ASSERT(b[0] && b[1] && b[2] && b[3], end);
+			v[1] ^= 1;
+			TEST_ASSERT(cp_ecss_ver_batch(b, t, u, w, v, _n, l, p, 4) == 1,
+					end);
+			TEST_ASSERT(b[0] && b[1] && b[2] && b[3], end);
+			bn_copy(u[2], u[1]);
+			TEST_ASSERT(cp_ecss_ver_batch(b, t, u, w, v, _n, l, p, 4) == 0,
+					end);
+			TEST_ASSERT(b[0] && b[1] && !b[2] && b[3], end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -732,6 +1053,12 @@ static int ecss(void) {
 	bn_free(d);
 	bn_free(r);
 	ec_free(q);
+	for (j = 0; j < 4; j++) {
+		bn_free(t[j]);
+		bn_free(u[j]);
+		bn_free(w[j]);
+		ec_free(p[j]);
+	}
 	return code;
 }
 
@@ -881,8 +1208,12 @@ static int bgn(void) {
 	g1_t c[2], d[2];
 	g2_t e[2], f[2];
 	gt_t g[4];
+	g1_t h[4][2];
 	bgn_t pub, prv;
-	dig_t in, out, t;
+	bgn_tab_t tab, tab2;
+	dig_t in, out, t, v[4], w[4];
+	uint8_t *bin = NULL;
+	int len;
 
 	g1_null(c[0]);
 	g1_null(c[1]);
@@ -894,6 +1225,8 @@ static int bgn(void) {
 	g2_null(f[1]);
 	bgn_null(pub);
 	bgn_null(prv);
+	bgn_tab_null(tab);
+	bgn_tab_null(tab2);
 
 	TRY {
 		g1_new(c[0]);
@@ -906,9 +1239,15 @@ static int bgn(void) {
 		g2_new(f[1]);
 		bgn_new(pub);
 		bgn_new(prv);
+		bgn_tab_new(tab);
+		bgn_tab_new(tab2);
 		for (int i = 0; i < 4; i++) {
 			gt_null(g[i]);
 			gt_new(g[i]);
+			g1_null(h[i][0]);
+			g1_null(h[i][1]);
+			g1_new(h[i][0]);
+			g1_new(h[i][1]);
 		}
 
 		result = cp_bgn_gen(pub, prv);
@@ -964,6 +1303,61 @@ static int bgn(void) {
 			TEST_ASSERT(in + in == t, end);
 		} TEST_END;
 
+		TEST_BEGIN("boneh-go-nissim table decryption is correct") {
+			rand_bytes((unsigned char *)&in, sizeof(dig_t));
+			in = in % 1000;
+			TEST_ASSERT(cp_bgn_tab_gen(tab, 1, 1000, 0, prv) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_enc1(c, in, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec1_tab(&out, c, prv, tab) == RLC_OK, end);
+			TEST_ASSERT(in == out, end);
+			TEST_ASSERT(cp_bgn_dec2_tab(&out, e, prv, tab) == RLC_ERR, end);
+			TEST_ASSERT(cp_bgn_enc1(c, 0, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec1_tab(&out, c, prv, tab) == RLC_OK, end);
+			TEST_ASSERT(out == 0, end);
+			TEST_ASSERT(cp_bgn_enc1(c, 2000, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec1_tab(&out, c, prv, tab) == RLC_ERR, end);
+			TEST_ASSERT(cp_bgn_tab_gen(tab, 2, 1000, 10, prv) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_enc2(e, in, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec2_tab(&out, e, prv, tab) == RLC_OK, end);
+			TEST_ASSERT(in == out, end);
+			TEST_ASSERT(cp_bgn_tab_gen(tab, 3, 1000, 0, prv) == RLC_OK, end);
+			in = in % 31;
+			out = in % 29;
+			TEST_ASSERT(cp_bgn_enc1(c, in, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_enc2(e, out, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_mul(g, c, e) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec_tab(&t, g, prv, tab) == RLC_OK, end);
+			TEST_ASSERT(in * out == t, end);
+		} TEST_END;
+
+		TEST_BEGIN("boneh-go-nissim batch table decryption is correct") {
+			TEST_ASSERT(cp_bgn_tab_gen(tab, 1, 1000, 0, prv) == RLC_OK, end);
+			rand_bytes((unsigned char *)v, sizeof(v));
+			v[0] = 0;
+			v[1] = 999;
+			v[2] %= 1000;
+			v[3] %= 1000;
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_bgn_enc1(h[j], v[j], pub) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bgn_dec1_batch(w, h, 4, prv, tab) == RLC_OK, end);
+			TEST_ASSERT(memcmp(v, w, sizeof(v)) == 0, end);
+		} TEST_END;
+
+		TEST_BEGIN("boneh-go-nissim table serialization is correct") {
+			TEST_ASSERT(cp_bgn_tab_gen(tab, 1, 1000, (dig_t)1 << 27,
+					prv) == RLC_ERR, end);
+			len = cp_bgn_tab_size(tab);
+			bin = (uint8_t *)malloc(len);
+			TEST_ASSERT(bin != NULL, end);
+			TEST_ASSERT(cp_bgn_tab_write(bin, len - 1, tab) == RLC_ERR, end);
+			TEST_ASSERT(cp_bgn_tab_write(bin, len, tab) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_tab_read(tab2, bin, len - 1) == RLC_ERR, end);
+			TEST_ASSERT(cp_bgn_tab_read(tab2, bin, len) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec1_batch(w, h, 4, prv, tab2) == RLC_OK, end);
+			TEST_ASSERT(memcmp(v, w, sizeof(v)) == 0, end);
+		} TEST_END;
+
 	} CATCH_ANY {
 		ERROR(end);
 	}
@@ -980,18 +1374,24 @@ static int bgn(void) {
 	g2_free(f[1]);
 	bgn_free(pub);
 	bgn_free(prv);
+	bgn_tab_free(tab);
+	bgn_tab_free(tab2);
+	free(bin);
 	for (int i = 0; i < 4; i++) {
 		gt_free(g[i]);
+		g1_free(h[i][0]);
+		g1_free(h[i][1]);
 	}
 	return code;
 }
 
 static int bls(void) {
-	int code = RLC_ERR;
+	int j, code = RLC_ERR;
 	bn_t d;
-	g1_t s;
-	g2_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 };
+	g1_t s, t[4];
+	g2_t q, p[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, n[4][5], *_n[4];
+	int l[4], b[4];
 
 	bn_null(d);
 	g1_null(s);
@@ -1001,6 +1401,12 @@ static int bls(void) {
 		bn_new(d);
 		g1_new(s);
 		g2_new(q);
+		for (j = 0; j < 4; j++) {
+			g1_null(t[j]);
+			g2_null(p[j]);
+			g1_new(t[j]);
+			g2_new(p[j]);
+		}
 
 		TEST_BEGIN("boneh-lynn-schacham short signature is correct") {
 			TEST_ASSERT(cp_bls_gen(d, q) == RLC_OK, end);
@@ -1008,6 +1414,36 @@ static int bls(void) {
 			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("boneh-lynn-schacham aggregate signature is correct") {
+			for (j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_bls_gen(d, p[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(t[j], m, sizeof(m), d) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bls_agg_sig(s, t, 4) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_agg_key(q, p, 4) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 1, end);
+			TEST_ASSERT(cp_bls_agg_sig(s, t, 3) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 0, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("boneh-lynn-schacham batch verification is correct") {
+			for (j = 0; j < 4; j++) {
+				memcpy(n[j], m, sizeof(m));
+				n[j][0] = j;
+				_n[j] = n[j];
+				l[j] = sizeof(m);
+				TEST_ASSERT(cp_bls_gen(d, p[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(t[j], n[j], l[j], d) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bls_ver_batch(b, t, _n, l, p, 4) == 1, end);
+			TEST_ASSERT(b[0] && b[1] && b[2] && b[3], end);
+			g1_copy(t[2], t[1]);
+			TEST_ASSERT(cp_bls_ver_batch(b, t, _n, l, p, 4) == 0, end);
+			TEST_ASSERT(b[0] && b[1] && !b[2] && b[3], end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1018,6 +1454,10 @@ static int bls(void) {
 	bn_free(d);
 	g1_free(s);
 	g2_free(q);
+	for (j = 0; j < 4; j++) {
+		g1_free(t[j]);
+		g2_free(p[j]);
+	}
 	return code;
 }
 
@@ -807,8 +807,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = RLC_ERR;
-	bn_t n, k, l;
-	ep_t p, q, r;
+	bn_t n, k, l, v[16];
+	ep_t p, q, r, t[16];
 
 	bn_null(n);
 	bn_null(k);
@@ -816,6 +816,10 @@ static int simultaneous(void) {
 	ep_null(p);
 	ep_null(q);
 	ep_null(r);
+	for (int j = 0; j < 16; j++) {
+		bn_null(v[j]);
+		ep_null(t[j]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -824,6 +828,10 @@ static int simultaneous(void) {
 		ep_new(p);
 		ep_new(q);
 		ep_new(r);
+		for (int j = 0; j < 16; j++) {
+			bn_new(v[j]);
+			ep_new(t[j]);
+		}
 
 		ep_curve_get_gen(p);
 		ep_curve_get_ord(n);
@@ -1024,6 +1032,39 @@ static int simultaneous(void) {
 			ep_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			ep_set_infty(q);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(v[j], n);
+				if (j & 1) {
+					bn_neg(v[j], v[j]);
+				}
+				ep_rand(t[j]);
+				ep_mul(p, t[j], v[j]);
+				ep_add(q, q, p);
+			}
+			ep_norm(q, q);
+			ep_mul_sim_lot(r, (const ep_t *)t, (const bn_t *)v, 16);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			ep_mul(p, t[0], v[0]);
+			ep_sub(q, q, p);
+			ep_set_infty(t[0]);
+			ep_mul(p, t[1], v[1]);
+			ep_sub(q, q, p);
+			bn_zero(v[1]);
+			ep_norm(q, q);
+			ep_mul_sim_lot(r, (const ep_t *)t, (const bn_t *)v, 16);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			ep_set_infty(q);
+			for (int j = 0; j < 5; j++) {
+				ep_mul(p, t[j], v[j]);
+				ep_add(q, q, p);
+			}
+			ep_norm(q, q);
+			ep_mul_sim_lot(r, (const ep_t *)t, (const bn_t *)v, 5);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1037,21 +1078,28 @@ static int simultaneous(void) {
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
+	for (int j = 0; j < 16; j++) {
+		bn_free(v[j]);
+		ep_free(t[j]);
+	}
 	return code;
 }
 
 static int compression(void) {
 	int code = RLC_ERR;
 	ep_t a, b, c;
+	bn_t x;
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
+	bn_null(x);
 
 	TRY {
 		ep_new(a);
 		ep_new(b);
 		ep_new(c);
+		bn_new(x);
 
 		TEST_BEGIN("point compression is correct") {
 			ep_rand(a);
@@ -1060,6 +1108,14 @@ static int compression(void) {
 			TEST_ASSERT(ep_cmp(a, c) == RLC_EQ, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("point decompression from coordinates is correct") {
+			ep_rand(a);
+			fp_prime_back(x, a->x);
+			TEST_ASSERT(ep_upk_x(c, x, fp_get_bit(a->y, 0)) == 1, end);
+			TEST_ASSERT(ep_cmp(a, c) == RLC_EQ, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1069,20 +1125,23 @@ static int compression(void) {
 	ep_free(a);
 	ep_free(b);
 	ep_free(c);
+	bn_free(x);
 	return code;
 }
 
 static int hashing(void) {
 	int code = RLC_ERR;
-	ep_t a;
+	ep_t a, b;
 	bn_t n;
 	uint8_t msg[5];
 
 	ep_null(a);
+	ep_null(b);
 	bn_null(n);
 
 	TRY {
 		ep_new(a);
+		ep_new(b);
 		bn_new(n);
 
 		ep_curve_get_ord(n);
@@ -1094,6 +1153,48 @@ static int hashing(void) {
 			TEST_ASSERT(ep_is_infty(a) == 1, end);
 		}
 		TEST_END;
+
+#if EP_MAP == BASIC || !defined(STRIP)
+		TEST_BEGIN("point hashing with try-and-increment is correct") {
+			rand_bytes(msg, sizeof(msg));
+			ep_map_basic(a, msg, sizeof(msg));
+			TEST_ASSERT(ep_is_valid(a) == 1, end);
+			ep_mul(a, a, n);
+			TEST_ASSERT(ep_is_infty(a) == 1, end);
+		}
+		TEST_END;
+#endif
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+		TEST_BEGIN("point hashing with shallue-van de woestijne map is correct") {
+			rand_bytes(msg, sizeof(msg));
+			ep_map_svdwm(a, msg, sizeof(msg));
+			TEST_ASSERT(ep_is_valid(a) == 1, end);
+			ep_map_svdwm(b, msg, sizeof(msg));
+			TEST_ASSERT(ep_cmp(a, b) == RLC_EQ, end);
+			ep_map_dst(b, msg, sizeof(msg), (const uint8_t *)"RELIC", 5);
+			TEST_ASSERT(ep_is_valid(b) == 1, end);
+			TEST_ASSERT(ep_cmp(a, b) != RLC_EQ, end);
+			ep_mul(a, a, n);
+			TEST_ASSERT(ep_is_infty(a) == 1, end);
+#if defined(EP_PLAIN) && FP_PRIME == 256
+			if (ep_param_get() == NIST_P256) {
+				/* Computed with the reference code of RFC 9380. */
+				const char *x = "16DBBC295C19B1F9BB4871BA5B0035A3"
+						"11A7DEEBB3FF610C9036D84791852935";
+				const char *y = "564191587ABBE77C8DA1058C94C5E4D4"
+						"F54EB4599EC66BA86A5B7FC064B78582";
+				ep_map_svdwm(a, (const uint8_t *)"abc", 3);
+				fp_read_str(b->x, x, strlen(x), 16);
+				fp_read_str(b->y, y, strlen(y), 16);
+				fp_set_dig(b->z, 1);
+				b->norm = 1;
+				TEST_ASSERT(ep_cmp(a, b) == RLC_EQ, end);
+			}
+#endif
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1101,6 +1202,7 @@ static int hashing(void) {
 	code = RLC_OK;
   end:
 	ep_free(a);
+	ep_free(b);
 	bn_free(n);
 	return code;
 }
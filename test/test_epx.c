@@ -821,8 +821,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = RLC_ERR;
-	bn_t n, k, l;
-	ep2_t p, q, r;
+	bn_t n, k, l, v[16];
+	ep2_t p, q, r, t[16];
 
 	bn_null(n);
 	bn_null(k);
@@ -830,6 +830,10 @@ static int simultaneous(void) {
 	ep2_null(p);
 	ep2_null(q);
 	ep2_null(r);
+	for (int j = 0; j < 16; j++) {
+		bn_null(v[j]);
+		ep2_null(t[j]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -838,6 +842,10 @@ static int simultaneous(void) {
 		ep2_new(p);
 		ep2_new(q);
 		ep2_new(r);
+		for (int j = 0; j < 16; j++) {
+			bn_new(v[j]);
+			ep2_new(t[j]);
+		}
 
 		ep2_curve_get_gen(p);
 		ep2_curve_get_ord(n);
@@ -1038,6 +1046,39 @@ static int simultaneous(void) {
 			ep2_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			ep2_set_infty(q);
+			for (int j = 0; j < 16; j++) {
+				bn_rand_mod(v[j], n);
+				if (j & 1) {
+					bn_neg(v[j], v[j]);
+				}
+				ep2_rand(t[j]);
+				ep2_mul(p, t[j], v[j]);
+				ep2_add(q, q, p);
+			}
+			ep2_norm(q, q);
+			ep2_mul_sim_lot(r, t, (const bn_t *)v, 16);
+			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+			ep2_mul(p, t[0], v[0]);
+			ep2_sub(q, q, p);
+			ep2_set_infty(t[0]);
+			ep2_mul(p, t[1], v[1]);
+			ep2_sub(q, q, p);
+			bn_zero(v[1]);
+			ep2_norm(q, q);
+			ep2_mul_sim_lot(r, t, (const bn_t *)v, 16);
+			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+			ep2_set_infty(q);
+			for (int j = 0; j < 5; j++) {
+				ep2_mul(p, t[j], v[j]);
+				ep2_add(q, q, p);
+			}
+			ep2_norm(q, q);
+			ep2_mul_sim_lot(r, t, (const bn_t *)v, 5);
+			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1051,6 +1092,10 @@ static int simultaneous(void) {
 	ep2_free(p);
 	ep2_free(q);
 	ep2_free(r);
+	for (int j = 0; j < 16; j++) {
+		bn_free(v[j]);
+		ep2_free(t[j]);
+	}
 	return code;
 }
 
@@ -1089,15 +1134,17 @@ static int compression(void) {
 static int hashing(void) {
 	int code = RLC_ERR;
 	bn_t n;
-	ep2_t p;
+	ep2_t p, q;
 	uint8_t msg[5];
 
 	bn_null(n);
 	ep2_null(p);
+	ep2_null(q);
 
 	TRY {
 		bn_new(n);
 		ep2_new(p);
+		ep2_new(q);
 
 		ep2_curve_get_ord(n);
 
@@ -1108,6 +1155,33 @@ static int hashing(void) {
 			TEST_ASSERT(ep2_is_infty(p) == 1, end);
 		}
 		TEST_END;
+
+#if EP_MAP == BASIC || !defined(STRIP)
+		TEST_BEGIN("point hashing with try-and-increment is correct") {
+			rand_bytes(msg, sizeof(msg));
+			ep2_map_basic(p, msg, sizeof(msg));
+			TEST_ASSERT(ep2_is_valid(p) == 1, end);
+			ep2_mul(p, p, n);
+			TEST_ASSERT(ep2_is_infty(p) == 1, end);
+		}
+		TEST_END;
+#endif
+
+#if EP_MAP == SVDWM || !defined(STRIP)
+		TEST_BEGIN("point hashing with shallue-van de woestijne map is correct") {
+			rand_bytes(msg, sizeof(msg));
+			ep2_map_svdwm(p, msg, sizeof(msg));
+			TEST_ASSERT(ep2_is_valid(p) == 1, end);
+			ep2_map_svdwm(q, msg, sizeof(msg));
+			TEST_ASSERT(ep2_cmp(p, q) == RLC_EQ, end);
+			ep2_map_dst(q, msg, sizeof(msg), (const uint8_t *)"RELIC", 5);
+			TEST_ASSERT(ep2_is_valid(q) == 1, end);
+			TEST_ASSERT(ep2_cmp(p, q) != RLC_EQ, end);
+			ep2_mul(p, p, n);
+			TEST_ASSERT(ep2_is_infty(p) == 1, end);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1117,6 +1191,7 @@ static int hashing(void) {
   end:
 	bn_free(n);
 	ep2_free(p);
+	ep2_free(q);
 	return code;
 }
 
@@ -816,6 +816,17 @@ static int inversion(void) {
 		} TEST_END;
 #endif
 
+#if FP_INV == DIVST || !defined(STRIP)
+		TEST_BEGIN("division step inversion is correct") {
+			do {
+				fp_rand(a);
+			} while (fp_is_zero(a));
+			fp_inv(b, a);
+			fp_inv_divst(c, a);
+			TEST_ASSERT(fp_cmp(c, b) == RLC_EQ, end);
+		} TEST_END;
+#endif
+
 #if FP_INV == LOWER || !defined(STRIP)
 		TEST_BEGIN("lower inversion is correct") {
 			do {
@@ -939,16 +950,18 @@ static int exponentiation(void) {
 
 static int square_root(void) {
 	int code = RLC_ERR;
-	fp_t a, b, c;
+	fp_t a, b, c, d;
 
 	fp_null(a);
 	fp_null(b);
 	fp_null(c);
+	fp_null(d);
 
 	TRY {
 		fp_new(a);
 		fp_new(b);
 		fp_new(c);
+		fp_new(d);
 
 		TEST_BEGIN("square root extraction is correct") {
 			fp_rand(a);
@@ -963,6 +976,52 @@ static int square_root(void) {
 			}
 		}
 		TEST_END;
+
+		TEST_BEGIN("square root of a quotient is correct") {
+			fp_rand(a);
+			do {
+				fp_rand(b);
+			} while (fp_is_zero(b));
+			fp_sqr(c, a);
+			fp_mul(c, c, b);
+			TEST_ASSERT(fp_srt_rat(d, c, b), end);
+			fp_neg(c, d);
+			TEST_ASSERT(fp_cmp(d, a) == RLC_EQ || fp_cmp(c, a) == RLC_EQ, end);
+			fp_rand(a);
+			fp_inv(c, b);
+			fp_mul(c, c, a);
+			TEST_ASSERT(fp_srt_rat(d, a, b) == fp_srt(c, c), end);
+			if (fp_srt_rat(d, a, b)) {
+				fp_sqr(c, d);
+				fp_mul(c, c, b);
+				TEST_ASSERT(fp_cmp(c, a) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_BEGIN("inverse square root is correct") {
+			do {
+				fp_rand(a);
+			} while (fp_is_zero(a));
+			fp_sqr(c, a);
+			TEST_ASSERT(fp_srt_inv(b, c), end);
+			fp_mul(b, b, a);
+			fp_set_dig(c, 1);
+			fp_neg(d, c);
+			TEST_ASSERT(fp_cmp(b, c) == RLC_EQ || fp_cmp(b, d) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("legendre symbol is consistent with square roots") {
+			fp_rand(a);
+			fp_sqr(c, a);
+			TEST_ASSERT(fp_smb(c) == (fp_is_zero(a) ? 0 : 1), end);
+			fp_rand(a);
+			TEST_ASSERT(fp_smb(a) == (fp_srt(b, a) ? 1 : -1), end);
+			fp_zero(a);
+			TEST_ASSERT(fp_smb(a) == 0, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -972,6 +1031,7 @@ static int square_root(void) {
 	fp_free(a);
 	fp_free(b);
 	fp_free(c);
+	fp_free(d);
 	return code;
 }
 
@@ -2430,6 +2430,25 @@ static int multiplication12(void) {
 			TEST_ASSERT(fp12_cmp(c, d) == RLC_EQ, end);
 		} TEST_END;
 #endif
+
+		TEST_BEGIN("sparse by sparse multiplication is correct") {
+			fp12_rand(a);
+			fp12_rand(b);
+			if (ep2_curve_is_twist() == EP_DTYPE) {
+				fp2_zero(a[0][1]);
+				fp2_zero(b[0][1]);
+			} else {
+				fp2_zero(a[1][0]);
+				fp2_zero(b[1][0]);
+			}
+			fp2_zero(a[0][2]);
+			fp2_zero(a[1][2]);
+			fp2_zero(b[0][2]);
+			fp2_zero(b[1][2]);
+			fp12_mul(c, a, b);
+			fp12_mul_sxs(d, a, b);
+			TEST_ASSERT(fp12_cmp(c, d) == RLC_EQ, end);
+		} TEST_END;
 	} CATCH_ANY {
 		util_print("FATAL ERROR!\n");
 		ERROR(end);
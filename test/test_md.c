@@ -350,6 +350,59 @@ static int mgf(void) {
 #endif
 }
 
+static int xmd(void) {
+	int code = RLC_ERR;
+	uint8_t buf[128];
+
+#if MD_MAP == SH256
+	char *dst = "QUUX-V01-CS02-with-expander-SHA256-128";
+	char *msg[] = { "", "abc", "abcdef0123456789" };
+	uint8_t result0[][32] = {
+		{ 0x68, 0xA9, 0x85, 0xB8, 0x7E, 0xB6, 0xB4, 0x69, 0x52, 0x12, 0x89,
+			0x11, 0xF2, 0xA4, 0x41, 0x2B, 0xBC, 0x30, 0x2A, 0x9D, 0x75, 0x96,
+			0x67, 0xF8, 0x7F, 0x7A, 0x21, 0xD8, 0x03, 0xF0, 0x72, 0x35 },
+		{ 0xD8, 0xCC, 0xAB, 0x23, 0xB5, 0x98, 0x5C, 0xCE, 0xA8, 0x65, 0xC6,
+			0xC9, 0x7B, 0x6E, 0x5B, 0x83, 0x50, 0xE7, 0x94, 0xE6, 0x03, 0xB4,
+			0xB9, 0x79, 0x02, 0xF5, 0x3A, 0x8A, 0x0D, 0x60, 0x56, 0x15 }
+	};
+	uint8_t result1[] = {
+		0xEF, 0x90, 0x4A, 0x29, 0xBF, 0xFC, 0x4C, 0xF9, 0xEE, 0x82, 0x83, 0x24,
+		0x51, 0xC9, 0x46, 0xAC, 0x3C, 0x8F, 0x80, 0x58, 0xAE, 0x97, 0xD8, 0xD6,
+		0x29, 0x83, 0x1A, 0x74, 0xC6, 0x57, 0x2B, 0xD9, 0xEB, 0xD0, 0xDF, 0x63,
+		0x5C, 0xD1, 0xF2, 0x08, 0xE2, 0x03, 0x8E, 0x76, 0x0C, 0x49, 0x94, 0x98,
+		0x4C, 0xE7, 0x3F, 0x0D, 0x55, 0xEA, 0x9F, 0x22, 0xAF, 0x83, 0xBA, 0x47,
+		0x34, 0x56, 0x9D, 0x4B, 0xC9, 0x5E, 0x18, 0x35, 0x0F, 0x74, 0x0C, 0x07,
+		0xEE, 0xF6, 0x53, 0xCB, 0xB9, 0xF8, 0x79, 0x10, 0xD8, 0x33, 0x75, 0x18,
+		0x25, 0xF0, 0xEB, 0xEF, 0xA1, 0xAB, 0xE5, 0x42, 0x0B, 0xB5, 0x2B, 0xE1,
+		0x4C, 0xF4, 0x89, 0xB3, 0x7F, 0xE1, 0xA7, 0x2F, 0x7D, 0xE2, 0xD1, 0x0B,
+		0xE4, 0x53, 0xB2, 0xC9, 0xD9, 0xEB, 0x20, 0xC7, 0xE3, 0xF6, 0xED, 0xC5,
+		0xA6, 0x06, 0x29, 0x17, 0x8D, 0x94, 0x78, 0xDF
+	};
+
+	TEST_ONCE("expand_message_xmd (sha256) is correct") {
+		for (int j = 0; j < 2; j++) {
+			md_xmd(buf, 32, (uint8_t *)msg[j], strlen(msg[j]), (uint8_t *)dst,
+					strlen(dst));
+			TEST_ASSERT(memcmp(buf, result0[j], 32) == 0, end);
+		}
+		md_xmd(buf, 128, (uint8_t *)msg[2], strlen(msg[2]), (uint8_t *)dst,
+				strlen(dst));
+		TEST_ASSERT(memcmp(buf, result1, 128) == 0, end);
+	}
+	TEST_END;
+
+	code = RLC_OK;
+
+  end:
+	return code;
+
+#else
+	(void)code;
+	(void)buf;
+	return RLC_OK;
+#endif
+}
+
 static int hmac(void) {
 	int code = RLC_ERR;
 	uint8_t mac[MD_LEN];
@@ -514,6 +567,11 @@ int main(void) {
 		return 1;
 	}
 
+	if (xmd() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
 	if (hmac() != RLC_OK) {
 		core_clean();
 		return 1;
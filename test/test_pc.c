@@ -62,17 +62,26 @@ static int memory1(void) {
 
 int util1(void) {
 	int l, code = RLC_ERR;
-	g1_t a, b, c;
-	uint8_t bin[2 * PC_BYTES + 1];
+	g1_t a, b, c, d[80];
+	uint8_t bin[2 * PC_BYTES + 1], buf[80 * (2 * PC_BYTES + 1)];
+	bn_t h;
 
 	g1_null(a);
 	g1_null(b);
 	g1_null(c);
+	bn_null(h);
+	for (int j = 0; j < 80; j++) {
+		g1_null(d[j]);
+	}
 
 	TRY {
 		g1_new(a);
 		g1_new(b);
 		g1_new(c);
+		bn_new(h);
+		for (int j = 0; j < 80; j++) {
+			g1_new(d[j]);
+		}
 
 		TEST_BEGIN("comparison is consistent") {
 			g1_rand(a);
@@ -153,6 +162,63 @@ int util1(void) {
 			}
 		}
 		TEST_END;
+		TEST_BEGIN("reading and writing several points are consistent") {
+			for (int j = 0; j < 2; j++) {
+				for (int k = 0; k < 80; k++) {
+					g1_rand(a);
+					l = g1_size_bin(a, j);
+					g1_write_bin(buf + k * l, l, a, j);
+				}
+				g1_read_bin_sim(d, buf, l, 80);
+				for (int k = 0; k < 80; k++) {
+					g1_read_bin(a, buf + k * l, l);
+					TEST_ASSERT(g1_cmp(a, d[k]) == RLC_EQ, end);
+				}
+			}
+		}
+		TEST_END;
+
+#if defined(CHECK)
+		TEST_BEGIN("reading several points detects invalid points") {
+			int r;
+
+			ep_curve_get_cof(h);
+			/* Replace one point with a curve point outside the subgroup. */
+			do {
+				fp_rand(a->x);
+				fp_set_dig(a->z, 1);
+				a->norm = 1;
+				ep_rhs(a->y, a);
+			} while (!fp_srt(a->y, a->y));
+			for (int k = 0; k < 80; k++) {
+				g1_rand(b);
+				l = g1_size_bin(b, 1);
+				g1_write_bin(buf + k * l, l, (k == 50 ? a : b), 1);
+			}
+			r = 0;
+			TRY {
+				g1_read_bin_sim(d, buf, l, 80);
+			} CATCH_ANY {
+				r = 1;
+			}
+			TEST_ASSERT(r == (bn_cmp_dig(h, 1) != RLC_EQ), end);
+			/* Corrupt a coordinate so that a point is not on the curve. */
+			for (int k = 0; k < 80; k++) {
+				g1_rand(b);
+				l = g1_size_bin(b, 0);
+				g1_write_bin(buf + k * l, l, b, 0);
+			}
+			buf[30 * l - 1] ^= 1;
+			r = 0;
+			TRY {
+				g1_read_bin_sim(d, buf, l, 80);
+			} CATCH_ANY {
+				r = 1;
+			}
+			TEST_ASSERT(r == 1, end);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -163,6 +229,10 @@ int util1(void) {
 	g1_free(a);
 	g1_free(b);
 	g1_free(c);
+	bn_free(h);
+	for (int j = 0; j < 80; j++) {
+		g1_free(d[j]);
+	}
 	return code;
 }
 
@@ -363,6 +433,24 @@ static int multiplication1(void) {
 			g1_mul(r, p, n);
 			TEST_ASSERT(g1_is_infty(r) == 1, end);
 		} TEST_END;
+
+		TEST_BEGIN("subgroup membership test is correct") {
+			g1_rand(p);
+			TEST_ASSERT(g1_is_valid(p) == 1, end);
+			g1_set_infty(p);
+			TEST_ASSERT(g1_is_valid(p) == 1, end);
+			/* Points outside the subgroup exist if there is a cofactor. */
+			do {
+				fp_rand(p->x);
+				fp_set_dig(p->z, 1);
+				p->norm = 1;
+				ep_rhs(p->y, p);
+			} while (!fp_srt(p->y, p->y));
+			ep_curve_get_cof(k);
+			TEST_ASSERT(g1_is_valid(p) == (bn_cmp_dig(k, 1) == RLC_EQ), end);
+			fp_add_dig(p->y, p->y, 1);
+			TEST_ASSERT(g1_is_valid(p) == 0, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -604,17 +692,23 @@ static int memory2(void) {
 
 int util2(void) {
 	int l, code = RLC_ERR;
-	g2_t a, b, c;
-	uint8_t bin[4 * PC_BYTES + 1];
+	g2_t a, b, c, d[80];
+	uint8_t bin[4 * PC_BYTES + 1], buf[80 * (4 * PC_BYTES + 1)];
 
 	g2_null(a);
 	g2_null(b);
 	g2_null(c);
+	for (int j = 0; j < 80; j++) {
+		g2_null(d[j]);
+	}
 
 	TRY {
 		g2_new(a);
 		g2_new(b);
 		g2_new(c);
+		for (int j = 0; j < 80; j++) {
+			g2_new(d[j]);
+		}
 
 		TEST_BEGIN("comparison is consistent") {
 			g2_rand(a);
@@ -695,6 +789,62 @@ int util2(void) {
 			}
 		}
 		TEST_END;
+		TEST_BEGIN("reading and writing several points are consistent") {
+			for (int j = 0; j < 2; j++) {
+				for (int k = 0; k < 80; k++) {
+					g2_rand(a);
+					l = g2_size_bin(a, j);
+					g2_write_bin(buf + k * l, l, a, j);
+				}
+				g2_read_bin_sim(d, buf, l, 80);
+				for (int k = 0; k < 80; k++) {
+					g2_read_bin(a, buf + k * l, l);
+					TEST_ASSERT(g2_cmp(a, d[k]) == RLC_EQ, end);
+				}
+			}
+		}
+		TEST_END;
+
+#if defined(CHECK)
+		TEST_BEGIN("reading several points detects invalid points") {
+			int r;
+
+			/* Replace one point with a twist point outside the subgroup. */
+			do {
+				fp2_rand(a->x);
+				fp2_set_dig(a->z, 1);
+				a->norm = 1;
+				ep2_rhs(a->y, a);
+			} while (!fp2_srt(a->y, a->y));
+			for (int k = 0; k < 80; k++) {
+				g2_rand(b);
+				l = g2_size_bin(b, 1);
+				g2_write_bin(buf + k * l, l, (k == 50 ? a : b), 1);
+			}
+			r = 0;
+			TRY {
+				g2_read_bin_sim(d, buf, l, 80);
+			} CATCH_ANY {
+				r = 1;
+			}
+			TEST_ASSERT(r == 1, end);
+			/* Corrupt a coordinate so that a point is not on the curve. */
+			for (int k = 0; k < 80; k++) {
+				g2_rand(b);
+				l = g2_size_bin(b, 0);
+				g2_write_bin(buf + k * l, l, b, 0);
+			}
+			buf[30 * l - 1] ^= 1;
+			r = 0;
+			TRY {
+				g2_read_bin_sim(d, buf, l, 80);
+			} CATCH_ANY {
+				r = 1;
+			}
+			TEST_ASSERT(r == 1, end);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -705,6 +855,9 @@ int util2(void) {
 	g2_free(a);
 	g2_free(b);
 	g2_free(c);
+	for (int j = 0; j < 80; j++) {
+		g2_free(d[j]);
+	}
 	return code;
 }
 
@@ -905,6 +1058,23 @@ static int multiplication2(void) {
 			g2_mul(r, p, n);
 			TEST_ASSERT(g2_is_infty(r) == 1, end);
 		} TEST_END;
+
+		TEST_BEGIN("subgroup membership test is correct") {
+			g2_rand(p);
+			TEST_ASSERT(g2_is_valid(p) == 1, end);
+			g2_set_infty(p);
+			TEST_ASSERT(g2_is_valid(p) == 1, end);
+			/* The twist always has a large cofactor. */
+			do {
+				fp2_rand(p->x);
+				fp2_set_dig(p->z, 1);
+				p->norm = 1;
+				ep2_rhs(p->y, p);
+			} while (!fp2_srt(p->y, p->y));
+			TEST_ASSERT(g2_is_valid(p) == 0, end);
+			fp_add_dig(p->y[0], p->y[0], 1);
+			TEST_ASSERT(g2_is_valid(p) == 0, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1362,6 +1532,16 @@ int exponentiation(void) {
 			TEST_ASSERT(gt_is_valid(a), end);
 		} TEST_END;
 
+		TEST_BEGIN("subgroup membership test is correct") {
+			gt_set_unity(a);
+			TEST_ASSERT(gt_is_valid(a), end);
+			fp12_rand(a);
+			TEST_ASSERT(gt_is_valid(a) == 0, end);
+			/* Elements of the cyclotomic subgroup are not all in G_T. */
+			fp12_conv_cyc(a, a);
+			TEST_ASSERT(gt_is_valid(a) == 0, end);
+		} TEST_END;
+
 		TEST_BEGIN("exponentiation is correct") {
 			gt_rand(a);
 			bn_zero(d);
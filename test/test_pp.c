@@ -746,9 +746,10 @@ static int doubling12(void) {
 static int pairing12(void) {
 	int j, code = RLC_ERR;
 	bn_t k, n;
-	ep_t p[2];
-	ep2_t q[2], r;
+	ep_t p[2], u[7];
+	ep2_t q[2], r, v[7];
 	fp12_t e1, e2;
+	fp6_t w[2][RLC_PP_TABLE], *_w[2] = { w[0], w[1] };
 
 	bn_null(k);
 	bn_null(n);
@@ -769,6 +770,18 @@ static int pairing12(void) {
 			ep_new(p[j]);
 			ep2_new(q[j]);
 		}
+		for (j = 0; j < 7; j++) {
+			ep_null(u[j]);
+			ep2_null(v[j]);
+			ep_new(u[j]);
+			ep2_new(v[j]);
+		}
+		for (j = 0; j < RLC_PP_TABLE; j++) {
+			fp6_null(w[0][j]);
+			fp6_null(w[1][j]);
+			fp6_new(w[0][j]);
+			fp6_new(w[1][j]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -1023,6 +1036,71 @@ static int pairing12(void) {
 			pp_map_sim_oatep_k12(e2, p, q, 2);
 			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("optimal ate multi-pairing of many points is correct") {
+			for (j = 0; j < 7; j++) {
+				ep_rand(u[j]);
+				ep2_rand(v[j]);
+				/* Leave some points in projective coordinates. */
+				if (j & 1) {
+					ep_dbl(u[j], u[j]);
+					ep2_dbl(v[j], v[j]);
+				}
+			}
+			pp_map_sim_oatep_k12(e1, u, v, 7);
+			pp_map_sim_lot_oatep_k12(e2, u, v, 7);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			pp_map_sim_oatep_k12(e1, u, v, 6);
+			pp_map_sim_lot_oatep_k12(e2, u, v, 6);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(u[2]);
+			ep2_set_infty(v[5]);
+			pp_map_sim_oatep_k12(e1, u, v, 7);
+			pp_map_sim_lot_oatep_k12(e2, u, v, 7);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_neg(u[1], u[0]);
+			ep2_dbl(v[1], v[0]);
+			pp_map_oatep_k12(e1, u[0], v[0]);
+			pp_map_sim_lot_oatep_k12(e2, u, v, 2);
+			fp12_mul(e1, e1, e2);
+			TEST_ASSERT(fp12_cmp_dig(e1, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_BEGIN("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			pp_map_pre_k12(w[0], q[0]);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_map_fix_oatep_k12(e2, p[0], w[0]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_dbl(p[0], p[0]);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_map_fix_oatep_k12(e2, p[0], w[0]);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[0]);
+			pp_map_fix_oatep_k12(e2, p[0], w[0]);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+			ep_rand(p[0]);
+			ep2_set_infty(r);
+			pp_map_pre_k12(w[1], r);
+			pp_map_fix_oatep_k12(e2, p[0], w[1]);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_BEGIN("optimal ate multi-pairing with precomputation is correct") {
+			for (j = 0; j < 2; j++) {
+				ep_rand(p[j]);
+				ep2_rand(q[j]);
+				pp_map_pre_k12(w[j], q[j]);
+			}
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_sim_fix_oatep_k12(e2, p, _w, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[1]);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_map_sim_fix_oatep_k12(e2, p, _w, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+		} TEST_END;
 #endif
 	}
 	CATCH_ANY {
@@ -1041,6 +1119,14 @@ static int pairing12(void) {
 		ep_free(p[j]);
 		ep2_free(q[j]);
 	}
+	for (j = 0; j < 7; j++) {
+		ep_free(u[j]);
+		ep2_free(v[j]);
+	}
+	for (j = 0; j < RLC_PP_TABLE; j++) {
+		fp6_free(w[0][j]);
+		fp6_free(w[1][j]);
+	}
 	return code;
 }
 
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+#
+# Generates the addition chains used by src/fp/relic_fp_srt.c to raise field
+# elements to the square-root exponent of the named primes. Each step of a
+# chain is a row {d, s, n, m} computing t[d] = t[s]^(2^n) * t[m], where the
+# multiplication is skipped if m is equal to d and t[0] holds the base.
+#
+# The exponent is split from the most significant bit into long runs of ones,
+# raised with blocks x^(2^L - 1) built from each other, and odd windows, taken
+# from a table of odd powers. The parameters with the fewest operations win.
+
+import random
+
+
+def bn(x):
+	"""Returns the prime of the BN curve with parameter x."""
+	return 36 * x**4 + 36 * x**3 + 24 * x**2 + 6 * x + 1
+
+
+def b12(x):
+	"""Returns the prime of the BLS12 curve with parameter x."""
+	return (x - 1)**2 * (x**4 - x**2 + 1) // 3 + x
+
+
+# Prime identifier, FP_PRIME and modulus of the primes with chains, with the
+# pairing-friendly ones given by the same parameters as relic_fp_param.c.
+PRIMES = [
+	('BN_254', 254, bn(-(2**62 + 2**55 + 1))),
+	('PRIME_25519', 255, 2**255 - 19),
+	('NIST_256', 256, 2**256 - 2**224 + 2**192 + 2**96 - 1),
+	('SECG_256', 256, 2**256 - 2**32 - 977),
+	('B12_381', 381, b12(-(2**63 + 2**62 + 2**60 + 2**57 + 2**48 + 2**16))),
+]
+
+
+def srt_exp(p):
+	"""Returns the exponent cached by fp_prime_set() in ctx->srt."""
+	if p % 4 == 3:
+		return (p - 3) // 4
+	if p % 8 == 5:
+		return (p - 5) // 8
+	raise ValueError('no chain for p = 1 mod 8')
+
+
+def split(e, w, t, b):
+	"""Splits e into digits (position, kind, value), most significant first."""
+	bits = bin(e)[2:]
+	n = len(bits)
+	i = 0
+	digits = []
+	while i < n:
+		if bits[i] == '0':
+			i += 1
+			continue
+		l = 0
+		while i + l < n and bits[i + l] == '1':
+			l += 1
+		if l >= t:
+			# Long runs of ones are taken in blocks of at most b bits.
+			while l > 0:
+				c = min(b, l)
+				digits.append((n - i - c, 'run', c))
+				i += c
+				l -= c
+			continue
+		j = min(i + w, n)
+		while bits[j - 1] == '0':
+			j -= 1
+		digits.append((n - j, 'odd', int(bits[i:j], 2)))
+		i = j
+	return digits
+
+
+class Chain:
+	def __init__(self):
+		self.steps = []
+		self.slots = 1
+		self.ops = 0
+
+	def new(self):
+		self.slots += 1
+		return self.slots - 1
+
+	def step(self, d, s, n, m):
+		assert n > 0 or d != m
+		self.steps.append((d, s, n, m))
+		self.ops += n + (d != m)
+
+
+def build(e, w, t, b):
+	digits = split(e, w, t, b)
+	odd = [v for _, k, v in digits if k == 'odd']
+	runs = sorted({v for _, k, v in digits if k == 'run'})
+	c = Chain()
+	tab = {1: 0}
+	# Odd powers x^3, x^5, ..., up to the largest window.
+	if odd and max(odd) > 1:
+		x2 = c.new()
+		c.step(x2, 0, 0, 0)
+		for v in range(3, max(odd) + 1, 2):
+			tab[v] = c.new()
+			c.step(tab[v], tab[v - 2], 0, x2)
+	run = {l: tab[(1 << l) - 1] for l in range(1, 8) if (1 << l) - 1 in tab}
+
+	def block(l):
+		# x^(2^(a + b) - 1) = (x^(2^a - 1))^(2^b) * x^(2^b - 1).
+		if l not in run:
+			a = max(k for k in run if k < l)
+			block(l - a)
+			run[l] = c.new()
+			if l - a <= a:
+				c.step(run[l], run[a], l - a, run[l - a])
+			else:
+				c.step(run[l], run[l - a], a, run[a])
+		return run[l]
+
+	for l in runs:
+		block(l)
+	acc = c.new()
+	src, pos = None, None
+	for p, k, v in digits:
+		r = tab[v] if k == 'odd' else run[v]
+		if src is None:
+			src, pos = r, p
+			continue
+		c.step(acc, src, pos - p, r)
+		src, pos = acc, p
+	if pos > 0:
+		c.step(acc, src, pos, acc)
+	return c, acc
+
+
+def best(e):
+	res = None
+	for w in range(1, 7):
+		for t in list(range(w + 1, 40)) + [e.bit_length() + 1]:
+			for b in [8, 12, 16, 24, 30, 32, 48, 64, 96, 128, 256]:
+				c, acc = build(e, w, t, b)
+				if res is None or (c.ops, c.slots) < (res[0].ops, res[0].slots):
+					res = (c, acc)
+	return res
+
+
+def check(c, acc, e, p):
+	for _ in range(16):
+		t = [0] * c.slots
+		t[0] = x = random.randrange(2, p)
+		for d, s, n, m in c.steps:
+			t[d] = pow(t[s], 1 << n, p) * (t[m] if m != d else 1) % p
+		assert t[acc] == pow(x, e, p)
+
+
+def main():
+	for name, bits, p in PRIMES:
+		e = srt_exp(p)
+		c, acc = best(e)
+		check(c, acc, e, p)
+		assert acc == c.steps[-1][0] and c.slots <= 32
+		rows = ['{%d, %d, %d, %d}' % s for s in c.steps]
+		print('#if FP_PRIME == %d' % bits)
+		print('/**')
+		print(' * Addition chain for the square-root exponent of %s '
+				'(%d operations).' % (name, c.ops))
+		print(' */')
+		print('static const uint8_t srt_%s[][4] = {' % name.lower())
+		line = '\t'
+		for i, r in enumerate(rows):
+			r += ',' if i < len(rows) - 1 else ''
+			if len(line.expandtabs(4)) + len(r) + 1 > 80:
+				print(line.rstrip())
+				line = '\t'
+			line += r + ' '
+		print(line.rstrip())
+		print('};')
+		print('#endif')
+		print()
+
+
+if __name__ == '__main__':
+	main()